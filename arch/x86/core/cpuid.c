@@ -10,6 +10,18 @@
 #include <zephyr/arch/x86/cpuid.h>
 #include <zephyr/kernel.h>
 
+uint32_t z_x86_cpuid_basic_features(void)
+{
+	uint32_t eax, ebx, ecx = 0U, edx;
+
+	if (__get_cpuid(CPUID_BASIC_INFO_1,
+			&eax, &ebx, &ecx, &edx) == 0) {
+		return 0;
+	}
+
+	return ecx;
+}
+
 uint32_t z_x86_cpuid_extended_features(void)
 {
 	uint32_t eax, ebx, ecx = 0U, edx;
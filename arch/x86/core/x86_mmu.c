@@ -911,6 +911,12 @@ static inline bool atomic_pte_cas(pentry_t *target, pentry_t old_value,
  */
 #define OPTION_CLEAR		BIT(3)
 
+/* Indicates that suitably aligned parts of the region may be mapped with
+ * large pages instead of individual PTEs. Only honored when establishing
+ * new present mappings.
+ */
+#define OPTION_LARGE		BIT(4)
+
 /**
  * Atomically update bits in a page table entry
  *
@@ -969,6 +975,172 @@ static inline pentry_t pte_atomic_update(pentry_t *pte, pentry_t update_val,
 	return old_val;
 }
 
+#ifdef CONFIG_X86_MMU_LARGE_PAGES
+/* Size and alignment of a large page, the scope of a page directory entry */
+#define LARGE_PAGE_SIZE		PT_AREA
+
+/* Original page directory entries for the page directory entries currently
+ * holding a large page, indexed by the large page within [PT_START, PT_END).
+ * The page tables they point to are part of the statically generated set,
+ * so keeping the entries around lets large pages be split again without
+ * having to allocate memory.
+ */
+__pinned_bss
+static pentry_t large_page_pdes[NUM_PT];
+
+__pinned_func
+static inline pentry_t *large_page_pde_slot(void *virt)
+{
+	return &large_page_pdes[((uintptr_t)virt - PT_START) / LARGE_PAGE_SIZE];
+}
+
+/* Whether a large page can be used to map virt to phys, with size bytes
+ * left to map in the region
+ */
+__pinned_func
+static inline bool large_page_usable(void *virt, uintptr_t phys, size_t size,
+				     pentry_t entry_flags, uint32_t options)
+{
+	return ((options & OPTION_LARGE) != 0U) &&
+	       ((options & (OPTION_RESET | OPTION_CLEAR)) == 0U) &&
+	       ((entry_flags & MMU_P) != 0U) &&
+	       (size >= LARGE_PAGE_SIZE) &&
+	       (((uintptr_t)virt % LARGE_PAGE_SIZE) == 0U) &&
+	       ((phys % LARGE_PAGE_SIZE) == 0U) &&
+	       ((uintptr_t)virt >= PT_START) &&
+	       (((uintptr_t)virt - PT_START) < (PT_END - PT_START));
+}
+
+/**
+ * Map a large page in place of a page table
+ *
+ * @param ptables Page tables to modify
+ * @param virt Large page aligned virtual address
+ * @param entry_val Large page aligned physical address and entry flags
+ *
+ * @retval 0 if successful
+ * @retval -EFAULT if large page or missing page table level encountered
+ */
+__pinned_func
+static int large_page_set(pentry_t *ptables, void *virt, pentry_t entry_val)
+{
+	pentry_t *table = ptables;
+	pentry_t *entryp;
+
+	for (int level = 0; level < PDE_LEVEL; level++) {
+		entryp = get_entry_ptr(table, virt, level);
+
+		CHECKIF(!((*entryp & (MMU_P | MMU_PS)) == MMU_P)) {
+			LOG_ERR("cannot map large page at %p", virt);
+			return -EFAULT;
+		}
+
+		table = next_table(*entryp, level);
+	}
+
+	entryp = get_entry_ptr(table, virt, PDE_LEVEL);
+
+	if ((*entryp & MMU_PS) == 0U) {
+		CHECKIF(!((*entryp & MMU_P) != 0U)) {
+			LOG_ERR("missing page table level %d when trying to map %p",
+				PTE_LEVEL, virt);
+			return -EFAULT;
+		}
+
+		*large_page_pde_slot(virt) = *entryp;
+	}
+
+	(void)pte_atomic_update(entryp, entry_val | MMU_PS, MASK_ALL, 0);
+
+	return 0;
+}
+
+/**
+ * Split a large page back into its page table
+ *
+ * The page table gets one PTE per page of the large page, each with the
+ * same flags, so that the mapping is unchanged by the split.
+ *
+ * @param entryp Page directory entry holding the large page
+ * @param virt Virtual address within the large page
+ *
+ * @retval 0 if successful
+ * @retval -EFAULT if the page table of the large page is not known
+ */
+__pinned_func
+static int large_page_split(pentry_t *entryp, void *virt)
+{
+	pentry_t *slot, *table, entry, flags;
+	uintptr_t phys;
+
+	CHECKIF(!(((uintptr_t)virt >= PT_START) &&
+		  (((uintptr_t)virt - PT_START) < (PT_END - PT_START)))) {
+		LOG_ERR("large page encountered");
+		return -EFAULT;
+	}
+
+	slot = large_page_pde_slot(virt);
+
+	CHECKIF(!(*slot != 0U)) {
+		LOG_ERR("large page encountered");
+		return -EFAULT;
+	}
+
+	entry = *entryp;
+	phys = get_entry_phys(entry, PDE_LEVEL);
+	flags = entry & ~(paging_levels[PDE_LEVEL].mask | MMU_PS);
+	table = next_table(*slot, PDE_LEVEL);
+
+	for (size_t i = 0; i < get_num_entries(PTE_LEVEL); i++) {
+		table[i] = (pentry_t)(phys + (i * CONFIG_MMU_PAGE_SIZE)) | flags;
+	}
+
+	(void)pte_atomic_update(entryp, *slot, MASK_ALL, 0);
+	*slot = 0U;
+
+	/* Drops the large page translation as well as the cached page
+	 * directory entry
+	 */
+	tlb_flush_page(virt);
+
+	return 0;
+}
+#else
+__pinned_func
+static inline bool large_page_usable(void *virt, uintptr_t phys, size_t size,
+				     pentry_t entry_flags, uint32_t options)
+{
+	ARG_UNUSED(virt);
+	ARG_UNUSED(phys);
+	ARG_UNUSED(size);
+	ARG_UNUSED(entry_flags);
+	ARG_UNUSED(options);
+
+	return false;
+}
+
+__pinned_func
+static inline int large_page_set(pentry_t *ptables, void *virt, pentry_t entry_val)
+{
+	ARG_UNUSED(ptables);
+	ARG_UNUSED(virt);
+	ARG_UNUSED(entry_val);
+
+	return -ENOTSUP;
+}
+
+__pinned_func
+static inline int large_page_split(pentry_t *entryp, void *virt)
+{
+	ARG_UNUSED(entryp);
+	ARG_UNUSED(virt);
+
+	LOG_ERR("large page encountered");
+
+	return -EFAULT;
+}
+#endif /* CONFIG_X86_MMU_LARGE_PAGES */
+
 /**
  * Low level page table update function for a virtual page
  *
@@ -998,7 +1170,8 @@ static inline pentry_t pte_atomic_update(pentry_t *pte, pentry_t update_val,
  * @param options Control options, described above
  *
  * @retval 0 if successful
- * @retval -EFAULT if large page encountered or missing page table level
+ * @retval -EFAULT if large page that cannot be split encountered or missing
+ *         page table level
  */
 __pinned_func
 static int page_map_set(pentry_t *ptables, void *virt, pentry_t entry_val,
@@ -1025,8 +1198,18 @@ static int page_map_set(pentry_t *ptables, void *virt, pentry_t entry_val,
 			break;
 		}
 
+		/* Large pages are split back into their page table so that
+		 * a single page of them can be updated.
+		 */
+		if ((level == PDE_LEVEL) && ((*entryp & MMU_PS) != 0U)) {
+			ret = large_page_split(entryp, virt);
+			if (ret != 0) {
+				goto out;
+			}
+		}
+
 		/* We bail out early here due to no support for
-		 * splitting existing bigpage mappings.
+		 * splitting existing bigpage mappings at other levels.
 		 * If the PS bit is not supported at some level (like
 		 * in a PML4 entry) it is always reserved and must be 0
 		 */
@@ -1098,6 +1281,7 @@ static int range_map_ptables(pentry_t *ptables, void *virt, uintptr_t phys,
 {
 	bool zero_entry = (options & (OPTION_RESET | OPTION_CLEAR)) != 0U;
 	int ret = 0, ret2;
+	size_t step;
 
 	CHECKIF(!is_addr_aligned(phys) || !is_size_aligned(size)) {
 		ret = -EINVAL;
@@ -1115,7 +1299,7 @@ static int range_map_ptables(pentry_t *ptables, void *virt, uintptr_t phys,
 	 * We do a full page table walk for every page we are updating.
 	 * Recursive approaches are possible, but use much more stack space.
 	 */
-	for (size_t offset = 0; offset < size; offset += CONFIG_MMU_PAGE_SIZE) {
+	for (size_t offset = 0; offset < size; offset += step) {
 		uint8_t *dest_virt = (uint8_t *)virt + offset;
 		pentry_t entry_val;
 
@@ -1125,8 +1309,15 @@ static int range_map_ptables(pentry_t *ptables, void *virt, uintptr_t phys,
 			entry_val = (pentry_t)(phys + offset) | entry_flags;
 		}
 
-		ret2 = page_map_set(ptables, dest_virt, entry_val, NULL, mask,
-				   options);
+		if (large_page_usable(dest_virt, phys + offset, size - offset,
+				      entry_flags, options)) {
+			step = get_entry_scope(PDE_LEVEL);
+			ret2 = large_page_set(ptables, dest_virt, entry_val);
+		} else {
+			step = CONFIG_MMU_PAGE_SIZE;
+			ret2 = page_map_set(ptables, dest_virt, entry_val,
+					    NULL, mask, options);
+		}
 		ARG_UNUSED(ret2);
 		CHECKIF(ret2 != 0) {
 			ret = ret2;
@@ -1295,10 +1486,19 @@ static pentry_t flags_to_entry(uint32_t flags)
 __pinned_func
 void arch_mem_map(void *virt, uintptr_t phys, size_t size, uint32_t flags)
 {
+	uint32_t options = 0U;
 	int ret;
 
+	/* Replacing page table pointers with large pages needs the paging
+	 * structure caches to be flushed.
+	 */
+	if (IS_ENABLED(CONFIG_X86_MMU_LARGE_PAGES) &&
+	    (flags & K_MEM_LARGE_PAGES) != 0U) {
+		options = OPTION_LARGE | OPTION_FLUSH;
+	}
+
 	ret = range_map_unlocked(virt, phys, size, flags_to_entry(flags),
-				 MASK_ALL, 0);
+				 MASK_ALL, options);
 	__ASSERT_NO_MSG(ret == 0);
 	ARG_UNUSED(ret);
 }
@@ -1314,6 +1514,18 @@ void arch_mem_unmap(void *addr, size_t size)
 	ARG_UNUSED(ret);
 }
 
+#ifdef CONFIG_X86_MMU_LARGE_PAGES
+/* Let regions that can hold large pages get a virtual address that can too */
+size_t arch_virt_region_align(uintptr_t phys, size_t size)
+{
+	if ((size >= LARGE_PAGE_SIZE) && ((phys % LARGE_PAGE_SIZE) == 0U)) {
+		return LARGE_PAGE_SIZE;
+	}
+
+	return CONFIG_MMU_PAGE_SIZE;
+}
+#endif /* CONFIG_X86_MMU_LARGE_PAGES */
+
 #ifdef K_MEM_IS_VM_KERNEL
 __boot_func
 static void identity_map_remove(uint32_t level)
@@ -2076,7 +2288,11 @@ int arch_page_phys_get(void *virt, uintptr_t *phys)
 
 	if ((pte & MMU_P) != 0) {
 		if (phys != NULL) {
-			*phys = (uintptr_t)get_entry_phys(pte, PTE_LEVEL);
+			*phys = (uintptr_t)get_entry_phys(pte, level);
+			if (level != PTE_LEVEL) {
+				/* Large page */
+				*phys += POINTER_TO_UINT(virt) & (get_entry_scope(level) - 1);
+			}
 		}
 		ret = 0;
 	} else {
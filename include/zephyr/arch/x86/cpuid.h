@@ -20,6 +20,11 @@ extern "C" {
 #define CPUID_SPEC_CTRL_SSBD	BIT(31)
 #define CPUID_SPEC_CTRL_IBRS	BIT(26)
 
+/* Bits to check in CPUID basic features (ECX) */
+#define CPUID_BASIC_SSE4_2	BIT(20)
+
+uint32_t z_x86_cpuid_basic_features(void);
+
 uint32_t z_x86_cpuid_extended_features(void);
 
 uint8_t z_x86_cpuid_get_current_physical_apic_id(void);
@@ -80,6 +80,31 @@ struct json_obj_token {
 	size_t length;
 };
 
+/**
+ * @brief State of an object parsed from data received in chunks
+ *
+ * @see json_obj_stream_init()
+ */
+struct json_obj_stream {
+	/** @cond INTERNAL_HIDDEN */
+	char *buf;
+	size_t buf_size;
+	/* Bytes at the start of buf holding members that decoded values point into */
+	size_t kept;
+	/* Bytes of the member being received, which follows them */
+	size_t len;
+	const struct json_obj_descr *descr;
+	size_t descr_len;
+	void *val;
+	/* Fields decoded so far */
+	int64_t decoded;
+	/* Nesting level of the data received so far */
+	int depth;
+	bool in_string;
+	bool escape;
+	bool done;
+	/** @endcond */
+};
 
 struct json_obj_descr {
 	const char *field_name;
@@ -700,6 +725,52 @@ int json_arr_separate_object_parse_init(struct json_obj *json, char *payload, si
 int json_arr_separate_parse_object(struct json_obj *json, const struct json_obj_descr *descr,
 				   size_t descr_len, void *val);
 
+/**
+ * @brief Initialize the parsing of an object received in chunks
+ *
+ * Use json_obj_stream_feed() to pass the data as it is received, for
+ * instance from successive socket reads or from the fragments of a
+ * network buffer, instead of gathering the whole object first. Each member
+ * of the object is decoded as soon as it has been received.
+ *
+ * Decoded strings and tokens point into @p buf, which must stay valid as
+ * long as the values are used. Only the members holding such values stay
+ * in @p buf once decoded: it must be large enough for them, and for the
+ * largest other member. Unknown members and members decoded into numbers,
+ * booleans or string buffers are dropped once decoded.
+ *
+ * @param stream Stream state to initialize
+ * @param buf Buffer to hold the object
+ * @param buf_size Size of @p buf
+ * @param descr Pointer to the descriptor array
+ * @param descr_len Number of elements in the descriptor array. Must be less
+ * than 63.
+ * @param val Pointer to the struct to hold the decoded values
+ */
+void json_obj_stream_init(struct json_obj_stream *stream, char *buf, size_t buf_size,
+			  const struct json_obj_descr *descr, size_t descr_len, void *val);
+
+/**
+ * @brief Pass the next chunk of an object received in chunks
+ *
+ * The members completed by the chunk are decoded as with json_obj_parse().
+ * Once the chunk holding the end of the object has been passed, the fields
+ * decoded from all members are returned. Data following the end of the
+ * object in that chunk is ignored.
+ *
+ * @param stream Stream state initialized with json_obj_stream_init()
+ * @param data Next chunk of the JSON-encoded object
+ * @param len Length of @p data
+ *
+ * @retval -EAGAIN if the end of the object has not been received yet
+ * @retval -ENOMEM if a member does not fit in the stream buffer
+ * @retval -EINVAL if the data is not a JSON object
+ * @retval -EALREADY if the object has been parsed already
+ * @return Otherwise, as json_obj_parse(): < 0 if error, bitmap of decoded
+ * fields on success.
+ */
+int64_t json_obj_stream_feed(struct json_obj_stream *stream, const void *data, size_t len);
+
 /**
  * @brief Escapes the string so it can be used to encode JSON objects
  *
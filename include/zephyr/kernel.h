@@ -23,6 +23,7 @@
 #include <zephyr/sys/mem_stats.h>
 #include <zephyr/sys/iterable_sections.h>
 #include <zephyr/sys/ring_buffer.h>
+#include <zephyr/sys/mpmc_lockfree.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -2173,6 +2174,23 @@ int k_queue_merge_slist(struct k_queue *queue, sys_slist_t *list);
  */
 __syscall void *k_queue_get(struct k_queue *queue, k_timeout_t timeout);
 
+/**
+ * @brief Get up to a number of elements from a queue at once.
+ *
+ * This routine removes the first @a max data items of @a queue, or all of
+ * them if it holds fewer, under a single lock and without waiting. The first
+ * word of each data item is reserved for the kernel's use.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param queue Address of the queue.
+ * @param data Array receiving the addresses of the data items.
+ * @param max Maximum number of data items to get.
+ *
+ * @return Number of data items stored in @a data.
+ */
+size_t k_queue_get_multi(struct k_queue *queue, void **data, size_t max);
+
 /**
  * @brief Remove an element from a queue.
  *
@@ -3050,6 +3068,7 @@ __syscall int k_stack_pop(struct k_stack *stack, stack_data_t *data,
 
 struct k_work;
 struct k_work_q;
+struct k_work_q_worker;
 struct k_work_queue_config;
 extern struct k_work_q k_sys_work_q;
 
@@ -3063,6 +3082,18 @@ extern struct k_work_q k_sys_work_q;
  * @{
  */
 
+/**
+ * @brief Adaptive spinning statistics of a mutex or semaphore
+ *
+ * See @kconfig{CONFIG_SYNC_ADAPTIVE_SPIN}.
+ */
+struct k_adaptive_spin_stats {
+	/** Contended acquisitions that succeeded while spinning */
+	uint32_t success;
+	/** Spins that gave up and pended */
+	uint32_t failure;
+};
+
 /**
  * Mutex Structure
  * @ingroup mutex_apis
@@ -3079,6 +3110,11 @@ struct k_mutex {
 	/** Original thread priority */
 	int owner_orig_prio;
 
+#ifdef CONFIG_SYNC_ADAPTIVE_SPIN
+	/** Adaptive spinning statistics */
+	struct k_adaptive_spin_stats spin_stats;
+#endif
+
 	SYS_PORT_TRACING_TRACKING_FIELD(k_mutex)
 
 #ifdef CONFIG_OBJ_CORE_MUTEX
@@ -3174,6 +3210,20 @@ __syscall int k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout);
  */
 __syscall int k_mutex_unlock(struct k_mutex *mutex);
 
+#if defined(CONFIG_SYNC_ADAPTIVE_SPIN) || defined(__DOXYGEN__)
+/**
+ * @brief Get the adaptive spinning statistics of a mutex.
+ *
+ * @param mutex Address of the mutex.
+ *
+ * @return Counts of spins that acquired @a mutex and of spins that gave up.
+ */
+static inline struct k_adaptive_spin_stats k_mutex_spin_stats_get(const struct k_mutex *mutex)
+{
+	return mutex->spin_stats;
+}
+#endif
+
 /**
  * @}
  */
@@ -3282,6 +3332,10 @@ struct k_sem {
 
 	Z_DECL_POLL_EVENT
 
+#ifdef CONFIG_SYNC_ADAPTIVE_SPIN
+	struct k_adaptive_spin_stats spin_stats;
+#endif
+
 	SYS_PORT_TRACING_TRACKING_FIELD(k_sem)
 
 #ifdef CONFIG_OBJ_CORE_SEM
@@ -3396,6 +3450,20 @@ static inline unsigned int z_impl_k_sem_count_get(struct k_sem *sem)
 	return sem->count;
 }
 
+#if defined(CONFIG_SYNC_ADAPTIVE_SPIN) || defined(__DOXYGEN__)
+/**
+ * @brief Get the adaptive spinning statistics of a semaphore.
+ *
+ * @param sem Address of the semaphore.
+ *
+ * @return Counts of spins that took @a sem and of spins that gave up.
+ */
+static inline struct k_adaptive_spin_stats k_sem_spin_stats_get(const struct k_sem *sem)
+{
+	return sem->spin_stats;
+}
+#endif
+
 /**
  * @brief Statically define and initialize a semaphore.
  *
@@ -3416,6 +3484,157 @@ static inline unsigned int z_impl_k_sem_count_get(struct k_sem *sem)
 
 /** @} */
 
+#ifdef CONFIG_THREAD_POOL
+/**
+ * @defgroup thread_pool_apis Thread Pool APIs
+ * @ingroup kernel_apis
+ * @{
+ */
+
+/**
+ * @cond INTERNAL_HIDDEN
+ */
+
+struct k_thread_pool_worker {
+	struct k_thread thread;
+	sys_snode_t node;
+	k_thread_entry_t entry;
+	void *p1;
+	void *p2;
+	void *p3;
+	struct k_sem start;
+	struct k_sem done;
+	/* Ownership of the thread, protected by the pool lock */
+	uint8_t state;
+	bool finished;
+};
+
+/**
+ * INTERNAL_HIDDEN @endcond
+ */
+
+/**
+ * @brief Thread pool structure
+ *
+ * Pools are created with K_THREAD_POOL_DEFINE() and started with
+ * k_thread_pool_start().
+ */
+struct k_thread_pool {
+	/** @cond INTERNAL_HIDDEN */
+	struct k_thread_pool_worker *workers;
+	k_thread_stack_t *stacks;
+	size_t stack_stride;
+	size_t stack_size;
+	uint32_t num_workers;
+	int prio;
+	struct k_spinlock lock;
+	sys_slist_t idle;
+	struct k_sem available;
+	/** @endcond */
+};
+
+/**
+ * @brief Statically define a thread pool.
+ *
+ * The pool can be accessed outside the module where it is defined using:
+ *
+ * @code extern struct k_thread_pool <name>; @endcode
+ *
+ * @param name Name of the thread pool.
+ * @param num_threads Number of threads in the pool.
+ * @param size Stack size of each thread, in bytes.
+ */
+#define K_THREAD_POOL_DEFINE(name, num_threads, size)                                              \
+	static K_THREAD_STACK_ARRAY_DEFINE(_k_thread_pool_stacks_##name, num_threads, size);       \
+	static struct k_thread_pool_worker _k_thread_pool_workers_##name[num_threads];             \
+	struct k_thread_pool name = {                                                              \
+		.workers = _k_thread_pool_workers_##name,                                          \
+		.stacks = _k_thread_pool_stacks_##name[0],                                         \
+		.stack_stride = sizeof(_k_thread_pool_stacks_##name[0]),                           \
+		.stack_size = K_THREAD_STACK_SIZEOF(_k_thread_pool_stacks_##name[0]),              \
+		.num_workers = (num_threads),                                                      \
+	}
+
+/**
+ * @brief Start a thread pool.
+ *
+ * This routine creates all the threads of the pool, which then wait to be
+ * handed an entry point by k_thread_pool_spawn(). Stack initialization and
+ * thread object setup are only done here, not on every spawn.
+ *
+ * @param pool Address of the thread pool.
+ * @param prio Priority of the idle pool threads.
+ */
+void k_thread_pool_start(struct k_thread_pool *pool, int prio);
+
+/**
+ * @brief Run an entry point on a thread of a pool.
+ *
+ * This routine hands @a entry to an idle thread of @a pool, waiting for one
+ * to become idle if needed, and makes it ready at priority @a prio. Taking
+ * an idle thread takes constant time.
+ *
+ * Pool threads are supervisor threads. The entry point must return instead
+ * of aborting its thread, and must undo any change it makes to the thread
+ * other than its priority, such as scheduler locks or a thread name. Once it
+ * returns, the thread is set back to the priority given to
+ * k_thread_pool_start() and goes back to the pool after k_thread_pool_join() or
+ * k_thread_pool_detach() is called for it, so k_thread_join() must not be
+ * used with pool threads.
+ *
+ * @param pool Address of the thread pool.
+ * @param entry Thread entry function.
+ * @param p1 1st entry point parameter.
+ * @param p2 2nd entry point parameter.
+ * @param p3 3rd entry point parameter.
+ * @param prio Thread priority.
+ * @param timeout Waiting period for a thread of the pool to become idle,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @return ID of the thread running @a entry, or NULL if no thread of the
+ *         pool became idle in time.
+ */
+k_tid_t k_thread_pool_spawn(struct k_thread_pool *pool, k_thread_entry_t entry,
+			    void *p1, void *p2, void *p3, int prio, k_timeout_t timeout);
+
+/**
+ * @brief Wait for an entry point run on a pool thread to return.
+ *
+ * Once the entry point has returned, the thread goes back to the pool.
+ *
+ * @param pool Address of the thread pool.
+ * @param thread ID returned by k_thread_pool_spawn().
+ * @param timeout Waiting period, or one of the special values K_NO_WAIT
+ *                and K_FOREVER.
+ *
+ * @retval 0 the entry point returned
+ * @retval -EBUSY the entry point is still running and @a timeout is K_NO_WAIT
+ * @retval -EAGAIN waiting period timed out
+ * @retval -EINVAL @a thread is not a thread of @a pool, or is not running an
+ *                 entry point that may be joined: it was already joined or
+ *                 detached, or another thread is joining it
+ */
+int k_thread_pool_join(struct k_thread_pool *pool, k_tid_t thread, k_timeout_t timeout);
+
+/**
+ * @brief Let a pool thread go back to the pool on its own.
+ *
+ * The thread goes back to the pool as soon as its entry point returns, or
+ * right away if it already has. It must not be joined afterwards.
+ *
+ * @param pool Address of the thread pool.
+ * @param thread ID returned by k_thread_pool_spawn().
+ *
+ * @retval 0 on success
+ * @retval -EINVAL @a thread is not a thread of @a pool, or is not running an
+ *                 entry point that may be detached: it was already joined or
+ *                 detached, or another thread is joining it
+ */
+int k_thread_pool_detach(struct k_thread_pool *pool, k_tid_t thread);
+
+/** @} */
+#endif /* CONFIG_THREAD_POOL */
+
 /**
  * @cond INTERNAL_HIDDEN
  */
@@ -3647,6 +3866,40 @@ void k_work_queue_start(struct k_work_q *queue,
  */
 void k_work_queue_run(struct k_work_q *queue, const struct k_work_queue_config *cfg);
 
+/** @brief Add a thread to the threads serving a work queue.
+ *
+ * The new worker pulls items from the same pending list as the thread
+ * that started or runs @p queue, so items submitted to the queue are
+ * processed by as many threads in parallel as the queue has workers.
+ * A given work item still never runs on two workers at once: an item
+ * resubmitted while it runs waits for the running instance to complete,
+ * and k_work_flush(), k_work_cancel_sync() and k_work_queue_drain()
+ * keep their meaning.
+ *
+ * Workers exit together with the queue when k_work_queue_stop() is
+ * invoked, after which the worker storage may be reused.
+ *
+ * @kconfig_dep{CONFIG_WORKQUEUE_WORKERS}
+ *
+ * @param queue pointer to a started work queue.
+ * @param worker pointer to the worker structure, which must remain valid
+ *        until the queue is stopped.
+ * @param stack pointer to the worker thread stack area.
+ * @param stack_size size of the worker thread stack area, in bytes.
+ * @param prio initial thread priority
+ * @param cpu CPU the worker is pinned to, or -1 to let it run anywhere.
+ *
+ * @retval 0 if the worker was added
+ * @retval -ENODEV if the queue is not started, or is being stopped
+ * @retval -ENOTSUP if @p cpu is not -1 and CONFIG_SCHED_CPU_MASK is
+ *         disabled
+ * @retval -EINVAL if @p cpu is not a valid CPU
+ */
+int k_work_queue_add_worker(struct k_work_q *queue,
+			    struct k_work_q_worker *worker,
+			    k_thread_stack_t *stack, size_t stack_size,
+			    int prio, int cpu);
+
 /** @brief Access the thread that animates a work queue.
  *
  * This is necessary to grant a work queue thread access to things the work
@@ -4150,6 +4403,10 @@ struct k_work_delayable {
 struct z_work_flusher {
 	struct k_work work;
 	struct k_sem sem;
+#if defined(CONFIG_WORKQUEUE_WORKERS)
+	/* The item being flushed, which the flusher may not overtake */
+	struct k_work *target;
+#endif /* defined(CONFIG_WORKQUEUE_WORKERS) */
 };
 
 /* Record used to wait for work to complete a cancellation.
@@ -4262,6 +4519,29 @@ struct k_work_q {
 	struct k_work *work;
 	k_timeout_t work_timeout;
 #endif /* defined(CONFIG_WORKQUEUE_WORK_TIMEOUT) */
+
+#if defined(CONFIG_WORKQUEUE_WORKERS)
+	/* Threads added with k_work_queue_add_worker(). */
+	sys_slist_t workers;
+
+	/* Number of threads serving the queue, including thread_id. */
+	uint8_t live;
+
+	/* Number of threads currently running a work item. */
+	uint8_t busy;
+#endif /* defined(CONFIG_WORKQUEUE_WORKERS) */
+};
+
+/** @brief An additional thread serving a work queue.
+ *
+ * @see k_work_queue_add_worker()
+ */
+struct k_work_q_worker {
+	/* The thread that animates the work. */
+	struct k_thread thread;
+
+	/* Node in the list of workers of the queue. */
+	sys_snode_t node;
 };
 
 /* Provide the implementation for inline functions declared above */
@@ -4662,6 +4942,13 @@ struct k_msgq {
 	/** Message queue */
 	uint8_t flags;
 
+#ifdef CONFIG_MSGQ_LOCKFREE
+	/** Ring of a queue defined with K_MSGQ_LOCKFREE_DEFINE() */
+	struct mpmc ring;
+	/** Threads pending or about to pend on the queue, and its pollers */
+	atomic_t waiters;
+#endif
+
 	SYS_PORT_TRACING_TRACKING_FIELD(k_msgq)
 
 #ifdef CONFIG_OBJ_CORE_MSGQ
@@ -4688,12 +4975,30 @@ struct k_msgq {
 	.flags = 0, \
 	}
 
+#define Z_MSGQ_LOCKFREE_INITIALIZER(obj, q_buffer, q_seq, q_msg_size, q_max_msgs) \
+	{ \
+	.wait_q = Z_WAIT_Q_INIT(&obj.wait_q), \
+	.lock = {}, \
+	.msg_size = q_msg_size, \
+	.max_msgs = q_max_msgs, \
+	.buffer_start = q_buffer, \
+	.buffer_end = q_buffer + (q_max_msgs * q_msg_size), \
+	.read_ptr = q_buffer, \
+	.write_ptr = q_buffer, \
+	.used_msgs = 0, \
+	Z_POLL_EVENT_OBJ_INIT(obj) \
+	.flags = K_MSGQ_FLAG_LOCKFREE, \
+	.ring = MPMC_INITIALIZER(q_max_msgs, q_msg_size, q_seq, q_buffer), \
+	.waiters = ATOMIC_INIT(0), \
+	}
+
 /**
  * INTERNAL_HIDDEN @endcond
  */
 
 
 #define K_MSGQ_FLAG_ALLOC	BIT(0)
+#define K_MSGQ_FLAG_LOCKFREE	BIT(1)
 
 /**
  * @brief Message Queue Attributes
@@ -4733,6 +5038,35 @@ struct k_msgq_attrs {
 	       Z_MSGQ_INITIALIZER(q_name, _k_fifo_buf_##q_name,	\
 				  (q_msg_size), (q_max_msgs))
 
+#if defined(CONFIG_MSGQ_LOCKFREE) || defined(__DOXYGEN__)
+/**
+ * @brief Statically define and initialize a lockfree message queue.
+ *
+ * Same as K_MSGQ_DEFINE(), except that messages are kept in a lockfree
+ * @ref mpmc_lockfree "MPMC ring". k_msgq_put() and k_msgq_get() then only
+ * take the queue's lock when they have to wait, or to wake up a waiting
+ * thread or poller.
+ *
+ * k_msgq_put_front(), k_msgq_peek() and k_msgq_peek_at() are not supported
+ * on such a queue and return -ENOTSUP.
+ *
+ * @param q_name Name of the message queue.
+ * @param q_msg_size Message size (in bytes).
+ * @param q_max_msgs Maximum number of messages that can be queued, a power
+ *                   of 2.
+ * @param q_align Alignment of the message queue's ring buffer (power of 2).
+ */
+#define K_MSGQ_LOCKFREE_DEFINE(q_name, q_msg_size, q_max_msgs, q_align)	\
+	BUILD_ASSERT(IS_POWER_OF_TWO(q_max_msgs));			\
+	static char __noinit __aligned(q_align)				\
+		_k_fifo_buf_##q_name[(q_max_msgs) * (q_msg_size)];	\
+	static atomic_t _k_msgq_seq_##q_name[(q_max_msgs)];		\
+	STRUCT_SECTION_ITERABLE(k_msgq, q_name) =			\
+	       Z_MSGQ_LOCKFREE_INITIALIZER(q_name, _k_fifo_buf_##q_name,	\
+					   _k_msgq_seq_##q_name,	\
+					   (q_msg_size), (q_max_msgs))
+#endif /* CONFIG_MSGQ_LOCKFREE */
+
 /**
  * @brief Initialize a message queue.
  *
@@ -4830,6 +5164,7 @@ __syscall int k_msgq_put(struct k_msgq *msgq, const void *data, k_timeout_t time
  * @retval 0 Message sent.
  * @retval -ENOMSG Returned without waiting or queue purged.
  * @retval -EAGAIN Waiting period timed out.
+ * @retval -ENOTSUP The queue was defined with K_MSGQ_LOCKFREE_DEFINE().
  */
 __syscall int k_msgq_put_front(struct k_msgq *msgq, const void *data, k_timeout_t timeout);
 
@@ -4855,6 +5190,65 @@ __syscall int k_msgq_put_front(struct k_msgq *msgq, const void *data, k_timeout_
  */
 __syscall int k_msgq_get(struct k_msgq *msgq, void *data, k_timeout_t timeout);
 
+/**
+ * @brief Send a batch of messages to a message queue.
+ *
+ * This routine sends up to @a num_msgs consecutive messages from @a data,
+ * as many as there is room for, in a single critical section and with a
+ * single reschedule. Messages go to waiting readers first, in order.
+ *
+ * If the queue is full, the calling thread waits for room for the first
+ * message only, and returns once it was sent.
+ *
+ * @note @a timeout must be set to K_NO_WAIT if called from ISR.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param data Address of the first message.
+ * @param num_msgs Number of messages at @a data.
+ * @param timeout Waiting period to add the first message,
+ *                or one of the special values K_NO_WAIT and
+ *                K_FOREVER.
+ *
+ * @return Number of messages sent, at least 1.
+ * @retval -ENOMSG Returned without waiting or queue purged.
+ * @retval -EAGAIN Waiting period timed out.
+ * @retval -EINVAL @a num_msgs is 0.
+ */
+__syscall int k_msgq_put_batch(struct k_msgq *msgq, const void *data, uint32_t num_msgs,
+			       k_timeout_t timeout);
+
+/**
+ * @brief Receive a batch of messages from a message queue.
+ *
+ * This routine receives up to @a num_msgs messages in a "first in, first
+ * out" manner, as many as are available, in a single critical section and
+ * with a single reschedule. Writers waiting for room are served as
+ * messages are taken.
+ *
+ * If the queue is empty, the calling thread waits for the first message
+ * only, and returns once it was received.
+ *
+ * @note @a timeout must be set to K_NO_WAIT if called from ISR.
+ *
+ * @funcprops \isr_ok
+ *
+ * @param msgq Address of the message queue.
+ * @param data Address of area to hold @a num_msgs messages.
+ * @param num_msgs Maximum number of messages to receive.
+ * @param timeout Waiting period to receive the first message,
+ *                or one of the special values K_NO_WAIT and
+ *                K_FOREVER.
+ *
+ * @return Number of messages received, at least 1.
+ * @retval -ENOMSG Returned without waiting or queue purged.
+ * @retval -EAGAIN Waiting period timed out.
+ * @retval -EINVAL @a num_msgs is 0.
+ */
+__syscall int k_msgq_get_batch(struct k_msgq *msgq, void *data, uint32_t num_msgs,
+			       k_timeout_t timeout);
+
 /**
  * @brief Peek/read a message from a message queue.
  *
@@ -4868,6 +5262,7 @@ __syscall int k_msgq_get(struct k_msgq *msgq, void *data, k_timeout_t timeout);
  *
  * @retval 0 Message read.
  * @retval -ENOMSG Returned when the queue has no message.
+ * @retval -ENOTSUP The queue was defined with K_MSGQ_LOCKFREE_DEFINE().
  */
 __syscall int k_msgq_peek(struct k_msgq *msgq, void *data);
 
@@ -4886,6 +5281,7 @@ __syscall int k_msgq_peek(struct k_msgq *msgq, void *data);
  *
  * @retval 0 Message read.
  * @retval -ENOMSG Returned when the queue has no message at index.
+ * @retval -ENOTSUP The queue was defined with K_MSGQ_LOCKFREE_DEFINE().
  */
 __syscall int k_msgq_peek_at(struct k_msgq *msgq, void *data, uint32_t idx);
 
@@ -4926,6 +5322,12 @@ __syscall void  k_msgq_get_attrs(struct k_msgq *msgq,
 
 static inline uint32_t z_impl_k_msgq_num_free_get(struct k_msgq *msgq)
 {
+#ifdef CONFIG_MSGQ_LOCKFREE
+	if ((msgq->flags & K_MSGQ_FLAG_LOCKFREE) != 0U) {
+		return msgq->max_msgs - (uint32_t)mpmc_count(&msgq->ring);
+	}
+#endif
+
 	return msgq->max_msgs - msgq->used_msgs;
 }
 
@@ -4942,6 +5344,12 @@ __syscall uint32_t k_msgq_num_used_get(struct k_msgq *msgq);
 
 static inline uint32_t z_impl_k_msgq_num_used_get(struct k_msgq *msgq)
 {
+#ifdef CONFIG_MSGQ_LOCKFREE
+	if ((msgq->flags & K_MSGQ_FLAG_LOCKFREE) != 0U) {
+		return (uint32_t)mpmc_count(&msgq->ring);
+	}
+#endif
+
 	return msgq->used_msgs;
 }
 
@@ -5323,6 +5731,8 @@ __deprecated __syscall void k_pipe_buffer_flush(struct k_pipe *pipe);
 enum pipe_flags {
 	PIPE_FLAG_OPEN = BIT(0),
 	PIPE_FLAG_RESET = BIT(1),
+	PIPE_FLAG_WRITE_CLAIM = BIT(2),
+	PIPE_FLAG_READ_CLAIM = BIT(3),
 };
 
 struct k_pipe {
@@ -5413,6 +5823,92 @@ __syscall int k_pipe_write(struct k_pipe *pipe, const uint8_t *data, size_t len,
 __syscall int k_pipe_read(struct k_pipe *pipe, uint8_t *data, size_t len,
 			  k_timeout_t timeout);
 
+/**
+ * @brief Claim space in a pipe for writing in place
+ *
+ * This routine hands out a contiguous area of the pipe's ring buffer of up to @a len bytes, so
+ * that data can be produced (e.g. by DMA or a decoder) straight into the pipe storage instead of
+ * being copied in by k_pipe_write(..). If the pipe is full, the routine will block until some
+ * space is available or the timeout expires. The area may be smaller than requested when the
+ * free space is smaller or wraps around the end of the ring buffer.
+ *
+ * The data only becomes readable once k_pipe_write_commit(..) is called. Only one write claim
+ * can be outstanding at a time, and k_pipe_write(..) calls wait for it to be committed.
+ *
+ * @param pipe Address of the pipe.
+ * @param data Address of the pointer set to the claimed area.
+ * @param len Requested number of bytes to claim, must not be zero.
+ * @param timeout Waiting period to wait for space to become available.
+ *
+ * @retval number of bytes claimed on success
+ * @retval -EAGAIN if no space became available before the timeout expired
+ * @retval -EBUSY if another write claim is outstanding
+ * @retval -ECANCELED if the claim was interrupted by k_pipe_reset(..)
+ * @retval -EINVAL if @a len is zero
+ * @retval -EPIPE if the pipe was closed
+ */
+__syscall int k_pipe_write_claim(struct k_pipe *pipe, uint8_t **data, size_t len,
+				 k_timeout_t timeout);
+
+/**
+ * @brief Commit data written in place to a pipe
+ *
+ * This routine makes the first @a len bytes of the area obtained with k_pipe_write_claim(..)
+ * available to readers and releases the claim. Committing zero bytes just releases it.
+ *
+ * A claim is dropped, with its data, when the pipe is reset or closed before it is committed.
+ *
+ * @param pipe Address of the pipe.
+ * @param len Number of bytes written to the claimed area.
+ *
+ * @retval 0 on success
+ * @retval -EINVAL if no write claim is outstanding or @a len exceeds the claimed size
+ */
+__syscall int k_pipe_write_commit(struct k_pipe *pipe, size_t len);
+
+/**
+ * @brief Claim data in a pipe for reading in place
+ *
+ * This routine hands out a contiguous area of up to @a len bytes of the data held in the pipe's
+ * ring buffer, so that it can be consumed (e.g. by DMA or an encoder) straight from the pipe
+ * storage instead of being copied out by k_pipe_read(..). If the pipe is empty, the routine will
+ * block until some data is available or the timeout expires. The area may be smaller than
+ * requested when less data is available or it wraps around the end of the ring buffer.
+ *
+ * The space only becomes writable again once k_pipe_read_commit(..) is called. Only one read
+ * claim can be outstanding at a time, and k_pipe_read(..) calls wait for it to be committed.
+ *
+ * @param pipe Address of the pipe.
+ * @param data Address of the pointer set to the claimed area.
+ * @param len Requested number of bytes to claim, must not be zero.
+ * @param timeout Waiting period to wait for data to become available.
+ *
+ * @retval number of bytes claimed on success
+ * @retval -EAGAIN if no data became available before the timeout expired
+ * @retval -EBUSY if another read claim is outstanding
+ * @retval -ECANCELED if the claim was interrupted by k_pipe_reset(..)
+ * @retval -EINVAL if @a len is zero
+ * @retval -EPIPE if the pipe was closed and is empty
+ */
+__syscall int k_pipe_read_claim(struct k_pipe *pipe, uint8_t **data, size_t len,
+				k_timeout_t timeout);
+
+/**
+ * @brief Commit data read in place from a pipe
+ *
+ * This routine frees the first @a len bytes of the area obtained with k_pipe_read_claim(..) for
+ * writers and releases the claim. The rest of the area is left to be read again.
+ *
+ * A claim is dropped when the pipe is reset before it is committed.
+ *
+ * @param pipe Address of the pipe.
+ * @param len Number of bytes consumed from the claimed area.
+ *
+ * @retval 0 on success
+ * @retval -EINVAL if no read claim is outstanding or @a len exceeds the claimed size
+ */
+__syscall int k_pipe_read_commit(struct k_pipe *pipe, size_t len);
+
 /**
  * @brief Reset a pipe
  * This routine resets the pipe, discarding any unread data and unblocking any threads waiting to
@@ -5448,6 +5944,15 @@ struct k_mem_slab_info {
 #endif
 };
 
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+/* Blocks parked on one CPU, linked through their first word */
+struct k_mem_slab_cpu_cache {
+	struct k_spinlock lock;
+	char *free_list;
+	uint32_t count;
+};
+#endif
+
 struct k_mem_slab {
 	_wait_q_t wait_q;
 	struct k_spinlock lock;
@@ -5460,8 +5965,29 @@ struct k_mem_slab {
 #ifdef CONFIG_OBJ_CORE_MEM_SLAB
 	struct k_obj_core  obj_core;
 #endif
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	/* info.num_used also counts the blocks held in these caches */
+	struct k_mem_slab_cpu_cache cache[CONFIG_MP_MAX_NUM_CPUS];
+	bool cache_bypass;
+#endif
 };
 
+/* Number of free blocks parked in the per-CPU caches of a slab */
+static inline uint32_t z_mem_slab_cached(const struct k_mem_slab *slab)
+{
+	uint32_t cached = 0U;
+
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	for (unsigned int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+		cached += slab->cache[i].count;
+	}
+#else
+	ARG_UNUSED(slab);
+#endif
+
+	return cached;
+}
+
 #define Z_MEM_SLAB_INITIALIZER(_slab, _slab_buffer, _slab_block_size, \
 			       _slab_num_blocks)                      \
 	{                                                             \
@@ -5662,7 +6188,11 @@ void k_mem_slab_free(struct k_mem_slab *slab, void *mem);
  */
 static inline uint32_t k_mem_slab_num_used_get(struct k_mem_slab *slab)
 {
-	return slab->info.num_used;
+	uint32_t used = slab->info.num_used;
+	uint32_t cached = z_mem_slab_cached(slab);
+
+	/* The caches change without the slab lock, so the reads may be torn */
+	return (used > cached) ? (used - cached) : 0U;
 }
 
 /**
@@ -5697,7 +6227,7 @@ static inline uint32_t k_mem_slab_max_used_get(struct k_mem_slab *slab)
  */
 static inline uint32_t k_mem_slab_num_free_get(struct k_mem_slab *slab)
 {
-	return slab->info.num_blocks - slab->info.num_used;
+	return slab->info.num_blocks - k_mem_slab_num_used_get(slab);
 }
 
 /**
@@ -5740,6 +6270,9 @@ struct k_heap {
 	struct sys_heap heap;
 	_wait_q_t wait_q;
 	struct k_spinlock lock;
+#ifdef CONFIG_SYS_HEAP_CPU_CACHE
+	struct sys_heap_cpu_cache cache[CONFIG_MP_MAX_NUM_CPUS];
+#endif
 };
 
 /**
@@ -6103,6 +6636,7 @@ enum _poll_states_bits {
 	       + _POLL_NUM_TYPES \
 	       + _POLL_NUM_STATES \
 	       + 1 /* modes */ \
+	       + 1 /* edge */ \
 	      ))
 
 /* end of polling API - PRIVATE */
@@ -6189,6 +6723,9 @@ struct k_poll_event {
 	/** mode of operation, from enum k_poll_modes */
 	uint32_t mode:1;
 
+	/** PRIVATE - DO NOT TOUCH */
+	uint32_t edge:1;
+
 	/** unused bits in 32-bit word */
 	uint32_t unused:_POLL_EVENT_NUM_UNUSED_BITS;
 
@@ -6352,6 +6889,94 @@ __syscall void k_poll_signal_check(struct k_poll_signal *sig,
 
 __syscall int k_poll_signal_raise(struct k_poll_signal *sig, int result);
 
+/**
+ * @brief Persistent set of poll events.
+ *
+ * Events added to a set stay registered with their objects across
+ * k_poll_set_wait() calls, so waiting costs time proportional to the
+ * number of ready events rather than to the size of the set.
+ */
+struct k_poll_set {
+	/** PRIVATE - DO NOT TOUCH */
+	struct z_poller poller;
+
+	/** PRIVATE - DO NOT TOUCH */
+	_wait_q_t wait_q;
+
+	/** PRIVATE - DO NOT TOUCH: signaled events, not yet reported */
+	sys_dlist_t ready;
+
+	/** PRIVATE - DO NOT TOUCH: events reported by the last wait */
+	sys_dlist_t reported;
+};
+
+/** Report an event only for object changes after it is (re)armed */
+#define K_POLL_SET_EDGE BIT(0)
+
+/**
+ * @brief Initialize a poll set.
+ *
+ * @param set The poll set to initialize.
+ */
+void k_poll_set_init(struct k_poll_set *set);
+
+/**
+ * @brief Add an event to a poll set.
+ *
+ * The event must have been initialized with k_poll_event_init() and must
+ * not be in use by k_poll() or another set. It stays registered with its
+ * object until it is removed with k_poll_set_remove().
+ *
+ * By default the event is level-triggered: it is reported by
+ * k_poll_set_wait() if its condition holds when added, and after being
+ * reported it is reported again by every following wait for as long as
+ * its condition holds. With @ref K_POLL_SET_EDGE, the event is reported
+ * only when its object signals after the event was added or last
+ * reported.
+ *
+ * @param set The poll set.
+ * @param event The event to add.
+ * @param flags 0 or @ref K_POLL_SET_EDGE.
+ *
+ * @retval 0 The event was added.
+ * @retval -EBUSY The event is already registered.
+ */
+int k_poll_set_add(struct k_poll_set *set, struct k_poll_event *event,
+		   uint32_t flags);
+
+/**
+ * @brief Remove an event from a poll set.
+ *
+ * @param set The poll set.
+ * @param event The event to remove.
+ *
+ * @retval 0 The event was removed.
+ * @retval -EINVAL The event is not in @p set.
+ */
+int k_poll_set_remove(struct k_poll_set *set, struct k_poll_event *event);
+
+/**
+ * @brief Wait for events of a poll set to become ready.
+ *
+ * Returns pointers to the ready events, whose state field tells what
+ * happened. The state of a reported event stays valid until the next
+ * call to k_poll_set_wait() on the same set, which re-arms it.
+ *
+ * The set API is not available to user mode threads.
+ *
+ * @param set The poll set.
+ * @param events Array receiving pointers to the ready events.
+ * @param max_events Capacity of @p events; further ready events are
+ *                   returned by the next call.
+ * @param timeout Waiting period for an event to be ready,
+ *                or one of the special values K_NO_WAIT and K_FOREVER.
+ *
+ * @return Number of events stored in @p events, which is at least 1.
+ * @retval -EAGAIN Waiting period timed out.
+ */
+int k_poll_set_wait(struct k_poll_set *set, struct k_poll_event **events,
+		    int max_events, k_timeout_t timeout);
+
 /** @} */
 
 /**
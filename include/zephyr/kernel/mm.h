@@ -77,6 +77,14 @@
 /** Region will be mapped to 1:1 virtual and physical address */
 #define K_MEM_DIRECT_MAP	BIT(6)
 
+/**
+ * Region may be mapped with large pages (such as 2 MiB pages or 1 MiB
+ * sections) where the architecture supports them. Only meaningful for
+ * physically contiguous mappings like k_mem_map_phys_bare(); parts of the
+ * region not aligned to a large page are mapped with regular pages.
+ */
+#define K_MEM_LARGE_PAGES	BIT(7)
+
 /** @} */
 
 #ifndef _ASMLANGUAGE
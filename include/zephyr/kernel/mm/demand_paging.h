@@ -59,6 +59,19 @@ struct k_mem_paging_stats_t {
 		/** Number of dirty pages selected for eviction */
 		unsigned long			dirty;
 	} eviction;
+
+#if defined(CONFIG_DEMAND_PAGING_READAHEAD) || defined(__DOXYGEN__)
+	struct {
+		/** Number of pages read ahead of page faults */
+		unsigned long			pages;
+
+		/**
+		 * Number of pages read ahead that the faulting stream went
+		 * past without faulting on them
+		 */
+		unsigned long			hits;
+	} readahead;
+#endif /* CONFIG_DEMAND_PAGING_READAHEAD */
 #endif /* CONFIG_DEMAND_PAGING_STATS */
 };
 
@@ -282,6 +295,39 @@ static inline void k_mem_paging_eviction_accessed(uintptr_t phys)
 
 #endif /* CONFIG_EVICTION_TRACKING || __DOXYGEN__ */
 
+/**
+ * Forget the eviction state of a page frame
+ *
+ * The kernel will invoke this when the data page held by the provided page
+ * frame is unmapped or paged out, so that the next data page using the page
+ * frame does not inherit any state the eviction algorithm kept for it.
+ * Algorithms keeping no per page frame state implement it as a no-op.
+ *
+ * This function is invoked with interrupts locked.
+ *
+ * @param [in] pf The page frame losing its data page
+ */
+void k_mem_paging_eviction_reset(struct k_mem_page_frame *pf);
+
+/**
+ * Tell which page frame would be selected for eviction
+ *
+ * The kernel will invoke this before a speculative eviction, such as a
+ * page read ahead, which it may give up depending on the page frame that
+ * would be evicted. It must not change any state of the eviction algorithm
+ * nor any page table: the next call to k_mem_paging_eviction_select() is
+ * then expected to return the same page frame.
+ *
+ * Algorithms that cannot tell without changing their state return NULL,
+ * and the speculative eviction is not done.
+ *
+ * This function is invoked with interrupts locked.
+ *
+ * @param [out] dirty Whether the page to evict is dirty
+ * @return The page frame k_mem_paging_eviction_select() would return, or NULL
+ */
+struct k_mem_page_frame *k_mem_paging_eviction_peek(bool *dirty);
+
 /**
  * Select a page frame for eviction
  *
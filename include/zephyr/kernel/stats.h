@@ -27,6 +27,19 @@ struct k_cycle_stats {
 	uint32_t  num_windows;  /**< \# of usage windows */
 	/** @} */
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
+#if defined(CONFIG_SCHED_THREAD_LATENCY_STATS) || defined(__DOXYGEN__)
+	/**
+	 * @name Fields available when CONFIG_SCHED_THREAD_LATENCY_STATS is selected.
+	 * @{
+	 */
+	uint32_t  ready_stamp;  /**< cycle count when made ready, 0 if not waiting */
+	bool      preempted;    /**< true if the wait started with a preemption */
+	/** log2 histogram of waits following a wakeup */
+	uint32_t  wakeup_latency[CONFIG_SCHED_THREAD_LATENCY_STATS_BUCKETS];
+	/** log2 histogram of waits following a preemption */
+	uint32_t  preempt_latency[CONFIG_SCHED_THREAD_LATENCY_STATS_BUCKETS];
+	/** @} */
+#endif /* CONFIG_SCHED_THREAD_LATENCY_STATS */
 	bool      track_usage;  /**< true if gathering usage stats */
 };
 
@@ -116,6 +116,11 @@ struct _thread_base {
 	/* CPU index on which thread was last run */
 	uint8_t cpu;
 
+#ifdef CONFIG_SCHED_CPU_RUNQ
+	/* CPU whose ready queue holds the thread while it is queued */
+	uint8_t runq_cpu;
+#endif /* CONFIG_SCHED_CPU_RUNQ */
+
 	/* Recursive count of irq_lock() calls */
 	uint8_t global_lock_count;
 
@@ -240,6 +245,19 @@ typedef struct k_thread_runtime_stats {
 	uint64_t idle_cycles;
 #endif /* CONFIG_SCHED_THREAD_USAGE_ALL */
 
+#ifdef CONFIG_SCHED_THREAD_LATENCY_STATS
+	/*
+	 * Histograms of the cycles spent ready but not running, once after
+	 * being woken up and once after being preempted. Entry 0 counts
+	 * waits of 0 cycles, entry N waits of [2^(N-1), 2^N) cycles and the
+	 * last entry also all longer waits. For CPUs, these cover all the
+	 * threads that were switched in on that CPU.
+	 */
+
+	uint32_t wakeup_latency[CONFIG_SCHED_THREAD_LATENCY_STATS_BUCKETS];
+	uint32_t preempt_latency[CONFIG_SCHED_THREAD_LATENCY_STATS_BUCKETS];
+#endif /* CONFIG_SCHED_THREAD_LATENCY_STATS */
+
 #if defined(__cplusplus) && !defined(CONFIG_SCHED_THREAD_USAGE) &&                                 \
 	!defined(CONFIG_SCHED_THREAD_USAGE_ANALYSIS) && !defined(CONFIG_SCHED_THREAD_USAGE_ALL)
 	/* If none of the above Kconfig values are defined, this struct will have a size 0 in C
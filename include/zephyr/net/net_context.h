@@ -1310,6 +1310,36 @@ int net_context_sendmsg(struct net_context *context,
 			k_timeout_t timeout,
 			void *user_data);
 
+/**
+ * @brief Send a chain of network buffers without copying it.
+ *
+ * @details The buffers are linked after the protocol headers of the
+ * packet instead of being copied into it. The network stack takes its
+ * own reference to the chain, the caller keeps the one it had and must
+ * release it with net_buf_unref() when it does not need the buffers any
+ * more. The data must not be modified once this function is called, as
+ * the driver may still be reading it after the function returns.
+ * Only UDP contexts that are not offloaded support this, for a connected
+ * context @p dst_addr can be NULL.
+ *
+ * @param context The network context to use.
+ * @param frags The data to send
+ * @param dst_addr Destination address, or NULL to use the connected peer.
+ * @param addrlen Length of the address.
+ * @param cb Caller-supplied callback function.
+ * @param timeout Timeout for the send attempt.
+ * @param user_data Caller-supplied user data.
+ *
+ * @return numbers of bytes sent on success, a negative errno otherwise
+ */
+int net_context_send_buf(struct net_context *context,
+			 struct net_buf *frags,
+			 const struct sockaddr *dst_addr,
+			 socklen_t addrlen,
+			 net_context_send_cb_t cb,
+			 k_timeout_t timeout,
+			 void *user_data);
+
 /**
  * @brief Receive network data from a peer specified by context.
  *
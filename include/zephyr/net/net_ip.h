@@ -264,6 +264,12 @@ struct msghdr {
 	int           msg_flags;      /**< Flags on received message */
 };
 
+/** Message of a multiple message call, see zsock_recvmmsg() and zsock_sendmmsg() */
+struct mmsghdr {
+	struct msghdr msg_hdr;        /**< Message header */
+	unsigned int  msg_len;        /**< Number of bytes received or sent */
+};
+
 /** Control message ancillary data */
 struct cmsghdr {
 	socklen_t cmsg_len;    /**< Number of bytes, including header */
@@ -77,6 +77,8 @@ extern "C" {
 #define ZSOCK_MSG_DONTWAIT 0x40
 /** zsock_recv: block until the full amount of data can be returned */
 #define ZSOCK_MSG_WAITALL 0x100
+/** zsock_recvmmsg: only block until the first message is received */
+#define ZSOCK_MSG_WAITFORONE 0x10000
 /** @} */
 
 /**
@@ -537,6 +539,40 @@ __syscall ssize_t zsock_recvfrom(int sock, void *buf, size_t max_len,
  */
 __syscall ssize_t zsock_recvmsg(int sock, struct msghdr *msg, int flags);
 
+/**
+ * @brief Receive multiple messages from a socket
+ *
+ * @details
+ * Receive up to @p vlen messages with a single call, as with successive
+ * zsock_recvmsg() calls. The number of bytes of each received message is
+ * stored in its @c msg_len field. Control messages are supported the same
+ * way as with zsock_recvmsg().
+ * With @ref ZSOCK_MSG_WAITFORONE, only the first message is waited for.
+ * If @p timeout is not NULL, no more messages are received once it has
+ * expired, it does not cut a blocking wait short.
+ * This function is also exposed as `recvmmsg()`
+ * if @kconfig{CONFIG_POSIX_API} is defined.
+ *
+ * @return Number of messages received, or -1 with errno set if none was.
+ */
+__syscall int zsock_recvmmsg(int sock, struct mmsghdr *msgvec, unsigned int vlen,
+			     int flags, struct timespec *timeout);
+
+/**
+ * @brief Send multiple messages on a socket
+ *
+ * @details
+ * Send up to @p vlen messages with a single call, as with successive
+ * zsock_sendmsg() calls. The number of bytes sent of each message is stored
+ * in its @c msg_len field.
+ * This function is also exposed as `sendmmsg()`
+ * if @kconfig{CONFIG_POSIX_API} is defined.
+ *
+ * @return Number of messages sent, or -1 with errno set if none was.
+ */
+__syscall int zsock_sendmmsg(int sock, struct mmsghdr *msgvec, unsigned int vlen,
+			     int flags);
+
 /**
  * @brief Receive data from a connected peer
  *
@@ -553,6 +589,68 @@ static inline ssize_t zsock_recv(int sock, void *buf, size_t max_len,
 	return zsock_recvfrom(sock, buf, max_len, flags, NULL, NULL);
 }
 
+struct net_buf;
+
+/**
+ * @brief Receive data without copying it
+ *
+ * @details
+ * Instead of copying the received data into a caller buffer, lend the
+ * network buffers holding it to the caller. For a datagram socket this is
+ * the next datagram, for a stream socket all the data of the next received
+ * segment. The returned buffer chain is read only and stays valid until it
+ * is released with zsock_loan_release(). Loaned buffers are not available
+ * for receiving more data, so they should be released promptly.
+ * Only @ref ZSOCK_MSG_DONTWAIT is supported in @p flags.
+ * As the buffers live in kernel memory, this function fails with EPERM
+ * when called from a user mode thread.
+ * Available with @kconfig{CONFIG_NET_SOCKETS_ZEROCOPY}.
+ *
+ * @param sock Socket to receive from
+ * @param frags Set to the chain of buffers holding the data, or NULL if
+ *        there is none
+ * @param flags Receive flags
+ * @param src_addr Source address of the data, can be NULL
+ * @param addrlen Length of @p src_addr, updated with the actual length
+ *
+ * @return Number of bytes in @p frags, 0 at the end of a stream, or -1
+ *         with errno set.
+ */
+ssize_t zsock_recv_loan(int sock, struct net_buf **frags, int flags,
+			struct sockaddr *src_addr, socklen_t *addrlen);
+
+/**
+ * @brief Release buffers obtained with zsock_recv_loan()
+ *
+ * @param frags Buffer chain to release
+ */
+void zsock_loan_release(struct net_buf *frags);
+
+/**
+ * @brief Send a chain of network buffers without copying it
+ *
+ * @details
+ * Send the data of @p frags as one datagram, the buffers are linked into
+ * the packet instead of being copied. The network stack takes its own
+ * reference to the chain and the caller must still release its own one
+ * with net_buf_unref(), which can be done right after this call returns.
+ * The data must not be modified afterwards. Buffers obtained with
+ * zsock_recv_loan() can be sent back this way. Only UDP sockets support
+ * it. As the buffers live in kernel memory, this function fails with EPERM
+ * when called from a user mode thread.
+ * Available with @kconfig{CONFIG_NET_SOCKETS_ZEROCOPY}.
+ *
+ * @param sock Socket to send to
+ * @param frags Chain of buffers holding the data
+ * @param flags Send flags
+ * @param dest_addr Destination address, or NULL for a connected socket
+ * @param addrlen Length of @p dest_addr
+ *
+ * @return Number of bytes sent, or -1 with errno set.
+ */
+ssize_t zsock_send_loan(int sock, struct net_buf *frags, int flags,
+			const struct sockaddr *dest_addr, socklen_t addrlen);
+
 /**
  * @brief Control blocking/non-blocking mode of a socket
  *
@@ -959,6 +1057,8 @@ struct ifreq {
 #define TCP_KEEPINTVL 3
 /** Number of keepalives before dropping connection */
 #define TCP_KEEPCNT 4
+/** Congestion control algorithm of the connection, by name (e.g. "cubic") */
+#define TCP_CONGESTION 5
 
 /** @} */
 
@@ -1239,6 +1339,10 @@ struct socket_op_vtable {
 			   socklen_t *addrlen);
 	int (*getsockname)(void *obj, struct sockaddr *addr,
 			   socklen_t *addrlen);
+	ssize_t (*recv_loan)(void *obj, struct net_buf **frags, int flags,
+			     struct sockaddr *src_addr, socklen_t *addrlen);
+	ssize_t (*send_loan)(void *obj, struct net_buf *frags, int flags,
+			     const struct sockaddr *dest_addr, socklen_t addrlen);
 };
 
 /** @endcond */
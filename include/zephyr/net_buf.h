@@ -1069,6 +1069,14 @@ struct net_buf_data_alloc {
 	size_t alignment;
 };
 
+#if defined(CONFIG_NET_BUF_POOL_CPU_CACHE_SIZE) && (CONFIG_NET_BUF_POOL_CPU_CACHE_SIZE > 0)
+struct net_buf_pool_cpu_cache {
+	struct k_spinlock lock;
+	uint8_t count;
+	struct net_buf *bufs[CONFIG_NET_BUF_POOL_CPU_CACHE_SIZE];
+};
+#endif
+
 /** @endcond */
 
 /**
@@ -1106,6 +1114,16 @@ struct net_buf_pool {
 	const char *name;
 #endif /* CONFIG_NET_BUF_POOL_USAGE */
 
+#if defined(CONFIG_NET_BUF_POOL_CPU_CACHE_SIZE) && (CONFIG_NET_BUF_POOL_CPU_CACHE_SIZE > 0)
+	/** @cond INTERNAL_HIDDEN */
+	/* Buffers freed on each CPU, reused first by allocations on that CPU */
+	struct net_buf_pool_cpu_cache cpu_cache[CONFIG_MP_MAX_NUM_CPUS];
+
+	/* Number of threads about to wait for a buffer in the free LIFO */
+	atomic_t cache_waiters;
+	/** @endcond */
+#endif
+
 	/** Optional destroy callback when buffer is freed. */
 	void (*const destroy)(struct net_buf *buf);
 
@@ -1436,6 +1454,36 @@ struct net_buf * __must_check net_buf_alloc_len(struct net_buf_pool *pool,
 						k_timeout_t timeout);
 #endif
 
+/**
+ * @brief Allocate several buffers from a pool, with the given data size.
+ *
+ * Equivalent to calling net_buf_alloc_len() @a count times, with fewer
+ * pool locking operations. Allocation stops at the first buffer that
+ * cannot be obtained before @a timeout expires, the timeout being shared
+ * by all the buffers.
+ *
+ * @param pool Which pool to allocate the buffers from.
+ * @param size Amount of data each buffer must be able to fit.
+ * @param bufs Array to store the allocated buffers in.
+ * @param count Number of buffers to allocate.
+ * @param timeout Affects the action taken should the pool be empty, as
+ *        for net_buf_alloc_len().
+ *
+ * @return Number of buffers allocated, stored at the start of @a bufs.
+ */
+#if defined(CONFIG_NET_BUF_LOG)
+size_t __must_check net_buf_alloc_batch_debug(struct net_buf_pool *pool, size_t size,
+					      struct net_buf **bufs, size_t count,
+					      k_timeout_t timeout, const char *func, int line);
+#define net_buf_alloc_batch(_pool, _size, _bufs, _count, _timeout)		\
+	net_buf_alloc_batch_debug(_pool, _size, _bufs, _count, _timeout,	\
+				  __func__, __LINE__)
+#else
+size_t __must_check net_buf_alloc_batch(struct net_buf_pool *pool, size_t size,
+					struct net_buf **bufs, size_t count,
+					k_timeout_t timeout);
+#endif
+
 /**
  * @brief Allocate a new buffer from a pool but with external data pointer.
  *
@@ -1469,6 +1517,14 @@ struct net_buf * __must_check net_buf_alloc_with_data(struct net_buf_pool *pool,
 						      k_timeout_t timeout);
 #endif
 
+/** @cond INTERNAL_HIDDEN */
+
+/* Return a list of buffers, linked through their node, to their pool */
+void z_net_buf_pool_put_list(struct net_buf_pool *pool, struct net_buf *head,
+			     struct net_buf *tail);
+
+/** @endcond */
+
 /**
  * @brief Destroy buffer from custom destroy callback
  *
@@ -1489,7 +1545,12 @@ static inline void net_buf_destroy(struct net_buf *buf)
 		buf->__buf = NULL;
 	}
 
+#if defined(CONFIG_NET_BUF_POOL_CPU_CACHE_SIZE) && (CONFIG_NET_BUF_POOL_CPU_CACHE_SIZE > 0)
+	buf->node.next = NULL;
+	z_net_buf_pool_put_list(pool, buf, buf);
+#else
 	k_lifo_put(&pool->free, buf);
+#endif
 }
 
 /**
@@ -1543,6 +1604,24 @@ void net_buf_unref_debug(struct net_buf *buf, const char *func, int line);
 void net_buf_unref(struct net_buf *buf);
 #endif
 
+/**
+ * @brief Decrements the reference count of several buffers.
+ *
+ * Equivalent to calling net_buf_unref() on each buffer, but buffers going
+ * back to the same pool are returned to it together.
+ *
+ * @param bufs Array of valid pointers on buffers
+ * @param count Number of buffers in @a bufs
+ */
+#if defined(CONFIG_NET_BUF_LOG)
+void net_buf_unref_batch_debug(struct net_buf **bufs, size_t count, const char *func,
+			       int line);
+#define	net_buf_unref_batch(_bufs, _count) \
+	net_buf_unref_batch_debug(_bufs, _count, __func__, __LINE__)
+#else
+void net_buf_unref_batch(struct net_buf **bufs, size_t count);
+#endif
+
 /**
  * @brief Increment the reference count of a buffer.
  *
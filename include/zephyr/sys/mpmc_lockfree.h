@@ -0,0 +1,257 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#ifndef ZEPHYR_SYS_MPMC_LOCKFREE_H_
+#define ZEPHYR_SYS_MPMC_LOCKFREE_H_
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <zephyr/toolchain/common.h>
+#include <zephyr/sys/__assert.h>
+#include <zephyr/sys/atomic.h>
+#include <zephyr/sys/util.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Multiple Producer Multiple Consumer (MPMC) Lockfree Queue API
+ * @defgroup mpmc_lockfree MPMC Lockfree Queue API
+ * @ingroup datastructure_apis
+ * @{
+ */
+
+/**
+ * @file mpmc_lockfree.h
+ *
+ * @brief A bounded, power of 2 sized, multi producer multi consumer (MPMC)
+ * queue of fixed size elements. Ordering is First-In-First-Out.
+ *
+ * Based on the bounded MPMC queue described by Dmitry Vyukov. Every slot of
+ * the ring has a sequence number, telling whether the slot is ready to be
+ * produced or consumed for a given position. Producers and consumers claim a
+ * position with a single compare-and-swap on their own index, copy the
+ * element and publish the slot by updating its sequence number. No lock is
+ * taken, and producers do not contend with consumers.
+ *
+ * Push and pop never wait for another execution context. A producer or
+ * consumer preempted between claiming a slot and publishing it makes that
+ * slot look full or empty until it resumes, so push or pop may then fail
+ * even though other slots are available. An MPMC queue is therefore safe to
+ * produce and consume from any number of threads and ISRs.
+ *
+ * Sequence numbers are stored relative to the index of their slot so that
+ * a zeroed queue is a valid empty queue.
+ */
+
+/**
+ * @private
+ * @brief MPMC queue
+ *
+ * @warning Not to be manipulated without the functions and macros!
+ */
+struct mpmc {
+	/* next position to produce */
+	atomic_t head;
+
+	/* next position to consume */
+	atomic_t tail;
+
+	/* sequence number of each slot, minus the index of the slot */
+	atomic_t *seq;
+
+	/* slot storage */
+	uint8_t *buffer;
+
+	/* size of an element, in bytes */
+	size_t elem_size;
+
+	/* mask used to automatically wrap positions */
+	unsigned long mask;
+};
+
+/**
+ * @brief Statically initialize an MPMC queue
+ *
+ * @param sz Number of elements, must be power of 2 (ex: 2, 4, 8)
+ * @param esz Size of an element, in bytes
+ * @param seq_buf Array of @p sz atomic_t
+ * @param buf Buffer of @p sz elements
+ */
+#define MPMC_INITIALIZER(sz, esz, seq_buf, buf)                                                    \
+	{                                                                                          \
+		.head = ATOMIC_INIT(0),                                                            \
+		.tail = ATOMIC_INIT(0),                                                            \
+		.seq = seq_buf,                                                                    \
+		.buffer = (uint8_t *)(buf),                                                        \
+		.elem_size = esz,                                                                  \
+		.mask = (sz) - 1,                                                                  \
+	}
+
+/**
+ * @brief Define an MPMC queue with a fixed size
+ *
+ * @param name Name of the MPMC queue symbol to be provided
+ * @param type Type stored in the MPMC queue
+ * @param sz Number of elements, must be power of 2 (ex: 2, 4, 8)
+ */
+#define MPMC_DEFINE(name, type, sz)                                                                \
+	BUILD_ASSERT(IS_POWER_OF_TWO(sz));                                                         \
+	static type __mpmc_buf_##name[sz];                                                         \
+	static atomic_t __mpmc_seq_##name[sz];                                                     \
+	struct mpmc name = MPMC_INITIALIZER(sz, sizeof(type), __mpmc_seq_##name, __mpmc_buf_##name)
+
+/**
+ * @brief Number of elements an MPMC queue can hold
+ *
+ * @param q MPMC queue
+ */
+#define mpmc_size(q) ((q)->mask + 1)
+
+/**
+ * @brief Initialize/reset an MPMC queue such that it is empty
+ *
+ * Note that this is not safe to do while the queue is being used.
+ *
+ * @param q MPMC queue to initialize/reset
+ * @param seq Array of @p sz atomic_t
+ * @param buf Buffer of @p sz elements
+ * @param elem_size Size of an element, in bytes
+ * @param sz Number of elements, must be a power of 2
+ */
+static inline void mpmc_init(struct mpmc *q, atomic_t *seq, void *buf, size_t elem_size,
+			     unsigned long sz)
+{
+	__ASSERT_NO_MSG(IS_POWER_OF_TWO(sz));
+
+	atomic_set(&q->head, 0);
+	atomic_set(&q->tail, 0);
+	q->seq = seq;
+	q->buffer = (uint8_t *)buf;
+	q->elem_size = elem_size;
+	q->mask = sz - 1;
+
+	for (unsigned long i = 0; i < sz; i++) {
+		atomic_set(&seq[i], 0);
+	}
+}
+
+/**
+ * @private
+ * @brief Claim the slot of the next position of @p pos, which is ready when
+ * its sequence number is @p pos plus @p ready
+ *
+ * @return Index of the claimed slot, or -1 if the queue is full (or empty)
+ */
+static inline long z_mpmc_claim(struct mpmc *q, atomic_t *pos, unsigned long ready)
+{
+	unsigned long p = (unsigned long)atomic_get(pos);
+	unsigned long idx;
+	long diff;
+
+	for (;;) {
+		idx = p & q->mask;
+		diff = (long)((unsigned long)atomic_get(&q->seq[idx]) + idx - (p + ready));
+
+		if (diff == 0) {
+			if (atomic_cas(pos, (atomic_val_t)p, (atomic_val_t)(p + 1))) {
+				return (long)idx;
+			}
+			p = (unsigned long)atomic_get(pos);
+		} else if (diff < 0) {
+			return -1;
+		} else {
+			/* another context claimed and published the slot meanwhile */
+			p = (unsigned long)atomic_get(pos);
+		}
+	}
+}
+
+/**
+ * @brief Push an element to an MPMC queue
+ *
+ * @param q MPMC queue to push to
+ * @param elem Element to copy into the queue
+ *
+ * @retval true if the element was pushed
+ * @retval false if the queue was full
+ */
+static inline bool mpmc_push(struct mpmc *q, const void *elem)
+{
+	long idx = z_mpmc_claim(q, &q->head, 0);
+	unsigned long seq;
+
+	if (idx < 0) {
+		return false;
+	}
+
+	seq = (unsigned long)atomic_get(&q->seq[idx]);
+	(void)memcpy(&q->buffer[idx * q->elem_size], elem, q->elem_size);
+
+	/* position + 1: ready to consume */
+	atomic_set(&q->seq[idx], (atomic_val_t)(seq + 1));
+
+	return true;
+}
+
+/**
+ * @brief Pop an element from an MPMC queue
+ *
+ * @param q MPMC queue to pop from
+ * @param elem Location to copy the element to, or NULL to drop it
+ *
+ * @retval true if an element was popped
+ * @retval false if the queue was empty
+ */
+static inline bool mpmc_pop(struct mpmc *q, void *elem)
+{
+	long idx = z_mpmc_claim(q, &q->tail, 1);
+	unsigned long seq;
+
+	if (idx < 0) {
+		return false;
+	}
+
+	seq = (unsigned long)atomic_get(&q->seq[idx]);
+	if (elem != NULL) {
+		(void)memcpy(elem, &q->buffer[idx * q->elem_size], q->elem_size);
+	}
+
+	/* position + size: ready to produce on the next lap */
+	atomic_set(&q->seq[idx], (atomic_val_t)(seq + q->mask));
+
+	return true;
+}
+
+/**
+ * @brief Approximate number of elements in an MPMC queue
+ *
+ * The result is only a snapshot when other contexts use the queue. It never
+ * exceeds mpmc_size(), even if elements were consumed and produced again
+ * between the reads of both positions.
+ *
+ * @param q MPMC queue
+ */
+static inline unsigned long mpmc_count(struct mpmc *q)
+{
+	unsigned long tail = (unsigned long)atomic_get(&q->tail);
+	unsigned long head = (unsigned long)atomic_get(&q->head);
+
+	/* The head is read last, it can only be ahead of the tail */
+	return MIN(head - tail, mpmc_size(q));
+}
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ZEPHYR_SYS_MPMC_LOCKFREE_H_ */
@@ -11,9 +11,9 @@
  * sys_mutex behaves almost exactly like k_mutex, with the added advantage
  * that a sys_mutex instance can reside in user memory.
  *
- * Further enhancements will support locking/unlocking uncontended sys_mutexes
- * with simple atomic ops instead of syscalls, similar to Linux's
- * FUTEX_LOCK_PI and FUTEX_UNLOCK_PI
+ * With CONFIG_SYS_MUTEX_FUTEX, uncontended sys_mutexes are locked and
+ * unlocked with simple atomic ops instead of syscalls, similar to Linux's
+ * futex based mutexes, at the cost of priority inheritance.
  */
 
 #ifdef __cplusplus
@@ -26,11 +26,15 @@ extern "C" {
 #include <zephyr/sys_clock.h>
 
 struct sys_mutex {
-	/* Currently unused, but will be used to store state for fast mutexes
-	 * that can be locked/unlocked with atomic ops if there is no
-	 * contention
+	/* With CONFIG_SYS_MUTEX_FUTEX, owner thread and contended flag of a
+	 * mutex that is locked/unlocked with atomic ops if there is no
+	 * contention. Unused otherwise.
 	 */
 	atomic_t val;
+#ifdef CONFIG_SYS_MUTEX_FUTEX
+	/* Recursive lock count, only accessed by the owner */
+	uint32_t lock_count;
+#endif
 };
 
 /**
@@ -67,9 +71,14 @@ struct sys_mutex {
  */
 static inline void sys_mutex_init(struct sys_mutex *mutex)
 {
+#ifdef CONFIG_SYS_MUTEX_FUTEX
+	atomic_clear(&mutex->val);
+	mutex->lock_count = 0U;
+#else
 	ARG_UNUSED(mutex);
+#endif
 
-	/* Nothing to do, kernel-side data structures are initialized at
+	/* Nothing else to do, kernel-side data structures are initialized at
 	 * boot
 	 */
 }
@@ -79,6 +88,16 @@ __syscall int z_sys_mutex_kernel_lock(struct sys_mutex *mutex,
 
 __syscall int z_sys_mutex_kernel_unlock(struct sys_mutex *mutex);
 
+__syscall int z_sys_mutex_kernel_wait(struct sys_mutex *mutex,
+				      atomic_val_t expected,
+				      k_timeout_t timeout);
+
+__syscall int z_sys_mutex_kernel_wake(struct sys_mutex *mutex);
+
+int z_sys_mutex_futex_lock(struct sys_mutex *mutex, k_timeout_t timeout);
+
+int z_sys_mutex_futex_unlock(struct sys_mutex *mutex);
+
 /**
  * @brief Lock a mutex.
  *
@@ -101,8 +120,11 @@ __syscall int z_sys_mutex_kernel_unlock(struct sys_mutex *mutex);
  */
 static inline int sys_mutex_lock(struct sys_mutex *mutex, k_timeout_t timeout)
 {
-	/* For now, make the syscall unconditionally */
+#ifdef CONFIG_SYS_MUTEX_FUTEX
+	return z_sys_mutex_futex_lock(mutex, timeout);
+#else
 	return z_sys_mutex_kernel_lock(mutex, timeout);
+#endif
 }
 
 /**
@@ -124,8 +146,11 @@ static inline int sys_mutex_lock(struct sys_mutex *mutex, k_timeout_t timeout)
  */
 static inline int sys_mutex_unlock(struct sys_mutex *mutex)
 {
-	/* For now, make the syscall unconditionally */
+#ifdef CONFIG_SYS_MUTEX_FUTEX
+	return z_sys_mutex_futex_unlock(mutex);
+#else
 	return z_sys_mutex_kernel_unlock(mutex);
+#endif
 }
 
 #include <zephyr/syscalls/mutex.h>
@@ -54,10 +54,24 @@ extern "C" {
  * put the two values somewhere else, though it would make
  * SYS_HEAP_DEFINE a little hairy to write.
  */
+#ifdef CONFIG_SYS_HEAP_CPU_CACHE
+/* One CPU's magazines of cached free blocks, indexed by chunk size - 1 */
+struct sys_heap_cpu_cache {
+	void *blocks[CONFIG_SYS_HEAP_CPU_CACHE_CLASSES][CONFIG_SYS_HEAP_CPU_CACHE_DEPTH];
+	uint8_t count[CONFIG_SYS_HEAP_CPU_CACHE_CLASSES];
+	uint32_t hits;
+	uint32_t misses;
+};
+#endif
+
 struct sys_heap {
 	struct z_heap *heap;
 	void *init_mem;
 	size_t init_bytes;
+#ifdef CONFIG_SYS_HEAP_CPU_CACHE
+	/* CONFIG_MP_MAX_NUM_CPUS entries, or NULL if not cached */
+	struct sys_heap_cpu_cache *cache;
+#endif
 };
 
 struct z_heap_stress_result {
@@ -104,6 +118,72 @@ int sys_heap_runtime_stats_reset_max(struct sys_heap *heap);
  */
 void sys_heap_init(struct sys_heap *heap, void *mem, size_t bytes);
 
+#if defined(CONFIG_SYS_HEAP_CPU_CACHE) || defined(__DOXYGEN__)
+/** @brief Attach per-CPU block caches to a sys_heap
+ *
+ * Once attached, sys_heap_cache_alloc() and sys_heap_cache_free() can
+ * serve small blocks for a CPU out of its own magazines.  Blocks held
+ * in a magazine count as allocated to the underlying heap.
+ *
+ * @param heap Initialized heap
+ * @param cache Array of CONFIG_MP_MAX_NUM_CPUS cache records, or NULL
+ *              to detach
+ */
+void sys_heap_cache_init(struct sys_heap *heap, struct sys_heap_cpu_cache *cache);
+
+/** @brief Allocate a block from a CPU's cache
+ *
+ * Does not touch the heap itself, so it only needs to be protected
+ * against concurrent use of the same CPU's cache (typically by masking
+ * local interrupts), not by the heap lock.
+ *
+ * @param heap Heap with attached caches
+ * @param cpu Index of the calling CPU
+ * @param bytes Number of bytes requested
+ * @return Cached block, or NULL if none of the right size is available
+ */
+void *sys_heap_cache_alloc(struct sys_heap *heap, unsigned int cpu, size_t bytes);
+
+/** @brief Return a block to a CPU's cache
+ *
+ * Same locking requirements as sys_heap_cache_alloc().
+ *
+ * @param heap Heap with attached caches
+ * @param cpu Index of the calling CPU
+ * @param mem Block previously allocated from @a heap
+ * @return true if the block was cached, false if it must be freed
+ *         with sys_heap_free() instead
+ */
+bool sys_heap_cache_free(struct sys_heap *heap, unsigned int cpu, void *mem);
+
+/** @brief Allocate a block and refill the matching cache
+ *
+ * Behaves like sys_heap_alloc() but, when the request falls into a
+ * cached size, also moves up to half a magazine of extra blocks of
+ * that size into @a cpu's cache.  Requires the same locking as
+ * sys_heap_alloc() in addition to that of sys_heap_cache_alloc().
+ *
+ * @param heap Heap with attached caches
+ * @param cpu Index of the calling CPU
+ * @param bytes Number of bytes requested
+ * @return Pointer to memory the caller can now use, or NULL
+ */
+void *sys_heap_cache_refill(struct sys_heap *heap, unsigned int cpu, size_t bytes);
+
+/** @brief Give cached blocks back to the heap
+ *
+ * Frees blocks from every magazine of @a cpu until each holds at most
+ * @a keep of them.  Requires the same locking as
+ * sys_heap_cache_refill().
+ *
+ * @param heap Heap with attached caches
+ * @param cpu Index of the calling CPU
+ * @param keep Number of blocks to leave in each magazine
+ * @return Number of blocks given back
+ */
+size_t sys_heap_cache_drain(struct sys_heap *heap, unsigned int cpu, size_t keep);
+#endif /* CONFIG_SYS_HEAP_CPU_CACHE */
+
 /** @brief Allocate memory from a sys_heap
  *
  * Returns a pointer to a block of unused memory in the heap.  This
@@ -11,6 +11,7 @@
 #include <zephyr/internal/syscall_handler.h>
 #include <zephyr/init.h>
 #include <ksched.h>
+#include <kernel_internal.h>
 
 static struct z_futex_data *k_futex_find_data(struct k_futex *futex)
 {
@@ -24,22 +25,16 @@ static struct z_futex_data *k_futex_find_data(struct k_futex *futex)
 	return obj->data.futex_data;
 }
 
-int z_impl_k_futex_wake(struct k_futex *futex, bool wake_all)
+int z_futex_wake_queue(struct k_spinlock *lock, _wait_q_t *wait_q, bool wake_all)
 {
 	k_spinlock_key_t key;
 	unsigned int woken = 0U;
 	struct k_thread *thread;
-	struct z_futex_data *futex_data;
-
-	futex_data = k_futex_find_data(futex);
-	if (futex_data == NULL) {
-		return -EINVAL;
-	}
 
-	key = k_spin_lock(&futex_data->lock);
+	key = k_spin_lock(lock);
 
 	do {
-		thread = z_unpend_first_thread(&futex_data->wait_q);
+		thread = z_unpend_first_thread(wait_q);
 		if (thread != NULL) {
 			woken++;
 			arch_thread_return_value_set(thread, 0);
@@ -48,14 +43,26 @@ int z_impl_k_futex_wake(struct k_futex *futex, bool wake_all)
 	} while (thread && wake_all);
 
 	if (woken == 0) {
-		k_spin_unlock(&futex_data->lock, key);
+		k_spin_unlock(lock, key);
 	} else {
-		z_reschedule(&futex_data->lock, key);
+		z_reschedule(lock, key);
 	}
 
 	return woken;
 }
 
+int z_impl_k_futex_wake(struct k_futex *futex, bool wake_all)
+{
+	struct z_futex_data *futex_data;
+
+	futex_data = k_futex_find_data(futex);
+	if (futex_data == NULL) {
+		return -EINVAL;
+	}
+
+	return z_futex_wake_queue(&futex_data->lock, &futex_data->wait_q, wake_all);
+}
+
 static inline int z_vrfy_k_futex_wake(struct k_futex *futex, bool wake_all)
 {
 	if (K_SYSCALL_MEMORY_WRITE(futex, sizeof(struct k_futex)) != 0) {
@@ -66,26 +73,20 @@ static inline int z_vrfy_k_futex_wake(struct k_futex *futex, bool wake_all)
 }
 #include <zephyr/syscalls/k_futex_wake_mrsh.c>
 
-int z_impl_k_futex_wait(struct k_futex *futex, int expected,
-			k_timeout_t timeout)
+int z_futex_wait_queue(atomic_t *val, atomic_val_t expected, struct k_spinlock *lock,
+		       _wait_q_t *wait_q, k_timeout_t timeout)
 {
 	int ret;
 	k_spinlock_key_t key;
-	struct z_futex_data *futex_data;
 
-	futex_data = k_futex_find_data(futex);
-	if (futex_data == NULL) {
-		return -EINVAL;
-	}
+	key = k_spin_lock(lock);
 
-	if (atomic_get(&futex->val) != (atomic_val_t)expected) {
+	if (atomic_get(val) != expected) {
+		k_spin_unlock(lock, key);
 		return -EAGAIN;
 	}
 
-	key = k_spin_lock(&futex_data->lock);
-
-	ret = z_pend_curr(&futex_data->lock,
-			key, &futex_data->wait_q, timeout);
+	ret = z_pend_curr(lock, key, wait_q, timeout);
 	if (ret == -EAGAIN) {
 		ret = -ETIMEDOUT;
 	}
@@ -93,6 +94,20 @@ int z_impl_k_futex_wait(struct k_futex *futex, int expected,
 	return ret;
 }
 
+int z_impl_k_futex_wait(struct k_futex *futex, int expected,
+			k_timeout_t timeout)
+{
+	struct z_futex_data *futex_data;
+
+	futex_data = k_futex_find_data(futex);
+	if (futex_data == NULL) {
+		return -EINVAL;
+	}
+
+	return z_futex_wait_queue(&futex->val, (atomic_val_t)expected,
+				  &futex_data->lock, &futex_data->wait_q, timeout);
+}
+
 static inline int z_vrfy_k_futex_wait(struct k_futex *futex, int expected,
 				      k_timeout_t timeout)
 {
@@ -107,6 +107,17 @@ void *z_thread_aligned_alloc(size_t align, size_t size);
  */
 void *z_thread_malloc(size_t size);
 
+#ifdef CONFIG_SYS_HEAP_CPU_CACHE
+/**
+ * @brief Allocate from a k_heap through the per-CPU caches, without waiting
+ *
+ * @param heap Heap to allocate from
+ * @param bytes Number of bytes requested
+ * @return Allocated memory, or NULL if the heap is exhausted
+ */
+void *z_heap_cached_alloc(struct k_heap *heap, size_t bytes);
+#endif /* CONFIG_SYS_HEAP_CPU_CACHE */
+
 
 #ifdef CONFIG_USE_SWITCH
 /* This is a arch function traditionally, but when the switch-based
@@ -178,6 +189,14 @@ void z_mem_domain_exit_thread(struct k_thread *thread);
  * not recommended.
  */
 extern struct k_spinlock z_mem_domain_lock;
+
+/* Futex wait and wake on a caller-provided wait queue. The value is checked
+ * with @a lock held, so a wake that follows a change of the value under the
+ * same lock can't be missed.
+ */
+int z_futex_wait_queue(atomic_t *val, atomic_val_t expected, struct k_spinlock *lock,
+		       _wait_q_t *wait_q, k_timeout_t timeout);
+int z_futex_wake_queue(struct k_spinlock *lock, _wait_q_t *wait_q, bool wake_all);
 #endif /* CONFIG_USERSPACE */
 
 #ifdef CONFIG_GDBSTUB
@@ -74,6 +74,27 @@ void z_thread_abort(struct k_thread *thread);
 void move_thread_to_end_of_prio_q(struct k_thread *thread);
 bool thread_is_sliceable(struct k_thread *thread);
 
+#ifdef CONFIG_SYNC_ADAPTIVE_SPIN
+/* True if @p thread is the current thread of a CPU, read without locking */
+bool z_thread_is_running(struct k_thread *thread);
+
+/* Cycles to spin on a contended k_mutex or k_sem before pending: the
+ * configured spin time, cut short by the caller's timeout.
+ */
+static inline uint32_t z_adaptive_spin_cyc(k_timeout_t timeout)
+{
+	uint64_t limit = k_us_to_cyc_ceil64(CONFIG_SYNC_ADAPTIVE_SPIN_US);
+
+	if (!K_TIMEOUT_EQ(timeout, K_FOREVER)) {
+		k_timeout_t left = sys_timepoint_timeout(sys_timepoint_calc(timeout));
+
+		limit = MIN(limit, k_ticks_to_cyc_floor64(left.ticks));
+	}
+
+	return (uint32_t)limit;
+}
+#endif /* CONFIG_SYNC_ADAPTIVE_SPIN */
+
 static inline void z_reschedule_unlocked(void)
 {
 	(void) z_reschedule_irqlock(arch_irq_lock());
@@ -328,11 +349,42 @@ void z_sched_cpu_usage(uint8_t core_id, struct k_thread_runtime_stats *stats);
 void z_sched_thread_usage(struct k_thread *thread,
 			  struct k_thread_runtime_stats *stats);
 
+#ifdef CONFIG_SCHED_THREAD_LATENCY_STATS
+/**
+ * @brief Start measuring the wakeup latency of a thread
+ *
+ * Called with the scheduler lock held when @a thread is added to the
+ * run queue. The latency is recorded when it is next switched in.
+ */
+void z_sched_usage_ready(struct k_thread *thread);
+
+/**
+ * @brief Start measuring the preemption delay of a thread
+ *
+ * Called on context switch for the outgoing @a thread, does nothing
+ * unless it is still runnable.
+ */
+void z_sched_usage_switched_out(struct k_thread *thread);
+#else
+static inline void z_sched_usage_ready(struct k_thread *thread)
+{
+	ARG_UNUSED(thread);
+}
+
+static inline void z_sched_usage_switched_out(struct k_thread *thread)
+{
+	ARG_UNUSED(thread);
+}
+#endif /* CONFIG_SCHED_THREAD_LATENCY_STATS */
+
 static inline void z_sched_usage_switch(struct k_thread *thread)
 {
 	ARG_UNUSED(thread);
 #ifdef CONFIG_SCHED_THREAD_USAGE
 	z_sched_usage_stop();
+	if (thread != _current) {
+		z_sched_usage_switched_out(_current);
+	}
 	z_sched_usage_start(thread);
 #endif /* CONFIG_SCHED_THREAD_USAGE */
 }
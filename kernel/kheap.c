@@ -11,6 +11,7 @@
 /* private kernel APIs */
 #include <ksched.h>
 #include <wait_q.h>
+#include <kernel_internal.h>
 
 int k_heap_array_get(struct k_heap **heap)
 {
@@ -28,6 +29,9 @@ void k_heap_init(struct k_heap *heap, void *mem, size_t bytes)
 	z_waitq_init(&heap->wait_q);
 	heap->lock = (struct k_spinlock) {};
 	sys_heap_init(&heap->heap, mem, bytes);
+#ifdef CONFIG_SYS_HEAP_CPU_CACHE
+	sys_heap_cache_init(&heap->heap, heap->cache);
+#endif
 
 	SYS_PORT_TRACING_OBJ_INIT(k_heap, heap);
 }
@@ -76,6 +80,48 @@ SYS_INIT_NAMED(statics_init_post, statics_init, POST_KERNEL, 0);
 
 typedef void * (sys_heap_allocator_t)(struct sys_heap *heap, size_t align, size_t bytes);
 
+#ifdef CONFIG_SYS_HEAP_CPU_CACHE
+/* Lockless hit in the local CPU's magazine, or NULL */
+static void *cache_alloc(struct k_heap *heap, size_t bytes)
+{
+	unsigned int key = arch_irq_lock();
+	void *ret = sys_heap_cache_alloc(&heap->heap, _current_cpu->id, bytes);
+
+	arch_irq_unlock(key);
+	return ret;
+}
+
+/* sys_heap_allocator_t for the refill path, heap lock held */
+static void *cache_refill_alloc(struct sys_heap *heap, size_t align, size_t bytes)
+{
+	void *ret;
+
+	ARG_UNUSED(align);
+
+	ret = sys_heap_cache_refill(heap, _current_cpu->id, bytes);
+	if ((ret == NULL) && (sys_heap_cache_drain(heap, _current_cpu->id, 0) != 0U)) {
+		/* Memory parked in this CPU's magazines may be enough */
+		ret = sys_heap_alloc(heap, bytes);
+	}
+
+	return ret;
+}
+
+void *z_heap_cached_alloc(struct k_heap *heap, size_t bytes)
+{
+	void *ret = cache_alloc(heap, bytes);
+
+	if (ret == NULL) {
+		k_spinlock_key_t key = k_spin_lock(&heap->lock);
+
+		ret = cache_refill_alloc(&heap->heap, 0, bytes);
+		k_spin_unlock(&heap->lock, key);
+	}
+
+	return ret;
+}
+#endif /* CONFIG_SYS_HEAP_CPU_CACHE */
+
 static void *z_heap_alloc_helper(struct k_heap *heap, size_t align, size_t bytes,
 				 k_timeout_t timeout,
 				 sys_heap_allocator_t *sys_heap_allocator)
@@ -83,6 +129,16 @@ static void *z_heap_alloc_helper(struct k_heap *heap, size_t align, size_t bytes
 	k_timepoint_t end = sys_timepoint_calc(timeout);
 	void *ret = NULL;
 
+#ifdef CONFIG_SYS_HEAP_CPU_CACHE
+	if (sys_heap_allocator == sys_heap_noalign_alloc) {
+		ret = cache_alloc(heap, bytes);
+		if (ret != NULL) {
+			return ret;
+		}
+		sys_heap_allocator = cache_refill_alloc;
+	}
+#endif /* CONFIG_SYS_HEAP_CPU_CACHE */
+
 	k_spinlock_key_t key = k_spin_lock(&heap->lock);
 
 	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
@@ -205,9 +261,30 @@ void *k_heap_realloc(struct k_heap *heap, void *ptr, size_t bytes, k_timeout_t t
 
 void k_heap_free(struct k_heap *heap, void *mem)
 {
+#ifdef CONFIG_SYS_HEAP_CPU_CACHE
+	/* Waiters need the memory back in the heap, bypass the cache then */
+	bool waiters = (z_waitq_head(&heap->wait_q) != NULL);
+
+	if (!waiters) {
+		unsigned int irq_key = arch_irq_lock();
+		bool cached = sys_heap_cache_free(&heap->heap, _current_cpu->id, mem);
+
+		arch_irq_unlock(irq_key);
+		if (cached) {
+			SYS_PORT_TRACING_OBJ_FUNC(k_heap, free, heap);
+			return;
+		}
+	}
+#endif /* CONFIG_SYS_HEAP_CPU_CACHE */
+
 	k_spinlock_key_t key = k_spin_lock(&heap->lock);
 
 	sys_heap_free(&heap->heap, mem);
+#ifdef CONFIG_SYS_HEAP_CPU_CACHE
+	/* Trim full magazines in one batch, or empty them for waiters */
+	sys_heap_cache_drain(&heap->heap, _current_cpu->id,
+			     waiters ? 0 : CONFIG_SYS_HEAP_CPU_CACHE_DEPTH / 2);
+#endif /* CONFIG_SYS_HEAP_CPU_CACHE */
 
 	SYS_PORT_TRACING_OBJ_FUNC(k_heap, free, heap);
 	if (IS_ENABLED(CONFIG_MULTITHREADING) && (z_unpend_all(&heap->wait_q) != 0)) {
@@ -33,6 +33,7 @@ static int k_mem_slab_stats_raw(struct k_obj_core *obj_core, void *stats)
 	slab = CONTAINER_OF(obj_core, struct k_mem_slab, obj_core);
 	key = k_spin_lock(&slab->lock);
 	memcpy(stats, &slab->info, sizeof(slab->info));
+	((struct k_mem_slab_info *)stats)->num_used -= z_mem_slab_cached(slab);
 	k_spin_unlock(&slab->lock, key);
 
 	return 0;
@@ -48,9 +49,8 @@ static int k_mem_slab_stats_query(struct k_obj_core *obj_core, void *stats)
 
 	slab = CONTAINER_OF(obj_core, struct k_mem_slab, obj_core);
 	key = k_spin_lock(&slab->lock);
-	ptr->free_bytes = (slab->info.num_blocks - slab->info.num_used) *
-			  slab->info.block_size;
-	ptr->allocated_bytes = slab->info.num_used * slab->info.block_size;
+	ptr->free_bytes = k_mem_slab_num_free_get(slab) * slab->info.block_size;
+	ptr->allocated_bytes = k_mem_slab_num_used_get(slab) * slab->info.block_size;
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
 	ptr->max_allocated_bytes = slab->info.max_used * slab->info.block_size;
 #else
@@ -183,6 +183,10 @@ int k_mem_slab_init(struct k_mem_slab *slab, void *buffer,
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
 	slab->info.max_used = 0U;
 #endif /* CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION */
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	(void)memset(slab->cache, 0, sizeof(slab->cache));
+	slab->cache_bypass = false;
+#endif /* CONFIG_MEM_SLAB_CPU_CACHE */
 
 	rc = create_free_list(slab);
 	if (rc < 0) {
@@ -219,17 +223,144 @@ static bool slab_ptr_is_good(struct k_mem_slab *slab, const void *ptr)
 	       ((offset % slab->info.block_size) == 0);
 }
 
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+#define CACHE_DEPTH CONFIG_MEM_SLAB_CPU_CACHE_DEPTH
+
+/* Take a block from the calling CPU's cache, without the slab lock */
+static bool cache_alloc(struct k_mem_slab *slab, void **mem)
+{
+	unsigned int irq_key = arch_irq_lock();
+	struct k_mem_slab_cpu_cache *cache = &slab->cache[_current_cpu->id];
+	k_spinlock_key_t key = k_spin_lock(&cache->lock);
+	bool hit = (cache->free_list != NULL);
+
+	if (hit) {
+		*mem = cache->free_list;
+		cache->free_list = *(char **)(cache->free_list);
+		cache->count--;
+	}
+
+	k_spin_unlock(&cache->lock, key);
+	arch_irq_unlock(irq_key);
+
+	return hit;
+}
+
+/* Park a block in the calling CPU's cache, without the slab lock */
+static bool cache_free(struct k_mem_slab *slab, void *mem)
+{
+	unsigned int irq_key = arch_irq_lock();
+	struct k_mem_slab_cpu_cache *cache = &slab->cache[_current_cpu->id];
+	k_spinlock_key_t key = k_spin_lock(&cache->lock);
+	/* Read under the cache lock, see cache_reclaim() */
+	bool hit = !slab->cache_bypass && (cache->count < CACHE_DEPTH);
+
+	if (hit) {
+		*(char **)mem = cache->free_list;
+		cache->free_list = (char *)mem;
+		cache->count++;
+	}
+
+	k_spin_unlock(&cache->lock, key);
+	arch_irq_unlock(irq_key);
+
+	return hit;
+}
+
+/*
+ * Move blocks between the slab and the calling CPU's cache until the
+ * cache holds @a target blocks, or the slab runs dry. Slab lock held.
+ */
+static void cache_balance(struct k_mem_slab *slab, uint32_t target)
+{
+	struct k_mem_slab_cpu_cache *cache = &slab->cache[_current_cpu->id];
+	k_spinlock_key_t key = k_spin_lock(&cache->lock);
+	char *p;
+
+	while ((cache->count < target) && (slab->free_list != NULL)) {
+		p = slab->free_list;
+		slab->free_list = *(char **)p;
+		*(char **)p = cache->free_list;
+		cache->free_list = p;
+		cache->count++;
+		slab->info.num_used++;
+	}
+
+	while (cache->count > target) {
+		p = cache->free_list;
+		cache->free_list = *(char **)p;
+		*(char **)p = slab->free_list;
+		slab->free_list = p;
+		cache->count--;
+		slab->info.num_used--;
+	}
+
+	k_spin_unlock(&cache->lock, key);
+}
+
+/*
+ * Return the blocks parked on every CPU to the slab, and keep further
+ * frees out of the caches until a free finds nobody waiting. A free
+ * racing with this either pushes its block before we drain that cache,
+ * or takes the cache lock after us and sees cache_bypass set, so no
+ * block can be stranded in a cache while a thread pends on the slab.
+ * Slab lock held.
+ */
+static void cache_reclaim(struct k_mem_slab *slab)
+{
+	slab->cache_bypass = true;
+
+	for (unsigned int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
+		struct k_mem_slab_cpu_cache *cache = &slab->cache[i];
+		k_spinlock_key_t key = k_spin_lock(&cache->lock);
+		char *p;
+
+		while (cache->free_list != NULL) {
+			p = cache->free_list;
+			cache->free_list = *(char **)p;
+			*(char **)p = slab->free_list;
+			slab->free_list = p;
+		}
+		slab->info.num_used -= cache->count;
+		cache->count = 0U;
+
+		k_spin_unlock(&cache->lock, key);
+	}
+}
+#endif /* CONFIG_MEM_SLAB_CPU_CACHE */
+
 int k_mem_slab_alloc(struct k_mem_slab *slab, void **mem, k_timeout_t timeout)
 {
-	k_spinlock_key_t key = k_spin_lock(&slab->lock);
 	int result;
 
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	if (cache_alloc(slab, mem)) {
+		SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, alloc, slab, timeout);
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, alloc, slab, timeout, 0);
+		return 0;
+	}
+#endif /* CONFIG_MEM_SLAB_CPU_CACHE */
+
+	k_spinlock_key_t key = k_spin_lock(&slab->lock);
+
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, alloc, slab, timeout);
 
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	if (slab->free_list == NULL) {
+		cache_reclaim(slab);
+	}
+#endif /* CONFIG_MEM_SLAB_CPU_CACHE */
+
 	if (slab->free_list != NULL) {
 		/* take a free block */
 		*mem = slab->free_list;
 		slab->free_list = *(char **)(slab->free_list);
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+		if (!slab->cache_bypass) {
+			/* stock up for the next allocations on this CPU */
+			cache_balance(slab, CACHE_DEPTH / 2);
+		}
+#endif /* CONFIG_MEM_SLAB_CPU_CACHE */
 		slab->info.num_used++;
 		__ASSERT((slab->free_list == NULL &&
 			  slab->info.num_used == slab->info.num_blocks) ||
@@ -276,6 +407,14 @@ void k_mem_slab_free(struct k_mem_slab *slab, void *mem)
 		return;
 	}
 
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	if (cache_free(slab, mem)) {
+		SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, free, slab);
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, free, slab);
+		return;
+	}
+#endif /* CONFIG_MEM_SLAB_CPU_CACHE */
+
 	k_spinlock_key_t key = k_spin_lock(&slab->lock);
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_mem_slab, free, slab);
@@ -295,6 +434,15 @@ void k_mem_slab_free(struct k_mem_slab *slab, void *mem)
 	slab->free_list = (char *) mem;
 	slab->info.num_used--;
 
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	/* Nobody left waiting, let frees use the caches again */
+	slab->cache_bypass = (z_waitq_head(&slab->wait_q) != NULL);
+	if (slab->cache[_current_cpu->id].count > (CACHE_DEPTH / 2)) {
+		/* return half of a full cache in one go */
+		cache_balance(slab, CACHE_DEPTH / 2);
+	}
+#endif /* CONFIG_MEM_SLAB_CPU_CACHE */
+
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_mem_slab, free, slab);
 
 	k_spin_unlock(&slab->lock, key);
@@ -308,9 +456,8 @@ int k_mem_slab_runtime_stats_get(struct k_mem_slab *slab, struct sys_memory_stat
 
 	k_spinlock_key_t key = k_spin_lock(&slab->lock);
 
-	stats->allocated_bytes = slab->info.num_used * slab->info.block_size;
-	stats->free_bytes = (slab->info.num_blocks - slab->info.num_used) *
-			    slab->info.block_size;
+	stats->allocated_bytes = k_mem_slab_num_used_get(slab) * slab->info.block_size;
+	stats->free_bytes = k_mem_slab_num_free_get(slab) * slab->info.block_size;
 #ifdef CONFIG_MEM_SLAB_TRACE_MAX_UTILIZATION
 	stats->max_allocated_bytes = slab->info.max_used *
 				     slab->info.block_size;
@@ -8,6 +8,7 @@
 #include <string.h>
 #include <zephyr/sys/math_extras.h>
 #include <zephyr/sys/util.h>
+#include <kernel_internal.h>
 
 typedef void * (sys_heap_allocator_t)(struct sys_heap *heap, size_t align, size_t bytes);
 
@@ -38,9 +39,16 @@ static void *z_alloc_helper(struct k_heap *heap, size_t align, size_t size,
 	 * No point calling k_heap_malloc/k_heap_aligned_alloc with K_NO_WAIT.
 	 * Better bypass them and go directly to sys_heap_*() instead.
 	 */
-	key = k_spin_lock(&heap->lock);
-	mem = sys_heap_allocator(&heap->heap, __align, size);
-	k_spin_unlock(&heap->lock, key);
+#ifdef CONFIG_SYS_HEAP_CPU_CACHE
+	if (sys_heap_allocator == sys_heap_noalign_alloc) {
+		mem = z_heap_cached_alloc(heap, size);
+	} else
+#endif /* CONFIG_SYS_HEAP_CPU_CACHE */
+	{
+		key = k_spin_lock(&heap->lock);
+		mem = sys_heap_allocator(&heap->heap, __align, size);
+		k_spin_unlock(&heap->lock, key);
+	}
 
 	if (mem == NULL) {
 		return NULL;
@@ -788,6 +788,7 @@ void k_mem_unmap_phys_guard(void *addr, size_t size, bool is_anon)
 			    (!k_mem_page_frame_is_pinned(pf))) {
 				k_mem_paging_eviction_remove(pf);
 			}
+			k_mem_paging_eviction_reset(pf);
 #endif
 
 			/* Put the page frame back into free list */
@@ -1356,6 +1357,7 @@ static int page_frame_prepare_locked(struct k_mem_page_frame *pf, bool *dirty_pt
 		if (IS_ENABLED(CONFIG_EVICTION_TRACKING)) {
 			k_mem_paging_eviction_remove(pf);
 		}
+		k_mem_paging_eviction_reset(pf);
 	} else {
 		/* Shouldn't happen unless this function is mis-used */
 		__ASSERT(!dirty, "un-mapped page determined to be dirty");
@@ -1610,16 +1612,183 @@ static inline struct k_mem_page_frame *do_eviction_select(bool *dirty)
 	return pf;
 }
 
-static bool do_page_fault(void *addr, bool pin)
+/*
+ * Page in the data page at @a addr from @a page_in_location into @a pf,
+ * which is either free or was just selected for eviction. Called and
+ * returns with z_mm_lock held, but the lock is dropped around backing store
+ * accesses if CONFIG_DEMAND_PAGING_ALLOW_IRQ is set.
+ */
+static void page_frame_page_in_locked(struct k_mem_page_frame *pf, bool dirty,
+				      void *addr, uintptr_t page_in_location,
+				      bool pin, k_spinlock_key_t *key)
+{
+	uintptr_t page_out_location;
+	int ret;
+
+	ret = page_frame_prepare_locked(pf, &dirty, true, &page_out_location);
+	__ASSERT(ret == 0, "failed to prepare page frame");
+
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+	k_spin_unlock(&z_mm_lock, *key);
+	/* Interrupts are now unlocked if they were not locked when we entered
+	 * this function, and we may service ISRs. The scheduler is still
+	 * locked.
+	 */
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+	if (dirty) {
+		do_backing_store_page_out(page_out_location);
+	}
+	do_backing_store_page_in(page_in_location);
+
+#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
+	*key = k_spin_lock(&z_mm_lock);
+	k_mem_page_frame_clear(pf, K_MEM_PAGE_FRAME_BUSY);
+#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
+	k_mem_page_frame_clear(pf, K_MEM_PAGE_FRAME_MAPPED);
+	frame_mapped_set(pf, addr);
+	if (pin) {
+		k_mem_page_frame_set(pf, K_MEM_PAGE_FRAME_PINNED);
+	}
+
+	arch_mem_page_in(addr, k_mem_page_frame_to_phys(pf));
+	k_mem_paging_backing_store_page_finalize(pf, page_in_location);
+	if (IS_ENABLED(CONFIG_EVICTION_TRACKING) && (!pin)) {
+		k_mem_paging_eviction_add(pf);
+	}
+}
+
+#ifdef CONFIG_DEMAND_PAGING_READAHEAD
+/* Largest distance between faults still considered as a strided stream */
+#define READAHEAD_MAX_STRIDE	(16 * CONFIG_MMU_PAGE_SIZE)
+
+/*
+ * Fault stream tracking. A stream is detected when two consecutive faults
+ * are one page apart, or at the same distance as the two previous ones.
+ * Protected by z_mm_lock.
+ */
+static struct {
+	uintptr_t last;		/* last faulting page */
+	intptr_t stride;	/* distance between the last two faults */
+	uintptr_t next;		/* next fault address if the stream goes on */
+	uint32_t window;	/* read ahead window of the last fault */
+	uint32_t count;		/* pages actually read ahead on the last fault */
+} ra_stream;
+
+static inline void paging_stats_readahead_inc(struct k_thread *faulting_thread,
+					      unsigned long pages,
+					      unsigned long hits)
+{
+#ifdef CONFIG_DEMAND_PAGING_STATS
+	paging_stats.readahead.pages += pages;
+	paging_stats.readahead.hits += hits;
+#ifdef CONFIG_DEMAND_PAGING_THREAD_STATS
+	faulting_thread->paging_stats.readahead.pages += pages;
+	faulting_thread->paging_stats.readahead.hits += hits;
+#else
+	ARG_UNUSED(faulting_thread);
+#endif /* CONFIG_DEMAND_PAGING_THREAD_STATS */
+#else
+	ARG_UNUSED(faulting_thread);
+	ARG_UNUSED(pages);
+	ARG_UNUSED(hits);
+#endif /* CONFIG_DEMAND_PAGING_STATS */
+}
+
+/* Whether @a pf holds one of the first @a count pages read ahead of @a addr */
+static bool readahead_in_window(struct k_mem_page_frame *pf, uintptr_t addr,
+				intptr_t stride, uint32_t count)
+{
+	intptr_t dist = (intptr_t)k_mem_page_frame_to_virt(pf) - (intptr_t)addr;
+
+	if ((dist % stride) != 0) {
+		return false;
+	}
+
+	dist /= stride;
+
+	return (dist >= 1) && (dist <= (intptr_t)count);
+}
+
+/*
+ * Called once the page at @a addr was paged in into @a fault_pf. Pages in
+ * the following data pages of the stream @a addr belongs to, if any.
+ */
+static void do_readahead_locked(void *addr, struct k_mem_page_frame *fault_pf,
+				struct k_thread *faulting_thread,
+				k_spinlock_key_t *key)
+{
+	uintptr_t fault = ROUND_DOWN((uintptr_t)addr, CONFIG_MMU_PAGE_SIZE);
+	intptr_t stride = (intptr_t)(fault - ra_stream.last);
+	uint32_t window = 0U;
+	uint32_t count = 0U;
+
+	if ((ra_stream.window != 0U) && (fault == ra_stream.next)) {
+		/* The stream went past all pages read ahead last time */
+		paging_stats_readahead_inc(faulting_thread, 0, ra_stream.count);
+		stride = ra_stream.stride;
+		window = MIN(ra_stream.window * 2U,
+			     CONFIG_DEMAND_PAGING_READAHEAD_MAX);
+	} else if ((stride != 0) &&
+		   ((stride == ra_stream.stride) || (stride == CONFIG_MMU_PAGE_SIZE)) &&
+		   (stride >= -READAHEAD_MAX_STRIDE) && (stride <= READAHEAD_MAX_STRIDE)) {
+		window = 1U;
+	}
+
+	ra_stream.last = fault;
+	ra_stream.stride = stride;
+
+	for (uint32_t i = 1U; i <= window; i++) {
+		uint8_t *ra_addr = (uint8_t *)(fault + (uintptr_t)((intptr_t)i * stride));
+		struct k_mem_page_frame *pf, *victim;
+		uintptr_t location;
+		bool dirty = false;
+
+		if ((ra_addr < K_MEM_VIRT_RAM_START) || (ra_addr >= K_MEM_VIRT_RAM_END) ||
+		    (arch_page_location_get(ra_addr, &location) !=
+		     ARCH_PAGE_LOCATION_PAGED_OUT)) {
+			break;
+		}
+
+		pf = free_page_frame_list_get();
+		if (pf == NULL) {
+			/* Never write back pages nor push out the stream itself
+			 * for a speculative read. Look at the victim first, as
+			 * selecting it may update the eviction state.
+			 */
+			victim = k_mem_paging_eviction_peek(&dirty);
+			if ((victim == NULL) || (victim == fault_pf) || dirty ||
+			    !k_mem_page_frame_is_backed(victim) ||
+			    readahead_in_window(victim, fault, stride, count)) {
+				break;
+			}
+
+			pf = do_eviction_select(&dirty);
+			__ASSERT(pf == victim, "peeked and selected page frames differ");
+
+			paging_stats_eviction_inc(faulting_thread, dirty);
+		}
+
+		page_frame_page_in_locked(pf, dirty, ra_addr, location, false, key);
+		count++;
+	}
+
+	ra_stream.window = window;
+	ra_stream.count = count;
+	ra_stream.next = fault + (uintptr_t)((intptr_t)(count + 1U) * stride);
+
+	paging_stats_readahead_inc(faulting_thread, count, 0);
+}
+#endif /* CONFIG_DEMAND_PAGING_READAHEAD */
+
+static bool do_page_fault(void *addr, bool pin, bool readahead)
 {
 	struct k_mem_page_frame *pf;
 	k_spinlock_key_t key;
-	uintptr_t page_in_location, page_out_location;
+	uintptr_t page_in_location;
 	enum arch_page_location status;
 	bool result;
 	bool dirty = false;
 	struct k_thread *faulting_thread;
-	int ret;
 
 	__ASSERT(page_frames_initialized, "page fault at %p happened too early",
 		 addr);
@@ -1721,36 +1890,15 @@ static bool do_page_fault(void *addr, bool pin)
 
 		paging_stats_eviction_inc(faulting_thread, dirty);
 	}
-	ret = page_frame_prepare_locked(pf, &dirty, true, &page_out_location);
-	__ASSERT(ret == 0, "failed to prepare page frame");
+	page_frame_page_in_locked(pf, dirty, addr, page_in_location, pin, &key);
 
-#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
-	k_spin_unlock(&z_mm_lock, key);
-	/* Interrupts are now unlocked if they were not locked when we entered
-	 * this function, and we may service ISRs. The scheduler is still
-	 * locked.
-	 */
-#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
-	if (dirty) {
-		do_backing_store_page_out(page_out_location);
-	}
-	do_backing_store_page_in(page_in_location);
-
-#ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
-	key = k_spin_lock(&z_mm_lock);
-	k_mem_page_frame_clear(pf, K_MEM_PAGE_FRAME_BUSY);
-#endif /* CONFIG_DEMAND_PAGING_ALLOW_IRQ */
-	k_mem_page_frame_clear(pf, K_MEM_PAGE_FRAME_MAPPED);
-	frame_mapped_set(pf, addr);
-	if (pin) {
-		k_mem_page_frame_set(pf, K_MEM_PAGE_FRAME_PINNED);
-	}
-
-	arch_mem_page_in(addr, k_mem_page_frame_to_phys(pf));
-	k_mem_paging_backing_store_page_finalize(pf, page_in_location);
-	if (IS_ENABLED(CONFIG_EVICTION_TRACKING) && (!pin)) {
-		k_mem_paging_eviction_add(pf);
+#ifdef CONFIG_DEMAND_PAGING_READAHEAD
+	if (readahead) {
+		do_readahead_locked(addr, pf, faulting_thread, &key);
 	}
+#else
+	ARG_UNUSED(readahead);
+#endif /* CONFIG_DEMAND_PAGING_READAHEAD */
 out:
 	k_spin_unlock(&z_mm_lock, key);
 #ifdef CONFIG_DEMAND_PAGING_ALLOW_IRQ
@@ -1768,7 +1916,7 @@ static void do_page_in(void *addr)
 {
 	bool ret;
 
-	ret = do_page_fault(addr, false);
+	ret = do_page_fault(addr, false, false);
 	__ASSERT(ret, "unmapped memory address %p", addr);
 	(void)ret;
 }
@@ -1785,7 +1933,7 @@ static void do_mem_pin(void *addr)
 {
 	bool ret;
 
-	ret = do_page_fault(addr, true);
+	ret = do_page_fault(addr, true, false);
 	__ASSERT(ret, "unmapped memory address %p", addr);
 	(void)ret;
 }
@@ -1800,7 +1948,7 @@ void k_mem_pin(void *addr, size_t size)
 
 bool k_mem_page_fault(void *addr)
 {
-	return do_page_fault(addr, false);
+	return do_page_fault(addr, false, true);
 }
 
 static void do_mem_unpin(void *addr)
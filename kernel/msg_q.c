@@ -40,6 +40,198 @@ static inline bool handle_poll_events(struct k_msgq *msgq)
 #endif /* CONFIG_POLL */
 }
 
+#ifdef CONFIG_MSGQ_LOCKFREE
+static inline bool msgq_is_lockfree(struct k_msgq *msgq)
+{
+	return (msgq->flags & K_MSGQ_FLAG_LOCKFREE) != 0U;
+}
+
+/*
+ * A lockfree queue is only locked to wait on it, and to wake up its waiters.
+ *
+ * A thread about to wait counts itself in msgq->waiters, then retries its
+ * operation under the lock before pending. Writers and readers look for
+ * waiters after pushing or popping, so either the waiter sees the message
+ * (or the room), or the other side sees the waiter. Pollers are found on
+ * poll_events, and register_event() checks the queue again once they are.
+ */
+static inline bool lockfree_has_waiters(struct k_msgq *msgq)
+{
+	if (atomic_get(&msgq->waiters) != 0) {
+		return true;
+	}
+
+#ifdef CONFIG_POLL
+	return !sys_dlist_is_empty(&msgq->poll_events);
+#else
+	return false;
+#endif /* CONFIG_POLL */
+}
+
+/*
+ * Readers and writers share the wait queue, so every waiter is woken up to
+ * retry its operation.
+ */
+static void lockfree_wake(struct k_msgq *msgq, bool data_available)
+{
+	struct k_thread *pending_thread;
+	k_spinlock_key_t key;
+	bool resched = false;
+
+	if (!lockfree_has_waiters(msgq)) {
+		return;
+	}
+
+	key = k_spin_lock(&msgq->lock);
+
+	for (pending_thread = z_unpend_first_thread(&msgq->wait_q);
+	     pending_thread != NULL;
+	     pending_thread = z_unpend_first_thread(&msgq->wait_q)) {
+		arch_thread_return_value_set(pending_thread, 0);
+		z_ready_thread(pending_thread);
+		resched = true;
+	}
+
+	if (data_available) {
+		resched = handle_poll_events(msgq) || resched;
+	}
+
+	if (resched) {
+		z_reschedule(&msgq->lock, key);
+	} else {
+		k_spin_unlock(&msgq->lock, key);
+	}
+}
+
+static int lockfree_put(struct k_msgq *msgq, const void *data, k_timeout_t timeout)
+{
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	k_spinlock_key_t key;
+	int result;
+
+	while (!mpmc_push(&msgq->ring, data)) {
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			return -ENOMSG;
+		}
+
+		key = k_spin_lock(&msgq->lock);
+		atomic_inc(&msgq->waiters);
+
+		if (mpmc_push(&msgq->ring, data)) {
+			atomic_dec(&msgq->waiters);
+			k_spin_unlock(&msgq->lock, key);
+			break;
+		}
+
+		if (sys_timepoint_expired(end)) {
+			atomic_dec(&msgq->waiters);
+			k_spin_unlock(&msgq->lock, key);
+			return -EAGAIN;
+		}
+
+		SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_msgq, put, msgq, timeout);
+
+		result = z_pend_curr(&msgq->lock, key, &msgq->wait_q,
+				     sys_timepoint_timeout(end));
+		atomic_dec(&msgq->waiters);
+		if (result != 0) {
+			return result;
+		}
+	}
+
+	lockfree_wake(msgq, true);
+
+	return 0;
+}
+
+static int lockfree_get(struct k_msgq *msgq, void *data, k_timeout_t timeout)
+{
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	k_spinlock_key_t key;
+	int result;
+
+	while (!mpmc_pop(&msgq->ring, data)) {
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			return -ENOMSG;
+		}
+
+		key = k_spin_lock(&msgq->lock);
+		atomic_inc(&msgq->waiters);
+
+		if (mpmc_pop(&msgq->ring, data)) {
+			atomic_dec(&msgq->waiters);
+			k_spin_unlock(&msgq->lock, key);
+			break;
+		}
+
+		if (sys_timepoint_expired(end)) {
+			atomic_dec(&msgq->waiters);
+			k_spin_unlock(&msgq->lock, key);
+			return -EAGAIN;
+		}
+
+		SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_msgq, get, msgq, timeout);
+
+		result = z_pend_curr(&msgq->lock, key, &msgq->wait_q,
+				     sys_timepoint_timeout(end));
+		atomic_dec(&msgq->waiters);
+		if (result != 0) {
+			return result;
+		}
+	}
+
+	lockfree_wake(msgq, false);
+
+	return 0;
+}
+
+static int lockfree_put_batch(struct k_msgq *msgq, const char *src, uint32_t num_msgs,
+			      k_timeout_t timeout)
+{
+	uint32_t count = 0U;
+	int result;
+
+	while ((count < num_msgs) && mpmc_push(&msgq->ring, src)) {
+		src += msgq->msg_size;
+		count++;
+	}
+
+	if (count == 0U) {
+		/* wait for room for the first message only */
+		result = lockfree_put(msgq, src, timeout);
+
+		return (result == 0) ? 1 : result;
+	}
+
+	lockfree_wake(msgq, true);
+
+	return (int)count;
+}
+
+static int lockfree_get_batch(struct k_msgq *msgq, char *dst, uint32_t num_msgs,
+			      k_timeout_t timeout)
+{
+	uint32_t count = 0U;
+	int result;
+
+	while ((count < num_msgs) && mpmc_pop(&msgq->ring, dst)) {
+		dst += msgq->msg_size;
+		count++;
+	}
+
+	if (count == 0U) {
+		/* wait for the first message only */
+		result = lockfree_get(msgq, dst, timeout);
+
+		return (result == 0) ? 1 : result;
+	}
+
+	lockfree_wake(msgq, false);
+
+	return (int)count;
+}
+#endif /* CONFIG_MSGQ_LOCKFREE */
+
 void k_msgq_init(struct k_msgq *msgq, char *buffer, size_t msg_size,
 		 uint32_t max_msgs)
 {
@@ -134,6 +326,20 @@ static inline int put_msg_in_queue(struct k_msgq *msgq, const void *data,
 	int result;
 	bool resched = false;
 
+#ifdef CONFIG_MSGQ_LOCKFREE
+	if (msgq_is_lockfree(msgq)) {
+		if (!put_at_back) {
+			return -ENOTSUP;
+		}
+
+		SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, put, msgq, timeout);
+		result = lockfree_put(msgq, data, timeout);
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, put, msgq, timeout, result);
+
+		return result;
+	}
+#endif /* CONFIG_MSGQ_LOCKFREE */
+
 	key = k_spin_lock(&msgq->lock);
 
 	if (put_at_back) {
@@ -259,7 +465,7 @@ void z_impl_k_msgq_get_attrs(struct k_msgq *msgq, struct k_msgq_attrs *attrs)
 {
 	attrs->msg_size = msgq->msg_size;
 	attrs->max_msgs = msgq->max_msgs;
-	attrs->used_msgs = msgq->used_msgs;
+	attrs->used_msgs = z_impl_k_msgq_num_used_get(msgq);
 }
 
 #ifdef CONFIG_USERSPACE
@@ -282,6 +488,16 @@ int z_impl_k_msgq_get(struct k_msgq *msgq, void *data, k_timeout_t timeout)
 	int result;
 	bool resched = false;
 
+#ifdef CONFIG_MSGQ_LOCKFREE
+	if (msgq_is_lockfree(msgq)) {
+		SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, get, msgq, timeout);
+		result = lockfree_get(msgq, data, timeout);
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, get, msgq, timeout, result);
+
+		return result;
+	}
+#endif /* CONFIG_MSGQ_LOCKFREE */
+
 	key = k_spin_lock(&msgq->lock);
 
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, get, msgq, timeout);
@@ -354,11 +570,217 @@ static inline int z_vrfy_k_msgq_get(struct k_msgq *msgq, void *data,
 #include <zephyr/syscalls/k_msgq_get_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
+int z_impl_k_msgq_put_batch(struct k_msgq *msgq, const void *data, uint32_t num_msgs,
+			    k_timeout_t timeout)
+{
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+
+	const char *src = data;
+	struct k_thread *pending_thread;
+	k_spinlock_key_t key;
+	uint32_t count = 0U;
+	bool queued = false;
+	bool resched = false;
+	int result;
+
+	if (num_msgs == 0U) {
+		return -EINVAL;
+	}
+
+#ifdef CONFIG_MSGQ_LOCKFREE
+	if (msgq_is_lockfree(msgq)) {
+		SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, put, msgq, timeout);
+		result = lockfree_put_batch(msgq, src, num_msgs, timeout);
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, put, msgq, timeout, result);
+
+		return result;
+	}
+#endif /* CONFIG_MSGQ_LOCKFREE */
+
+	key = k_spin_lock(&msgq->lock);
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, put, msgq, timeout);
+
+	while ((count < num_msgs) && (msgq->used_msgs < msgq->max_msgs)) {
+		/* readers only wait on an empty queue, serve them first */
+		pending_thread = z_unpend_first_thread(&msgq->wait_q);
+		if (unlikely(pending_thread != NULL)) {
+			(void)memcpy(pending_thread->base.swap_data, src, msgq->msg_size);
+			arch_thread_return_value_set(pending_thread, 0);
+			z_ready_thread(pending_thread);
+			resched = true;
+		} else {
+			__ASSERT_NO_MSG(msgq->write_ptr >= msgq->buffer_start &&
+					msgq->write_ptr < msgq->buffer_end);
+			(void)memcpy(msgq->write_ptr, src, msgq->msg_size);
+			msgq->write_ptr += msgq->msg_size;
+			if (msgq->write_ptr == msgq->buffer_end) {
+				msgq->write_ptr = msgq->buffer_start;
+			}
+			msgq->used_msgs++;
+			queued = true;
+		}
+		src += msgq->msg_size;
+		count++;
+	}
+
+	if (count == 0U) {
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			result = -ENOMSG;
+		} else {
+			SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_msgq, put, msgq, timeout);
+
+			/* wait for room for the first message only */
+			_current->base.swap_data = (void *)data;
+
+			result = z_pend_curr(&msgq->lock, key, &msgq->wait_q, timeout);
+			SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, put, msgq, timeout, result);
+
+			return (result == 0) ? 1 : result;
+		}
+	} else {
+		if (queued) {
+			resched = handle_poll_events(msgq) || resched;
+		}
+		result = (int)count;
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, put, msgq, timeout, result);
+
+	if (resched) {
+		z_reschedule(&msgq->lock, key);
+	} else {
+		k_spin_unlock(&msgq->lock, key);
+	}
+
+	return result;
+}
+
+int z_impl_k_msgq_get_batch(struct k_msgq *msgq, void *data, uint32_t num_msgs,
+			    k_timeout_t timeout)
+{
+	__ASSERT(!arch_is_in_isr() || K_TIMEOUT_EQ(timeout, K_NO_WAIT), "");
+
+	char *dst = data;
+	struct k_thread *pending_thread;
+	k_spinlock_key_t key;
+	uint32_t count = 0U;
+	bool resched = false;
+	int result;
+
+	if (num_msgs == 0U) {
+		return -EINVAL;
+	}
+
+#ifdef CONFIG_MSGQ_LOCKFREE
+	if (msgq_is_lockfree(msgq)) {
+		SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, get, msgq, timeout);
+		result = lockfree_get_batch(msgq, dst, num_msgs, timeout);
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, get, msgq, timeout, result);
+
+		return result;
+	}
+#endif /* CONFIG_MSGQ_LOCKFREE */
+
+	key = k_spin_lock(&msgq->lock);
+
+	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_msgq, get, msgq, timeout);
+
+	while ((count < num_msgs) && (msgq->used_msgs > 0U)) {
+		(void)memcpy(dst, msgq->read_ptr, msgq->msg_size);
+		msgq->read_ptr += msgq->msg_size;
+		if (msgq->read_ptr == msgq->buffer_end) {
+			msgq->read_ptr = msgq->buffer_start;
+		}
+		msgq->used_msgs--;
+		dst += msgq->msg_size;
+		count++;
+
+		/* refill the freed slot from the first waiting writer (if any) */
+		pending_thread = z_unpend_first_thread(&msgq->wait_q);
+		if (unlikely(pending_thread != NULL)) {
+			__ASSERT_NO_MSG(msgq->write_ptr >= msgq->buffer_start &&
+					msgq->write_ptr < msgq->buffer_end);
+			(void)memcpy(msgq->write_ptr, (char *)pending_thread->base.swap_data,
+			       msgq->msg_size);
+			msgq->write_ptr += msgq->msg_size;
+			if (msgq->write_ptr == msgq->buffer_end) {
+				msgq->write_ptr = msgq->buffer_start;
+			}
+			msgq->used_msgs++;
+
+			arch_thread_return_value_set(pending_thread, 0);
+			z_ready_thread(pending_thread);
+			resched = true;
+		}
+	}
+
+	if (count != 0U) {
+		result = (int)count;
+	} else if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+		result = -ENOMSG;
+	} else {
+		SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_msgq, get, msgq, timeout);
+
+		/* wait for the first message only */
+		_current->base.swap_data = data;
+
+		result = z_pend_curr(&msgq->lock, key, &msgq->wait_q, timeout);
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, get, msgq, timeout, result);
+
+		return (result == 0) ? 1 : result;
+	}
+
+	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_msgq, get, msgq, timeout, result);
+
+	if (resched) {
+		z_reschedule(&msgq->lock, key);
+	} else {
+		k_spin_unlock(&msgq->lock, key);
+	}
+
+	return result;
+}
+
+#ifdef CONFIG_USERSPACE
+static inline int z_vrfy_k_msgq_put_batch(struct k_msgq *msgq, const void *data,
+					  uint32_t num_msgs, k_timeout_t timeout)
+{
+	size_t size;
+
+	K_OOPS(K_SYSCALL_OBJ(msgq, K_OBJ_MSGQ));
+	K_OOPS(K_SYSCALL_VERIFY(!size_mul_overflow(msgq->msg_size, num_msgs, &size)));
+	K_OOPS(K_SYSCALL_MEMORY_READ(data, size));
+
+	return z_impl_k_msgq_put_batch(msgq, data, num_msgs, timeout);
+}
+#include <zephyr/syscalls/k_msgq_put_batch_mrsh.c>
+
+static inline int z_vrfy_k_msgq_get_batch(struct k_msgq *msgq, void *data,
+					  uint32_t num_msgs, k_timeout_t timeout)
+{
+	size_t size;
+
+	K_OOPS(K_SYSCALL_OBJ(msgq, K_OBJ_MSGQ));
+	K_OOPS(K_SYSCALL_VERIFY(!size_mul_overflow(msgq->msg_size, num_msgs, &size)));
+	K_OOPS(K_SYSCALL_MEMORY_WRITE(data, size));
+
+	return z_impl_k_msgq_get_batch(msgq, data, num_msgs, timeout);
+}
+#include <zephyr/syscalls/k_msgq_get_batch_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
 int z_impl_k_msgq_peek(struct k_msgq *msgq, void *data)
 {
 	k_spinlock_key_t key;
 	int result;
 
+#ifdef CONFIG_MSGQ_LOCKFREE
+	if (msgq_is_lockfree(msgq)) {
+		return -ENOTSUP;
+	}
+#endif /* CONFIG_MSGQ_LOCKFREE */
+
 	key = k_spin_lock(&msgq->lock);
 
 	if (msgq->used_msgs > 0U) {
@@ -396,6 +818,12 @@ int z_impl_k_msgq_peek_at(struct k_msgq *msgq, void *data, uint32_t idx)
 	uint32_t byte_offset;
 	char *start_addr;
 
+#ifdef CONFIG_MSGQ_LOCKFREE
+	if (msgq_is_lockfree(msgq)) {
+		return -ENOTSUP;
+	}
+#endif /* CONFIG_MSGQ_LOCKFREE */
+
 	key = k_spin_lock(&msgq->lock);
 
 	if (msgq->used_msgs > idx) {
@@ -456,6 +884,15 @@ void z_impl_k_msgq_purge(struct k_msgq *msgq)
 	msgq->used_msgs = 0;
 	msgq->read_ptr = msgq->write_ptr;
 
+#ifdef CONFIG_MSGQ_LOCKFREE
+	if (msgq_is_lockfree(msgq)) {
+		/* writers running meanwhile may add messages after these */
+		while (mpmc_pop(&msgq->ring, NULL)) {
+			/* drop the message */
+		}
+	}
+#endif /* CONFIG_MSGQ_LOCKFREE */
+
 	if (resched) {
 		z_reschedule(&msgq->lock, key);
 	} else {
@@ -56,6 +56,9 @@ int z_impl_k_mutex_init(struct k_mutex *mutex)
 {
 	mutex->owner = NULL;
 	mutex->lock_count = 0U;
+#ifdef CONFIG_SYNC_ADAPTIVE_SPIN
+	mutex->spin_stats = (struct k_adaptive_spin_stats){0};
+#endif
 
 	z_waitq_init(&mutex->wait_q);
 
@@ -102,6 +105,55 @@ static bool adjust_owner_prio(struct k_mutex *mutex, int32_t new_prio)
 	return false;
 }
 
+#ifdef CONFIG_SYNC_ADAPTIVE_SPIN
+/* While the owner runs on another CPU, it is likely to unlock before we
+ * would be done pending: spin for a while instead. The spin reads the
+ * mutex without the lock, shared by all mutexes, which is only taken
+ * again to claim it. Called and returns with the lock held; true if the
+ * mutex was released meanwhile.
+ */
+static bool mutex_spin(struct k_mutex *mutex, k_spinlock_key_t *key, k_timeout_t timeout)
+{
+	volatile struct k_mutex *vmutex = mutex;
+	uint32_t limit = z_adaptive_spin_cyc(timeout);
+	uint32_t start = k_cycle_get_32();
+	bool released;
+
+	if ((limit == 0U) || !z_thread_is_running(mutex->owner)) {
+		return false;
+	}
+
+	k_spin_unlock(&lock, *key);
+
+	do {
+		arch_spin_relax();
+		released = (vmutex->lock_count == 0U);
+	} while (!released && z_thread_is_running(vmutex->owner) &&
+		 ((k_cycle_get_32() - start) < limit));
+
+	*key = k_spin_lock(&lock);
+
+	/* Another waiter may have claimed it first */
+	if (mutex->lock_count == 0U) {
+		mutex->spin_stats.success++;
+		return true;
+	}
+
+	mutex->spin_stats.failure++;
+
+	return false;
+}
+#else
+static inline bool mutex_spin(struct k_mutex *mutex, k_spinlock_key_t *key, k_timeout_t timeout)
+{
+	ARG_UNUSED(mutex);
+	ARG_UNUSED(key);
+	ARG_UNUSED(timeout);
+
+	return false;
+}
+#endif /* CONFIG_SYNC_ADAPTIVE_SPIN */
+
 int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 {
 	int new_prio;
@@ -114,7 +166,8 @@ int z_impl_k_mutex_lock(struct k_mutex *mutex, k_timeout_t timeout)
 
 	key = k_spin_lock(&lock);
 
-	if (likely((mutex->lock_count == 0U) || (mutex->owner == _current))) {
+	if (likely((mutex->lock_count == 0U) || (mutex->owner == _current)) ||
+	    (!K_TIMEOUT_EQ(timeout, K_NO_WAIT) && mutex_spin(mutex, &key, timeout))) {
 
 		mutex->owner_orig_prio = (mutex->lock_count == 0U) ?
 					_current->base.prio :
@@ -34,6 +34,16 @@ static inline bool pipe_empty(struct k_pipe *pipe)
 	return ring_buf_is_empty(&pipe->buf);
 }
 
+static inline bool pipe_write_claimed(struct k_pipe *pipe)
+{
+	return (pipe->flags & PIPE_FLAG_WRITE_CLAIM) != 0;
+}
+
+static inline bool pipe_read_claimed(struct k_pipe *pipe)
+{
+	return (pipe->flags & PIPE_FLAG_READ_CLAIM) != 0;
+}
+
 static int wait_for(_wait_q_t *waitq, struct k_pipe *pipe, k_spinlock_key_t *key,
 		    k_timepoint_t time_limit, bool *need_resched)
 {
@@ -165,7 +175,11 @@ int z_impl_k_pipe_write(struct k_pipe *pipe, const uint8_t *data, size_t len, k_
 			break;
 		}
 
-		if (pipe_empty(pipe)) {
+		/*
+		 * Data claimed for writing or reading is not accounted for
+		 * as data in the buffer: don't let later data overtake it.
+		 */
+		if (pipe_empty(pipe) && !pipe_write_claimed(pipe) && !pipe_read_claimed(pipe)) {
 			if (IS_ENABLED(CONFIG_KERNEL_COHERENCE)) {
 				/*
 				 * Systems that enabled this option don't have
@@ -193,10 +207,13 @@ int z_impl_k_pipe_write(struct k_pipe *pipe, const uint8_t *data, size_t len, k_
 							 K_POLL_STATE_PIPE_DATA_AVAILABLE);
 #endif /* CONFIG_POLL */
 
-		written += ring_buf_put(&pipe->buf, &data[written], len - written);
-		if (likely(written == len)) {
-			rc = written;
-			break;
+		/* An outstanding claim is waited for like missing space */
+		if (likely(!pipe_write_claimed(pipe))) {
+			written += ring_buf_put(&pipe->buf, &data[written], len - written);
+			if (likely(written == len)) {
+				rc = written;
+				break;
+			}
 		}
 
 		rc = wait_for(&pipe->space, pipe, &key, end, &need_resched);
@@ -238,10 +255,13 @@ int z_impl_k_pipe_read(struct k_pipe *pipe, uint8_t *data, size_t len, k_timeout
 			need_resched = z_sched_wake_all(&pipe->space, 0, NULL);
 		}
 
-		buf.used += ring_buf_get(&pipe->buf, &data[buf.used], len - buf.used);
-		if (likely(buf.used == len)) {
-			rc = buf.used;
-			break;
+		/* An outstanding claim is waited for like missing data */
+		if (likely(!pipe_read_claimed(pipe))) {
+			buf.used += ring_buf_get(&pipe->buf, &data[buf.used], len - buf.used);
+			if (likely(buf.used == len)) {
+				rc = buf.used;
+				break;
+			}
 		}
 
 		if (unlikely(pipe_closed(pipe))) {
@@ -270,11 +290,182 @@ exit:
 	return rc;
 }
 
+int z_impl_k_pipe_write_claim(struct k_pipe *pipe, uint8_t **data, size_t len,
+			      k_timeout_t timeout)
+{
+	int rc;
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	k_spinlock_key_t key;
+	bool need_resched = false;
+
+	if (unlikely(len == 0)) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&pipe->lock);
+
+	if (unlikely(pipe_resetting(pipe))) {
+		rc = -ECANCELED;
+		goto exit;
+	}
+
+	for (;;) {
+		if (unlikely(pipe_closed(pipe))) {
+			rc = -EPIPE;
+			break;
+		}
+
+		if (unlikely(pipe_write_claimed(pipe))) {
+			rc = -EBUSY;
+			break;
+		}
+
+		rc = ring_buf_put_claim(&pipe->buf, data, MIN(len, UINT32_MAX));
+		if (likely(rc > 0)) {
+			pipe->flags |= PIPE_FLAG_WRITE_CLAIM;
+			break;
+		}
+
+		rc = wait_for(&pipe->space, pipe, &key, end, &need_resched);
+		if (rc != 0) {
+			break;
+		}
+	}
+exit:
+	k_spin_unlock(&pipe->lock, key);
+	return rc;
+}
+
+int z_impl_k_pipe_write_commit(struct k_pipe *pipe, size_t len)
+{
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+	bool need_resched = false;
+	int rc;
+
+	if (unlikely(!pipe_write_claimed(pipe)) || unlikely(len > UINT32_MAX)) {
+		rc = -EINVAL;
+		goto exit;
+	}
+
+	rc = ring_buf_put_finish(&pipe->buf, len);
+	if (unlikely(rc != 0)) {
+		goto exit;
+	}
+	pipe->flags &= ~PIPE_FLAG_WRITE_CLAIM;
+
+	if (len != 0) {
+		/* Readers, pending ones included, pick up the data from the buffer */
+		need_resched = z_sched_wake_all(&pipe->data, 0, NULL);
+#ifdef CONFIG_POLL
+		need_resched |= z_handle_obj_poll_events(&pipe->poll_events,
+							 K_POLL_STATE_PIPE_DATA_AVAILABLE);
+#endif /* CONFIG_POLL */
+	}
+
+	if (!pipe_full(pipe)) {
+		/* Writers may have been waiting for the claim to be released */
+		need_resched |= z_sched_wake_all(&pipe->space, 0, NULL);
+	}
+exit:
+	if (need_resched) {
+		z_reschedule(&pipe->lock, key);
+	} else {
+		k_spin_unlock(&pipe->lock, key);
+	}
+	return rc;
+}
+
+int z_impl_k_pipe_read_claim(struct k_pipe *pipe, uint8_t **data, size_t len,
+			     k_timeout_t timeout)
+{
+	/* Writers wake us up without copying anything, we claim from the buffer */
+	struct pipe_buf_spec buf = { pipe->buf.buffer, 0, 0 };
+	int rc;
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	k_spinlock_key_t key;
+	bool need_resched = false;
+
+	if (unlikely(len == 0)) {
+		return -EINVAL;
+	}
+
+	key = k_spin_lock(&pipe->lock);
+
+	if (unlikely(pipe_resetting(pipe))) {
+		rc = -ECANCELED;
+		goto exit;
+	}
+
+	for (;;) {
+		if (unlikely(pipe_read_claimed(pipe))) {
+			rc = -EBUSY;
+			break;
+		}
+
+		rc = ring_buf_get_claim(&pipe->buf, data, MIN(len, UINT32_MAX));
+		if (likely(rc > 0)) {
+			pipe->flags |= PIPE_FLAG_READ_CLAIM;
+			break;
+		}
+
+		if (unlikely(pipe_closed(pipe))) {
+			rc = -EPIPE;
+			break;
+		}
+
+		_current->base.swap_data = &buf;
+
+		rc = wait_for(&pipe->data, pipe, &key, end, &need_resched);
+		if (rc != 0) {
+			break;
+		}
+	}
+exit:
+	k_spin_unlock(&pipe->lock, key);
+	return rc;
+}
+
+int z_impl_k_pipe_read_commit(struct k_pipe *pipe, size_t len)
+{
+	k_spinlock_key_t key = k_spin_lock(&pipe->lock);
+	bool need_resched = false;
+	int rc;
+
+	if (unlikely(!pipe_read_claimed(pipe)) || unlikely(len > UINT32_MAX)) {
+		rc = -EINVAL;
+		goto exit;
+	}
+
+	rc = ring_buf_get_finish(&pipe->buf, len);
+	if (unlikely(rc != 0)) {
+		goto exit;
+	}
+	pipe->flags &= ~PIPE_FLAG_READ_CLAIM;
+
+	if (len != 0) {
+		/* One or more pending writers may exist. */
+		need_resched = z_sched_wake_all(&pipe->space, 0, NULL);
+	}
+
+	if (!pipe_empty(pipe)) {
+		/* Readers may have been waiting for the claim to be released */
+		need_resched |= z_sched_wake_all(&pipe->data, 0, NULL);
+	}
+exit:
+	if (need_resched) {
+		z_reschedule(&pipe->lock, key);
+	} else {
+		k_spin_unlock(&pipe->lock, key);
+	}
+	return rc;
+}
+
 void z_impl_k_pipe_reset(struct k_pipe *pipe)
 {
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_pipe, reset, pipe);
 	K_SPINLOCK(&pipe->lock) {
 		ring_buf_reset(&pipe->buf);
+		pipe->flags &= ~(PIPE_FLAG_WRITE_CLAIM | PIPE_FLAG_READ_CLAIM);
 		if (likely(pipe->waiting != 0)) {
 			pipe->flags |= PIPE_FLAG_RESET;
 			z_sched_wake_all(&pipe->data, 0, NULL);
@@ -288,7 +479,11 @@ void z_impl_k_pipe_close(struct k_pipe *pipe)
 {
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_pipe, close, pipe);
 	K_SPINLOCK(&pipe->lock) {
-		pipe->flags = 0;
+		/* Unwritten data is dropped, the rest can still be read */
+		if (pipe_write_claimed(pipe)) {
+			(void)ring_buf_put_finish(&pipe->buf, 0);
+		}
+		pipe->flags &= PIPE_FLAG_READ_CLAIM;
 		z_sched_wake_all(&pipe->data, 0, NULL);
 		z_sched_wake_all(&pipe->space, 0, NULL);
 	}
@@ -323,6 +518,46 @@ int z_vrfy_k_pipe_write(struct k_pipe *pipe, const uint8_t *data, size_t len, k_
 }
 #include <zephyr/syscalls/k_pipe_write_mrsh.c>
 
+int z_vrfy_k_pipe_write_claim(struct k_pipe *pipe, uint8_t **data, size_t len,
+			      k_timeout_t timeout)
+{
+	K_OOPS(K_SYSCALL_OBJ(pipe, K_OBJ_PIPE));
+	K_OOPS(K_SYSCALL_MEMORY_WRITE(data, sizeof(*data)));
+	/* The caller gets to write to the pipe storage directly */
+	K_OOPS(K_SYSCALL_MEMORY_WRITE(pipe->buf.buffer, pipe->buf.size));
+
+	return z_impl_k_pipe_write_claim(pipe, data, len, timeout);
+}
+#include <zephyr/syscalls/k_pipe_write_claim_mrsh.c>
+
+int z_vrfy_k_pipe_write_commit(struct k_pipe *pipe, size_t len)
+{
+	K_OOPS(K_SYSCALL_OBJ(pipe, K_OBJ_PIPE));
+
+	return z_impl_k_pipe_write_commit(pipe, len);
+}
+#include <zephyr/syscalls/k_pipe_write_commit_mrsh.c>
+
+int z_vrfy_k_pipe_read_claim(struct k_pipe *pipe, uint8_t **data, size_t len,
+			     k_timeout_t timeout)
+{
+	K_OOPS(K_SYSCALL_OBJ(pipe, K_OBJ_PIPE));
+	K_OOPS(K_SYSCALL_MEMORY_WRITE(data, sizeof(*data)));
+	/* The caller gets to read from the pipe storage directly */
+	K_OOPS(K_SYSCALL_MEMORY_READ(pipe->buf.buffer, pipe->buf.size));
+
+	return z_impl_k_pipe_read_claim(pipe, data, len, timeout);
+}
+#include <zephyr/syscalls/k_pipe_read_claim_mrsh.c>
+
+int z_vrfy_k_pipe_read_commit(struct k_pipe *pipe, size_t len)
+{
+	K_OOPS(K_SYSCALL_OBJ(pipe, K_OBJ_PIPE));
+
+	return z_impl_k_pipe_read_commit(pipe, len);
+}
+#include <zephyr/syscalls/k_pipe_read_commit_mrsh.c>
+
 void z_vrfy_k_pipe_reset(struct k_pipe *pipe)
 {
 	K_OOPS(K_SYSCALL_OBJ(pipe, K_OBJ_PIPE));
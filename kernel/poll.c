@@ -24,6 +24,7 @@
 #include <zephyr/sys/dlist.h>
 #include <zephyr/sys/util.h>
 #include <zephyr/sys/__assert.h>
+#include <zephyr/sys/barrier.h>
 #include <stdbool.h>
 
 /* Single subsystem lock.  Locking per-event would be better on highly
@@ -35,9 +36,10 @@
  */
 static struct k_spinlock lock;
 
-enum POLL_MODE { MODE_NONE, MODE_POLL, MODE_TRIGGERED };
+enum POLL_MODE { MODE_NONE, MODE_POLL, MODE_TRIGGERED, MODE_SET };
 
 static int signal_poller(struct k_poll_event *event, uint32_t state);
+static int signal_poll_event(struct k_poll_event *event, uint32_t state);
 static int signal_triggered_work(struct k_poll_event *event, uint32_t status);
 
 void k_poll_event_init(struct k_poll_event *event, uint32_t type,
@@ -53,6 +55,7 @@ void k_poll_event_init(struct k_poll_event *event, uint32_t type,
 	event->type = type;
 	event->state = K_POLL_STATE_NOT_READY;
 	event->mode = mode;
+	event->edge = 0U;
 	event->unused = 0U;
 	event->obj = obj;
 
@@ -82,7 +85,7 @@ static inline bool is_condition_met(struct k_poll_event *event, uint32_t *state)
 		}
 		break;
 	case K_POLL_TYPE_MSGQ_DATA_AVAILABLE:
-		if (event->msgq->used_msgs > 0) {
+		if (z_impl_k_msgq_num_used_get(event->msgq) > 0U) {
 			*state = K_POLL_STATE_MSGQ_DATA_AVAILABLE;
 			return true;
 		}
@@ -112,6 +115,19 @@ static struct k_thread *poller_thread(struct z_poller *p)
 	return p ? CONTAINER_OF(p, struct k_thread, poller) : NULL;
 }
 
+/* Poll sets have no priority of their own: rank them below any thread */
+static int poller_prio_cmp(struct z_poller *a, struct z_poller *b)
+{
+	bool a_set = (a->mode == MODE_SET);
+	bool b_set = (b->mode == MODE_SET);
+
+	if (a_set || b_set) {
+		return (int)b_set - (int)a_set;
+	}
+
+	return z_sched_prio_cmp(poller_thread(a), poller_thread(b));
+}
+
 static inline void add_event(sys_dlist_t *events, struct k_poll_event *event,
 			     struct z_poller *poller)
 {
@@ -119,15 +135,13 @@ static inline void add_event(sys_dlist_t *events, struct k_poll_event *event,
 
 	pending = (struct k_poll_event *)sys_dlist_peek_tail(events);
 	if ((pending == NULL) ||
-		(z_sched_prio_cmp(poller_thread(pending->poller),
-							   poller_thread(poller)) > 0)) {
+	    (poller_prio_cmp(pending->poller, poller) > 0)) {
 		sys_dlist_append(events, &event->_node);
 		return;
 	}
 
 	SYS_DLIST_FOR_EACH_CONTAINER(events, pending, _node) {
-		if (z_sched_prio_cmp(poller_thread(poller),
-					poller_thread(pending->poller)) > 0) {
+		if (poller_prio_cmp(poller, pending->poller) > 0) {
 			sys_dlist_insert(&pending->_node, &event->_node);
 			return;
 		}
@@ -170,6 +184,24 @@ static inline void register_event(struct k_poll_event *event,
 	}
 
 	event->poller = poller;
+
+#ifdef CONFIG_MSGQ_LOCKFREE
+	uint32_t state;
+
+	/*
+	 * A lockfree message queue is written without its lock, and only
+	 * looks for pollers after the message is in: check it again now
+	 * that the event can be seen, as if the message came just now.
+	 */
+	if ((event->type == K_POLL_TYPE_MSGQ_DATA_AVAILABLE) && (event->edge == 0U) &&
+	    ((event->msgq->flags & K_MSGQ_FLAG_LOCKFREE) != 0U)) {
+		barrier_dmem_fence_full();
+		if (is_condition_met(event, &state)) {
+			sys_dlist_remove(&event->_node);
+			(void)signal_poll_event(event, state);
+		}
+	}
+#endif /* CONFIG_MSGQ_LOCKFREE */
 }
 
 /* must be called with interrupts locked */
@@ -440,6 +472,17 @@ static int signal_poll_event(struct k_poll_event *event, uint32_t state)
 	struct z_poller *poller = event->poller;
 	int retcode = 0;
 
+	if ((poller != NULL) && (poller->mode == MODE_SET)) {
+		struct k_poll_set *set =
+			CONTAINER_OF(poller, struct k_poll_set, poller);
+
+		/* The event stays owned by the set until it is removed */
+		event->state |= state;
+		sys_dlist_append(&set->ready, &event->_node);
+		(void)z_sched_wake(&set->wait_q, 0, NULL);
+		return 0;
+	}
+
 	if (poller != NULL) {
 		if (poller->mode == MODE_POLL) {
 			retcode = signal_poller(event, state);
@@ -812,3 +855,114 @@ int k_work_poll_cancel(struct k_work_poll *work)
 
 	return retval;
 }
+
+void k_poll_set_init(struct k_poll_set *set)
+{
+	set->poller.is_polling = false;
+	set->poller.mode = MODE_SET;
+	z_waitq_init(&set->wait_q);
+	sys_dlist_init(&set->ready);
+	sys_dlist_init(&set->reported);
+}
+
+/* must be called with interrupts locked */
+static void set_event_arm(struct k_poll_set *set, struct k_poll_event *event)
+{
+	uint32_t state;
+
+	event->state = K_POLL_STATE_NOT_READY;
+
+	if ((event->edge == 0U) && is_condition_met(event, &state)) {
+		event->state = state;
+		sys_dlist_append(&set->ready, &event->_node);
+		(void)z_sched_wake(&set->wait_q, 0, NULL);
+	} else {
+		register_event(event, &set->poller);
+	}
+}
+
+int k_poll_set_add(struct k_poll_set *set, struct k_poll_event *event,
+		   uint32_t flags)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	if (event->poller != NULL) {
+		k_spin_unlock(&lock, key);
+		return -EBUSY;
+	}
+
+	event->poller = &set->poller;
+	event->edge = ((flags & K_POLL_SET_EDGE) != 0U) ? 1U : 0U;
+
+	if (event->edge != 0U) {
+		event->state = K_POLL_STATE_NOT_READY;
+		register_event(event, &set->poller);
+	} else {
+		set_event_arm(set, event);
+	}
+
+	z_reschedule(&lock, key);
+
+	return 0;
+}
+
+int k_poll_set_remove(struct k_poll_set *set, struct k_poll_event *event)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	if (event->poller != &set->poller) {
+		k_spin_unlock(&lock, key);
+		return -EINVAL;
+	}
+
+	/* The node is on the object's list, or on one of the set's lists */
+	if (sys_dnode_is_linked(&event->_node)) {
+		sys_dlist_remove(&event->_node);
+	}
+	event->poller = NULL;
+
+	k_spin_unlock(&lock, key);
+
+	return 0;
+}
+
+int k_poll_set_wait(struct k_poll_set *set, struct k_poll_event **events,
+		    int max_events, k_timeout_t timeout)
+{
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	struct k_poll_event *event;
+	k_spinlock_key_t key;
+	int count = 0;
+
+	__ASSERT(!arch_is_in_isr(), "");
+	__ASSERT((events != NULL) && (max_events > 0), "no room for events\n");
+
+	key = k_spin_lock(&lock);
+
+	/* Re-arm what the previous wait handed out */
+	while ((event = (struct k_poll_event *)sys_dlist_get(&set->reported)) != NULL) {
+		set_event_arm(set, event);
+	}
+
+	while (sys_dlist_is_empty(&set->ready)) {
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			k_spin_unlock(&lock, key);
+			return -EAGAIN;
+		}
+
+		(void)z_pend_curr(&lock, key, &set->wait_q, timeout);
+
+		key = k_spin_lock(&lock);
+		timeout = sys_timepoint_timeout(end);
+	}
+
+	while ((count < max_events) &&
+	       ((event = (struct k_poll_event *)sys_dlist_get(&set->ready)) != NULL)) {
+		sys_dlist_append(&set->reported, &event->_node);
+		events[count++] = event;
+	}
+
+	k_spin_unlock(&lock, key);
+
+	return count;
+}
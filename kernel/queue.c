@@ -369,6 +369,21 @@ void *z_impl_k_queue_get(struct k_queue *queue, k_timeout_t timeout)
 	return (ret != 0) ? NULL : _current->base.swap_data;
 }
 
+size_t k_queue_get_multi(struct k_queue *queue, void **data, size_t max)
+{
+	k_spinlock_key_t key = k_spin_lock(&queue->lock);
+	size_t n = 0;
+
+	while ((n < max) && !sys_sflist_is_empty(&queue->data_q)) {
+		data[n] = z_queue_node_peek(sys_sflist_get_not_empty(&queue->data_q), true);
+		n++;
+	}
+
+	k_spin_unlock(&queue->lock, key);
+
+	return n;
+}
+
 bool k_queue_remove(struct k_queue *queue, void *data)
 {
 	SYS_PORT_TRACING_OBJ_FUNC_ENTER(k_queue, remove, queue);
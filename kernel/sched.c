@@ -59,6 +59,8 @@ static ALWAYS_INLINE void *thread_runq(struct k_thread *thread)
 	cpu = m == 0 ? 0 : u32_count_trailing_zeros(m);
 
 	return &_kernel.cpus[cpu].ready_q.runq;
+#elif defined(CONFIG_SCHED_CPU_RUNQ)
+	return &_kernel.cpus[thread->base.runq_cpu].ready_q.runq;
 #else
 	ARG_UNUSED(thread);
 	return &_kernel.ready_q.runq;
@@ -67,35 +69,163 @@ static ALWAYS_INLINE void *thread_runq(struct k_thread *thread)
 
 static ALWAYS_INLINE void *curr_cpu_runq(void)
 {
-#ifdef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#if defined(CONFIG_SCHED_CPU_MASK_PIN_ONLY) || defined(CONFIG_SCHED_CPU_RUNQ)
 	return &arch_curr_cpu()->ready_q.runq;
 #else
 	return &_kernel.ready_q.runq;
-#endif /* CONFIG_SCHED_CPU_MASK_PIN_ONLY */
+#endif /* CONFIG_SCHED_CPU_MASK_PIN_ONLY || CONFIG_SCHED_CPU_RUNQ */
 }
 
+#ifdef CONFIG_SCHED_CPU_RUNQ
+BUILD_ASSERT(CONFIG_MP_MAX_NUM_CPUS <= 32, "CPUs are tracked in a 32-bit mask");
+
+/* Each CPU publishes the priority of the best thread of its ready queue,
+ * so that other CPUs only look into it when it holds something better
+ * than their own best thread.  Like the queues themselves, this is
+ * protected by _sched_spinlock: per-queue locks nested in it would only
+ * add lock round trips, as every thread state change needs the global
+ * lock anyway.
+ */
+static int runq_best_prio[CONFIG_MP_MAX_NUM_CPUS];
+
+/* CPUs whose ready queue is not empty */
+static uint32_t runq_ready_cpus;
+
+/* Must be called with _sched_spinlock held */
+static ALWAYS_INLINE void runq_update_hint(unsigned int cpu)
+{
+	struct k_thread *best = _priq_run_best(&_kernel.cpus[cpu].ready_q.runq);
+
+	if (best != NULL) {
+		runq_best_prio[cpu] = best->base.prio;
+		runq_ready_cpus |= BIT(cpu);
+	} else {
+		runq_ready_cpus &= ~BIT(cpu);
+	}
+}
+
+static ALWAYS_INLINE bool thread_may_run_on(struct k_thread *thread, unsigned int cpu)
+{
+#ifdef CONFIG_SCHED_CPU_MASK
+	return (thread->base.cpu_mask & BIT(cpu)) != 0;
+#else
+	ARG_UNUSED(thread);
+	ARG_UNUSED(cpu);
+	return true;
+#endif /* CONFIG_SCHED_CPU_MASK */
+}
+
+/* Chooses the CPU whose ready queue a thread joins: the one it last ran
+ * on if that CPU would switch to it right away (its caches are likely
+ * still warm), else the CPU making it runnable, else any CPU it is
+ * allowed on.  Other CPUs may still steal it in runq_best().
+ */
+static ALWAYS_INLINE unsigned int runq_home_cpu(struct k_thread *thread)
+{
+	unsigned int cpu = thread->base.cpu;
+
+	if ((cpu < arch_num_cpus()) && thread_may_run_on(thread, cpu)) {
+		struct k_thread *curr = _kernel.cpus[cpu].current;
+
+		if ((curr == NULL) || (curr == thread) ||
+		    z_is_idle_thread_object(curr) ||
+		    (z_sched_prio_cmp(thread, curr) > 0)) {
+			return cpu;
+		}
+	}
+
+	cpu = _current_cpu->id;
+	if (thread_may_run_on(thread, cpu)) {
+		return cpu;
+	}
+
+#ifdef CONFIG_SCHED_CPU_MASK
+	/* Threads with an empty mask can't run anywhere, park them on 0 */
+	if (thread->base.cpu_mask != 0) {
+		cpu = u32_count_trailing_zeros(thread->base.cpu_mask);
+	} else {
+		cpu = 0;
+	}
+#endif /* CONFIG_SCHED_CPU_MASK */
+
+	return cpu;
+}
+
+/* Returns the best thread CPU id may run across all ready queues, given
+ * the best one from its own queue.  Only the queues whose hint beats that
+ * thread are looked into, CPUs with empty queues are skipped altogether.
+ * Ties stay local.
+ */
+static ALWAYS_INLINE struct k_thread *runq_steal(unsigned int id, struct k_thread *best)
+{
+	uint32_t cpus = runq_ready_cpus & ~BIT(id);
+
+	while (cpus != 0U) {
+		unsigned int i = u32_count_trailing_zeros(cpus);
+		struct k_thread *thread;
+
+		cpus &= cpus - 1U;
+
+		if ((best != NULL) && (runq_best_prio[i] > best->base.prio)) {
+			continue;
+		}
+
+		thread = _priq_run_best(&_kernel.cpus[i].ready_q.runq);
+
+		if ((thread != NULL) && thread_may_run_on(thread, id) &&
+		    ((best == NULL) || (z_sched_prio_cmp(thread, best) > 0))) {
+			best = thread;
+		}
+	}
+
+	return best;
+}
+#endif /* CONFIG_SCHED_CPU_RUNQ */
+
 static ALWAYS_INLINE void runq_add(struct k_thread *thread)
 {
 	__ASSERT_NO_MSG(!z_is_idle_thread_object(thread));
 
+#ifdef CONFIG_SCHED_CPU_RUNQ
+	unsigned int cpu = runq_home_cpu(thread);
+
+	thread->base.runq_cpu = cpu;
+	_priq_run_add(thread_runq(thread), thread);
+	runq_update_hint(cpu);
+#else
 	_priq_run_add(thread_runq(thread), thread);
+#endif /* CONFIG_SCHED_CPU_RUNQ */
 }
 
 static ALWAYS_INLINE void runq_remove(struct k_thread *thread)
 {
 	__ASSERT_NO_MSG(!z_is_idle_thread_object(thread));
 
+#ifdef CONFIG_SCHED_CPU_RUNQ
 	_priq_run_remove(thread_runq(thread), thread);
+	runq_update_hint(thread->base.runq_cpu);
+#else
+	_priq_run_remove(thread_runq(thread), thread);
+#endif /* CONFIG_SCHED_CPU_RUNQ */
 }
 
 static ALWAYS_INLINE void runq_yield(void)
 {
+#ifdef CONFIG_SCHED_CPU_RUNQ
+	_priq_run_yield(curr_cpu_runq());
+	runq_update_hint(_current_cpu->id);
+#else
 	_priq_run_yield(curr_cpu_runq());
+#endif /* CONFIG_SCHED_CPU_RUNQ */
 }
 
 static ALWAYS_INLINE struct k_thread *runq_best(void)
 {
+#ifdef CONFIG_SCHED_CPU_RUNQ
+	return runq_steal(_current_cpu->id, _priq_run_best(curr_cpu_runq()));
+#else
 	return _priq_run_best(curr_cpu_runq());
+#endif /* CONFIG_SCHED_CPU_RUNQ */
 }
 
 /* _current is never in the run queue until context switch on
@@ -335,6 +465,25 @@ static struct _cpu *thread_active_elsewhere(struct k_thread *thread)
 	return NULL;
 }
 
+#ifdef CONFIG_SYNC_ADAPTIVE_SPIN
+bool z_thread_is_running(struct k_thread *thread)
+{
+	/* Lockless, so the answer may be stale by the time it is used: it
+	 * is only a hint for adaptive spinning. It does not need _current_cpu
+	 * either, so the caller may be preempted and migrated meanwhile.
+	 */
+	unsigned int num_cpus = arch_num_cpus();
+
+	for (unsigned int i = 0; i < num_cpus; i++) {
+		if (*(struct k_thread *volatile *)&_kernel.cpus[i].current == thread) {
+			return true;
+		}
+	}
+
+	return false;
+}
+#endif /* CONFIG_SYNC_ADAPTIVE_SPIN */
+
 static void ready_thread(struct k_thread *thread)
 {
 #ifdef CONFIG_KERNEL_COHERENCE
@@ -349,6 +498,7 @@ static void ready_thread(struct k_thread *thread)
 
 		queue_thread(thread);
 		update_cache(0);
+		z_sched_usage_ready(thread);
 
 		flag_ipi(ipi_mask_create(thread));
 	}
@@ -957,13 +1107,13 @@ void init_ready_q(struct _ready_q *ready_q)
 
 void z_sched_init(void)
 {
-#ifdef CONFIG_SCHED_CPU_MASK_PIN_ONLY
+#if defined(CONFIG_SCHED_CPU_MASK_PIN_ONLY) || defined(CONFIG_SCHED_CPU_RUNQ)
 	for (int i = 0; i < CONFIG_MP_MAX_NUM_CPUS; i++) {
 		init_ready_q(&_kernel.cpus[i].ready_q);
 	}
 #else
 	init_ready_q(&_kernel.ready_q);
-#endif /* CONFIG_SCHED_CPU_MASK_PIN_ONLY */
+#endif /* CONFIG_SCHED_CPU_MASK_PIN_ONLY || CONFIG_SCHED_CPU_RUNQ */
 }
 
 void z_impl_k_thread_priority_set(k_tid_t thread, int prio)
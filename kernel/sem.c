@@ -56,6 +56,9 @@ int z_impl_k_sem_init(struct k_sem *sem, unsigned int initial_count,
 
 	sem->count = initial_count;
 	sem->limit = limit;
+#ifdef CONFIG_SYNC_ADAPTIVE_SPIN
+	sem->spin_stats = (struct k_adaptive_spin_stats){0};
+#endif
 
 	SYS_PORT_TRACING_OBJ_FUNC(k_sem, init, sem, 0);
 
@@ -129,6 +132,52 @@ static inline void z_vrfy_k_sem_give(struct k_sem *sem)
 #include <zephyr/syscalls/k_sem_give_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
+#ifdef CONFIG_SYNC_ADAPTIVE_SPIN
+/* A semaphore has no owner to watch: spin on one nobody pends on, the
+ * give is then likely to come from a thread running on another CPU. The
+ * spin reads the semaphore without the lock, shared by all semaphores,
+ * and for no longer than @p timeout. Called and returns with the lock
+ * held; true if the count went up meanwhile.
+ */
+static bool sem_spin(struct k_sem *sem, k_spinlock_key_t *key, k_timeout_t timeout)
+{
+	volatile struct k_sem *vsem = sem;
+	uint32_t limit = z_adaptive_spin_cyc(timeout);
+	uint32_t start = k_cycle_get_32();
+
+	if (arch_is_in_isr() || (limit == 0U) || (z_waitq_head(&sem->wait_q) != NULL)) {
+		return false;
+	}
+
+	k_spin_unlock(&lock, *key);
+
+	do {
+		arch_spin_relax();
+	} while ((vsem->count == 0U) && ((k_cycle_get_32() - start) < limit));
+
+	*key = k_spin_lock(&lock);
+
+	/* Another taker may have got it first */
+	if (sem->count > 0U) {
+		sem->spin_stats.success++;
+		return true;
+	}
+
+	sem->spin_stats.failure++;
+
+	return false;
+}
+#else
+static inline bool sem_spin(struct k_sem *sem, k_spinlock_key_t *key, k_timeout_t timeout)
+{
+	ARG_UNUSED(sem);
+	ARG_UNUSED(key);
+	ARG_UNUSED(timeout);
+
+	return false;
+}
+#endif /* CONFIG_SYNC_ADAPTIVE_SPIN */
+
 int z_impl_k_sem_take(struct k_sem *sem, k_timeout_t timeout)
 {
 	int ret;
@@ -153,6 +202,13 @@ int z_impl_k_sem_take(struct k_sem *sem, k_timeout_t timeout)
 		goto out;
 	}
 
+	if (sem_spin(sem, &key, timeout)) {
+		sem->count--;
+		k_spin_unlock(&lock, key);
+		ret = 0;
+		goto out;
+	}
+
 	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_sem, take, sem, timeout);
 
 	ret = z_pend_curr(&lock, key, &sem->wait_q, timeout);
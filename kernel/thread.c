@@ -928,6 +928,7 @@ void z_thread_mark_switched_in(void)
 void z_thread_mark_switched_out(void)
 {
 #if defined(CONFIG_SCHED_THREAD_USAGE) && !defined(CONFIG_USE_SWITCH)
+	z_sched_usage_switched_out(_current);
 	z_sched_usage_stop();
 #endif /*CONFIG_SCHED_THREAD_USAGE && !CONFIG_USE_SWITCH */
 
@@ -988,6 +989,12 @@ int k_thread_runtime_stats_all_get(k_thread_runtime_stats_t *stats)
 		stats->average_cycles   += tmp_stats.average_cycles;
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
 		stats->idle_cycles      += tmp_stats.idle_cycles;
+#ifdef CONFIG_SCHED_THREAD_LATENCY_STATS
+		for (int j = 0; j < CONFIG_SCHED_THREAD_LATENCY_STATS_BUCKETS; j++) {
+			stats->wakeup_latency[j]  += tmp_stats.wakeup_latency[j];
+			stats->preempt_latency[j] += tmp_stats.preempt_latency[j];
+		}
+#endif /* CONFIG_SCHED_THREAD_LATENCY_STATS */
 	}
 #endif /* CONFIG_SCHED_THREAD_USAGE_ALL */
 
@@ -0,0 +1,200 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/slist.h>
+
+/* States of a pool worker, changed with the pool lock held */
+enum pool_worker_state {
+	/* On the idle list */
+	POOL_WORKER_IDLE,
+	/* Handed out by k_thread_pool_spawn(), may be joined or detached */
+	POOL_WORKER_SPAWNED,
+	/* A thread is waiting in k_thread_pool_join() */
+	POOL_WORKER_JOINING,
+	/* Goes back to the pool by itself once its entry point returns */
+	POOL_WORKER_DETACHED,
+};
+
+static struct k_thread_pool_worker *pool_worker_get(struct k_thread_pool *pool, k_tid_t thread)
+{
+	struct k_thread_pool_worker *w;
+
+	if (thread == NULL) {
+		return NULL;
+	}
+
+	w = CONTAINER_OF(thread, struct k_thread_pool_worker, thread);
+	if ((w < pool->workers) || (w >= &pool->workers[pool->num_workers])) {
+		return NULL;
+	}
+
+	return w;
+}
+
+/* must be called with the pool locked, then followed by k_sem_give(&pool->available) */
+static void pool_worker_idle_locked(struct k_thread_pool *pool, struct k_thread_pool_worker *w)
+{
+	w->state = POOL_WORKER_IDLE;
+	sys_slist_prepend(&pool->idle, &w->node);
+}
+
+static void pool_worker_entry(void *p1, void *p2, void *p3)
+{
+	struct k_thread_pool *pool = p1;
+	struct k_thread_pool_worker *w = p2;
+	bool detached;
+
+	ARG_UNUSED(p3);
+
+	for (;;) {
+		(void)k_sem_take(&w->start, K_FOREVER);
+
+		w->entry(w->p1, w->p2, w->p3);
+
+		/* Don't compete at the job priority while parked in the pool */
+		k_thread_priority_set(&w->thread, pool->prio);
+
+		K_SPINLOCK(&pool->lock) {
+			detached = (w->state == POOL_WORKER_DETACHED);
+			if (detached) {
+				pool_worker_idle_locked(pool, w);
+			} else {
+				w->finished = true;
+			}
+		}
+
+		if (detached) {
+			k_sem_give(&pool->available);
+		} else {
+			k_sem_give(&w->done);
+		}
+	}
+}
+
+void k_thread_pool_start(struct k_thread_pool *pool, int prio)
+{
+	struct k_thread_pool_worker *w;
+
+	pool->prio = prio;
+	sys_slist_init(&pool->idle);
+	k_sem_init(&pool->available, pool->num_workers, pool->num_workers);
+
+	for (uint32_t i = 0; i < pool->num_workers; i++) {
+		w = &pool->workers[i];
+
+		k_sem_init(&w->start, 0, 1);
+		k_sem_init(&w->done, 0, 1);
+		w->state = POOL_WORKER_IDLE;
+		sys_slist_append(&pool->idle, &w->node);
+
+		k_thread_create(&w->thread, &pool->stacks[i * pool->stack_stride],
+				pool->stack_size, pool_worker_entry, pool, w, NULL,
+				prio, 0, K_NO_WAIT);
+		(void)k_thread_name_set(&w->thread, "thread_pool");
+	}
+}
+
+k_tid_t k_thread_pool_spawn(struct k_thread_pool *pool, k_thread_entry_t entry,
+			    void *p1, void *p2, void *p3, int prio, k_timeout_t timeout)
+{
+	struct k_thread_pool_worker *w = NULL;
+	sys_snode_t *node;
+
+	if (k_sem_take(&pool->available, timeout) != 0) {
+		return NULL;
+	}
+
+	K_SPINLOCK(&pool->lock) {
+		node = sys_slist_get_not_empty(&pool->idle);
+		w = CONTAINER_OF(node, struct k_thread_pool_worker, node);
+		w->state = POOL_WORKER_SPAWNED;
+		w->finished = false;
+	}
+
+	w->entry = entry;
+	w->p1 = p1;
+	w->p2 = p2;
+	w->p3 = p3;
+	k_sem_reset(&w->done);
+
+	k_thread_priority_set(&w->thread, prio);
+	k_sem_give(&w->start);
+
+	return &w->thread;
+}
+
+int k_thread_pool_join(struct k_thread_pool *pool, k_tid_t thread, k_timeout_t timeout)
+{
+	struct k_thread_pool_worker *w = pool_worker_get(pool, thread);
+	int ret = 0;
+
+	if (w == NULL) {
+		return -EINVAL;
+	}
+
+	K_SPINLOCK(&pool->lock) {
+		if (w->state != POOL_WORKER_SPAWNED) {
+			ret = -EINVAL;
+			K_SPINLOCK_BREAK;
+		}
+
+		w->state = POOL_WORKER_JOINING;
+	}
+
+	if (ret != 0) {
+		return ret;
+	}
+
+	ret = k_sem_take(&w->done, timeout);
+
+	K_SPINLOCK(&pool->lock) {
+		if (ret != 0) {
+			/* Still running: it may be joined or detached again */
+			w->state = POOL_WORKER_SPAWNED;
+		} else {
+			pool_worker_idle_locked(pool, w);
+		}
+	}
+
+	if (ret == 0) {
+		k_sem_give(&pool->available);
+	}
+
+	return ret;
+}
+
+int k_thread_pool_detach(struct k_thread_pool *pool, k_tid_t thread)
+{
+	struct k_thread_pool_worker *w = pool_worker_get(pool, thread);
+	bool finished = false;
+	int ret = 0;
+
+	if (w == NULL) {
+		return -EINVAL;
+	}
+
+	K_SPINLOCK(&pool->lock) {
+		if (w->state != POOL_WORKER_SPAWNED) {
+			ret = -EINVAL;
+			K_SPINLOCK_BREAK;
+		}
+
+		/* Otherwise the thread goes back to the pool by itself */
+		finished = w->finished;
+		if (finished) {
+			pool_worker_idle_locked(pool, w);
+		} else {
+			w->state = POOL_WORKER_DETACHED;
+		}
+	}
+
+	if (finished) {
+		k_sem_give(&pool->available);
+	}
+
+	return ret;
+}
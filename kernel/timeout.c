@@ -11,10 +11,13 @@
 #include <zephyr/internal/syscall_handler.h>
 #include <zephyr/drivers/timer/system_timer.h>
 #include <zephyr/sys_clock.h>
+#include <zephyr/sys/math_extras.h>
 
 static uint64_t curr_tick;
 
+#ifndef CONFIG_TIMEOUT_QUEUE_WHEEL
 static sys_dlist_t timeout_list = SYS_DLIST_STATIC_INIT(&timeout_list);
+#endif /* !CONFIG_TIMEOUT_QUEUE_WHEEL */
 
 /*
  * The timeout code shall take no locks other than its own (timeout_lock), nor
@@ -40,6 +43,159 @@ static inline unsigned int z_vrfy_sys_clock_hw_cycles_per_sec_runtime_get(void)
 #endif /* CONFIG_USERSPACE */
 #endif /* CONFIG_TIMER_READS_ITS_FREQUENCY_AT_RUNTIME */
 
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+
+/*
+ * Hierarchical timing wheel.  Each timeout stores its absolute expiry tick
+ * in dticks and lives in the slot of the lowest level whose slot span shares
+ * all higher-order tick bits with curr_tick, so every occupied slot lies
+ * strictly ahead of curr_tick on its level (level 0 may also hold entries
+ * due exactly at curr_tick).  When curr_tick reaches the start of an
+ * occupied coarse slot its entries are cascaded to the levels below.  Slot
+ * list heads are only valid while their occupancy bit is set, which keeps
+ * the (large) wheel array in .bss and avoids an init hook.
+ */
+#define WHEEL_SLOT_BITS 6
+#define WHEEL_SLOTS     BIT(WHEEL_SLOT_BITS)
+#define WHEEL_SLOT_MASK (WHEEL_SLOTS - 1U)
+#define WHEEL_LEVELS    CONFIG_TIMEOUT_WHEEL_LEVELS
+#define WHEEL_SPAN_BITS (WHEEL_LEVELS * WHEEL_SLOT_BITS)
+
+static sys_dlist_t wheel[WHEEL_LEVELS][WHEEL_SLOTS];
+static uint64_t wheel_occupied[WHEEL_LEVELS];
+
+/* Timeouts too far out for the top level */
+static sys_dlist_t wheel_overflow = SYS_DLIST_STATIC_INIT(&wheel_overflow);
+
+static void wheel_place(struct _timeout *t)
+{
+	uint64_t expiry = MAX((uint64_t)t->dticks, curr_tick);
+	uint64_t diff = expiry ^ curr_tick;
+	unsigned int lvl = 0U;
+	unsigned int slot;
+
+	if (diff != 0U) {
+		lvl = (63U - u64_count_leading_zeros(diff)) / WHEEL_SLOT_BITS;
+	}
+
+	if (lvl >= WHEEL_LEVELS) {
+		sys_dlist_append(&wheel_overflow, &t->node);
+		return;
+	}
+
+	slot = (expiry >> (lvl * WHEEL_SLOT_BITS)) & WHEEL_SLOT_MASK;
+	if ((wheel_occupied[lvl] & BIT64(slot)) == 0U) {
+		sys_dlist_init(&wheel[lvl][slot]);
+		wheel_occupied[lvl] |= BIT64(slot);
+	}
+	sys_dlist_append(&wheel[lvl][slot], &t->node);
+}
+
+static void remove_timeout(struct _timeout *t)
+{
+	sys_dnode_t *prev = t->node.prev;
+
+	/* If the neighbours coincide t was the only entry and prev is
+	 * the list head, whose occupancy bit must be dropped.
+	 */
+	bool last = (prev == t->node.next);
+
+	sys_dlist_remove(&t->node);
+
+	if (last && (prev != &wheel_overflow)) {
+		size_t idx = (sys_dlist_t *)prev - &wheel[0][0];
+
+		wheel_occupied[idx / WHEEL_SLOTS] &= ~BIT64(idx % WHEEL_SLOTS);
+	}
+}
+
+/* Absolute tick of the next slot needing attention, UINT64_MAX if none.
+ * Exact for level 0, a lower bound (the slot start) for coarser levels.
+ */
+static uint64_t wheel_next_event(void)
+{
+	for (unsigned int lvl = 0U; lvl < WHEEL_LEVELS; lvl++) {
+		unsigned int shift = lvl * WHEEL_SLOT_BITS;
+		unsigned int cur = (curr_tick >> shift) & WHEEL_SLOT_MASK;
+		uint64_t pending = wheel_occupied[lvl] & (UINT64_MAX << cur);
+
+		/* Everything on this level is due before the next slot of
+		 * the level above starts, so the lowest busy level wins.
+		 */
+		if (pending != 0U) {
+			uint64_t base = curr_tick & ~(BIT64(shift + WHEEL_SLOT_BITS) - 1U);
+			uint64_t at = base | ((uint64_t)u64_count_trailing_zeros(pending) << shift);
+
+			return MAX(at, curr_tick);
+		}
+	}
+
+	if (!sys_dlist_is_empty(&wheel_overflow)) {
+		return ((curr_tick >> WHEEL_SPAN_BITS) + 1U) << WHEEL_SPAN_BITS;
+	}
+
+	return UINT64_MAX;
+}
+
+static void wheel_requeue(sys_dlist_t *list)
+{
+	sys_dlist_t pending = SYS_DLIST_STATIC_INIT(&pending);
+	sys_dnode_t *node;
+
+	while ((node = sys_dlist_get(list)) != NULL) {
+		sys_dlist_append(&pending, node);
+	}
+
+	while ((node = sys_dlist_get(&pending)) != NULL) {
+		wheel_place(CONTAINER_OF(node, struct _timeout, node));
+	}
+}
+
+/* Move entries of coarse slots starting at curr_tick down the hierarchy */
+static void wheel_cascade(void)
+{
+	if (((curr_tick & (BIT64(WHEEL_SPAN_BITS) - 1U)) == 0U) &&
+	    !sys_dlist_is_empty(&wheel_overflow)) {
+		wheel_requeue(&wheel_overflow);
+	}
+
+	for (unsigned int lvl = WHEEL_LEVELS - 1U; lvl > 0U; lvl--) {
+		unsigned int shift = lvl * WHEEL_SLOT_BITS;
+		unsigned int slot = (curr_tick >> shift) & WHEEL_SLOT_MASK;
+
+		if (((curr_tick & (BIT64(shift) - 1U)) != 0U) ||
+		    ((wheel_occupied[lvl] & BIT64(slot)) == 0U)) {
+			continue;
+		}
+
+		/* Entries land strictly below this level, so the head stays
+		 * intact while it is drained.
+		 */
+		wheel_occupied[lvl] &= ~BIT64(slot);
+		for (sys_dnode_t *node = sys_dlist_get(&wheel[lvl][slot]);
+		     node != NULL; node = sys_dlist_get(&wheel[lvl][slot])) {
+			wheel_place(CONTAINER_OF(node, struct _timeout, node));
+		}
+	}
+}
+
+static struct _timeout *first_due(void)
+{
+	unsigned int slot = curr_tick & WHEEL_SLOT_MASK;
+	sys_dnode_t *t;
+
+	if ((wheel_occupied[0] & BIT64(slot)) == 0U) {
+		return NULL;
+	}
+
+	t = sys_dlist_peek_head(&wheel[0][slot]);
+	__ASSERT_NO_MSG((uint64_t)CONTAINER_OF(t, struct _timeout, node)->dticks <= curr_tick);
+
+	return CONTAINER_OF(t, struct _timeout, node);
+}
+
+#else
+
 static struct _timeout *first(void)
 {
 	sys_dnode_t *t = sys_dlist_peek_head(&timeout_list);
@@ -63,6 +219,8 @@ static void remove_timeout(struct _timeout *t)
 	sys_dlist_remove(&t->node);
 }
 
+#endif /* CONFIG_TIMEOUT_QUEUE_WHEEL */
+
 static int32_t elapsed(void)
 {
 	/* While sys_clock_announce() is executing, new relative timeouts will be
@@ -84,6 +242,51 @@ static int32_t elapsed(void)
 	return announce_remaining == 0 ? sys_clock_elapsed() : 0U;
 }
 
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+static int32_t next_timeout(int32_t ticks_elapsed)
+{
+	uint64_t next = wheel_next_event();
+	int32_t ret;
+
+	if ((next == UINT64_MAX) ||
+	    ((int64_t)(next - curr_tick) - ticks_elapsed > (int64_t)INT_MAX)) {
+		ret = MAX_WAIT;
+	} else {
+		ret = MAX(0, (int64_t)(next - curr_tick) - ticks_elapsed);
+	}
+
+	return ret;
+}
+
+/* Queues to, whose dticks holds its delta from curr_tick.  Returns true
+ * if the next expiry moved earlier.
+ */
+static bool insert_timeout(struct _timeout *to)
+{
+	uint64_t prev_next = wheel_next_event();
+
+	to->dticks += curr_tick;
+	wheel_place(to);
+
+	return wheel_next_event() != prev_next;
+}
+
+/* Dequeues to, returning true if the next expiry changed */
+static bool dequeue_timeout(struct _timeout *to)
+{
+	uint64_t prev_next = wheel_next_event();
+
+	remove_timeout(to);
+
+	return wheel_next_event() != prev_next;
+}
+
+/* must be locked */
+static k_ticks_t timeout_rem(const struct _timeout *timeout)
+{
+	return timeout->dticks - curr_tick;
+}
+#else
 static int32_t next_timeout(int32_t ticks_elapsed)
 {
 	struct _timeout *to = first();
@@ -99,6 +302,55 @@ static int32_t next_timeout(int32_t ticks_elapsed)
 	return ret;
 }
 
+/* Queues to, whose dticks holds its delta from curr_tick.  Returns true
+ * if it became the first timeout to expire.
+ */
+static bool insert_timeout(struct _timeout *to)
+{
+	struct _timeout *t;
+
+	for (t = first(); t != NULL; t = next(t)) {
+		if (t->dticks > to->dticks) {
+			t->dticks -= to->dticks;
+			sys_dlist_insert(&t->node, &to->node);
+			break;
+		}
+		to->dticks -= t->dticks;
+	}
+
+	if (t == NULL) {
+		sys_dlist_append(&timeout_list, &to->node);
+	}
+
+	return to == first();
+}
+
+/* Dequeues to, returning true if the next expiry changed */
+static bool dequeue_timeout(struct _timeout *to)
+{
+	bool is_first = (to == first());
+
+	remove_timeout(to);
+
+	return is_first;
+}
+
+/* must be locked */
+static k_ticks_t timeout_rem(const struct _timeout *timeout)
+{
+	k_ticks_t ticks = 0;
+
+	for (struct _timeout *t = first(); t != NULL; t = next(t)) {
+		ticks += t->dticks;
+		if (timeout == t) {
+			break;
+		}
+	}
+
+	return ticks;
+}
+#endif /* CONFIG_TIMEOUT_QUEUE_WHEEL */
+
 k_ticks_t z_add_timeout(struct _timeout *to, _timeout_func_t fn, k_timeout_t timeout)
 {
 	k_ticks_t ticks = 0;
@@ -115,7 +367,6 @@ k_ticks_t z_add_timeout(struct _timeout *to, _timeout_func_t fn, k_timeout_t tim
 	to->fn = fn;
 
 	K_SPINLOCK(&timeout_lock) {
-		struct _timeout *t;
 		int32_t ticks_elapsed;
 		bool has_elapsed = false;
 
@@ -131,20 +382,7 @@ k_ticks_t z_add_timeout(struct _timeout *to, _timeout_func_t fn, k_timeout_t tim
 			ticks = timeout.ticks;
 		}
 
-		for (t = first(); t != NULL; t = next(t)) {
-			if (t->dticks > to->dticks) {
-				t->dticks -= to->dticks;
-				sys_dlist_insert(&t->node, &to->node);
-				break;
-			}
-			to->dticks -= t->dticks;
-		}
-
-		if (t == NULL) {
-			sys_dlist_append(&timeout_list, &to->node);
-		}
-
-		if (to == first() && announce_remaining == 0) {
+		if (insert_timeout(to) && announce_remaining == 0) {
 			if (!has_elapsed) {
 				/* In case of absolute timeout that is first to expire
 				 * elapsed need to be read from the system clock.
@@ -164,9 +402,8 @@ int z_abort_timeout(struct _timeout *to)
 
 	K_SPINLOCK(&timeout_lock) {
 		if (sys_dnode_is_linked(&to->node)) {
-			bool is_first = (to == first());
+			bool is_first = dequeue_timeout(to);
 
-			remove_timeout(to);
 			to->dticks = TIMEOUT_DTICKS_ABORTED;
 			ret = 0;
 			if (is_first) {
@@ -178,21 +415,6 @@ int z_abort_timeout(struct _timeout *to)
 	return ret;
 }
 
-/* must be locked */
-static k_ticks_t timeout_rem(const struct _timeout *timeout)
-{
-	k_ticks_t ticks = 0;
-
-	for (struct _timeout *t = first(); t != NULL; t = next(t)) {
-		ticks += t->dticks;
-		if (timeout == t) {
-			break;
-		}
-	}
-
-	return ticks;
-}
-
 k_ticks_t z_timeout_remaining(const struct _timeout *timeout)
 {
 	k_ticks_t ticks = 0;
@@ -248,6 +470,28 @@ void sys_clock_announce(int32_t ticks)
 
 	announce_remaining = ticks;
 
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+	for (uint64_t next = wheel_next_event();
+	     (next != UINT64_MAX) && (next - curr_tick <= (uint64_t)announce_remaining);
+	     next = wheel_next_event()) {
+		int dt = next - curr_tick;
+		struct _timeout *t;
+
+		curr_tick = next;
+		wheel_cascade();
+
+		while ((t = first_due()) != NULL) {
+			t->dticks = 0;
+			remove_timeout(t);
+
+			k_spin_unlock(&timeout_lock, key);
+			t->fn(t);
+			key = k_spin_lock(&timeout_lock);
+		}
+
+		announce_remaining -= dt;
+	}
+#else
 	struct _timeout *t;
 
 	for (t = first();
@@ -268,6 +512,7 @@ void sys_clock_announce(int32_t ticks)
 	if (t != NULL) {
 		t->dticks -= announce_remaining;
 	}
+#endif /* CONFIG_TIMEOUT_QUEUE_WHEEL */
 
 	curr_tick += announce_remaining;
 	announce_remaining = 0;
@@ -353,7 +598,40 @@ k_timeout_t sys_timepoint_timeout(k_timepoint_t timepoint)
 #ifdef CONFIG_ZTEST
 void z_impl_sys_clock_tick_set(uint64_t tick)
 {
+#ifdef CONFIG_TIMEOUT_QUEUE_WHEEL
+	/* Wheel slots are indexed by absolute tick; shift pending entries
+	 * along with the clock the same way the delta list implicitly does.
+	 */
+	K_SPINLOCK(&timeout_lock) {
+		sys_dlist_t pending = SYS_DLIST_STATIC_INIT(&pending);
+		int64_t shift = tick - curr_tick;
+		sys_dnode_t *node;
+
+		for (unsigned int lvl = 0U; lvl < WHEEL_LEVELS; lvl++) {
+			while (wheel_occupied[lvl] != 0U) {
+				unsigned int slot = u64_count_trailing_zeros(wheel_occupied[lvl]);
+
+				while ((node = sys_dlist_get(&wheel[lvl][slot])) != NULL) {
+					sys_dlist_append(&pending, node);
+				}
+				wheel_occupied[lvl] &= ~BIT64(slot);
+			}
+		}
+		while ((node = sys_dlist_get(&wheel_overflow)) != NULL) {
+			sys_dlist_append(&pending, node);
+		}
+
+		curr_tick = tick;
+		while ((node = sys_dlist_get(&pending)) != NULL) {
+			struct _timeout *t = CONTAINER_OF(node, struct _timeout, node);
+
+			t->dticks += shift;
+			wheel_place(t);
+		}
+	}
+#else
 	curr_tick = tick;
+#endif /* CONFIG_TIMEOUT_QUEUE_WHEEL */
 }
 
 void z_vrfy_sys_clock_tick_set(uint64_t tick)
@@ -10,6 +10,7 @@
 #include <ksched.h>
 #include <zephyr/spinlock.h>
 #include <zephyr/sys/check.h>
+#include <zephyr/sys/math_extras.h>
 
 /* Need one of these for this to work */
 #if !defined(CONFIG_USE_SWITCH) && !defined(CONFIG_INSTRUMENT_THREAD_SWITCHING)
@@ -71,14 +72,84 @@ static void sched_thread_update_usage(struct k_thread *thread, uint32_t cycles)
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
 }
 
+#ifdef CONFIG_SCHED_THREAD_LATENCY_STATS
+void z_sched_usage_ready(struct k_thread *thread)
+{
+	/* Always restamp: a thread preempted and then suspended or pended
+	 * before getting to run again still holds its old stamp.
+	 */
+	if (thread->base.usage.track_usage) {
+		thread->base.usage.ready_stamp = usage_now();
+		thread->base.usage.preempted = false;
+	}
+}
+
+void z_sched_usage_switched_out(struct k_thread *thread)
+{
+	if (thread->base.usage.track_usage &&
+	    (thread->base.usage.ready_stamp == 0U) &&
+	    !z_is_thread_prevented_from_running(thread) &&
+	    !z_is_idle_thread_object(thread)) {
+		thread->base.usage.ready_stamp = usage_now();
+		thread->base.usage.preempted = true;
+	}
+}
+
+static void sched_latency_record(struct k_cycle_stats *stats, bool preempted,
+				 unsigned int bucket)
+{
+	if (preempted) {
+		stats->preempt_latency[bucket]++;
+	} else {
+		stats->wakeup_latency[bucket]++;
+	}
+}
+
+/*
+ * Called as @a thread is switched in at time @a now. Only the CPU
+ * switching it in touches these fields, so no lock is needed.
+ */
+static void sched_latency_update(struct _cpu *cpu, struct k_thread *thread,
+				 uint32_t now)
+{
+	uint32_t stamp = thread->base.usage.ready_stamp;
+	unsigned int bucket;
+
+	if (stamp == 0U) {
+		return;
+	}
+
+	thread->base.usage.ready_stamp = 0U;
+
+	bucket = 32U - u32_count_leading_zeros(now - stamp);
+	bucket = MIN(bucket, CONFIG_SCHED_THREAD_LATENCY_STATS_BUCKETS - 1);
+
+	sched_latency_record(&thread->base.usage, thread->base.usage.preempted,
+			     bucket);
+
+#ifdef CONFIG_SCHED_THREAD_USAGE_ALL
+	if (cpu->usage->track_usage) {
+		sched_latency_record(cpu->usage, thread->base.usage.preempted,
+				     bucket);
+	}
+#else
+	ARG_UNUSED(cpu);
+#endif /* CONFIG_SCHED_THREAD_USAGE_ALL */
+}
+#else
+#define sched_latency_update(cpu, thread, now)   do { } while (0)
+#endif /* CONFIG_SCHED_THREAD_LATENCY_STATS */
+
 void z_sched_usage_start(struct k_thread *thread)
 {
+	uint32_t now = usage_now();
+
 #ifdef CONFIG_SCHED_THREAD_USAGE_ANALYSIS
 	k_spinlock_key_t  key;
 
 	key = k_spin_lock(&usage_lock);
 
-	_current_cpu->usage0 = usage_now();   /* Always update */
+	_current_cpu->usage0 = now;   /* Always update */
 
 	if (thread->base.usage.track_usage) {
 		thread->base.usage.num_windows++;
@@ -92,8 +163,10 @@ void z_sched_usage_start(struct k_thread *thread)
 	 * (we can't race with _stop() by design).
 	 */
 
-	_current_cpu->usage0 = usage_now();
+	_current_cpu->usage0 = now;
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
+
+	sched_latency_update(_current_cpu, thread, now);
 }
 
 void z_sched_usage_stop(void)
@@ -166,6 +239,15 @@ void z_sched_cpu_usage(uint8_t cpu_id, struct k_thread_runtime_stats *stats)
 
 	stats->execution_cycles = stats->total_cycles + stats->idle_cycles;
 
+#ifdef CONFIG_SCHED_THREAD_LATENCY_STATS
+	memcpy(stats->wakeup_latency,
+	       _kernel.cpus[cpu_id].usage->wakeup_latency,
+	       sizeof(stats->wakeup_latency));
+	memcpy(stats->preempt_latency,
+	       _kernel.cpus[cpu_id].usage->preempt_latency,
+	       sizeof(stats->preempt_latency));
+#endif /* CONFIG_SCHED_THREAD_LATENCY_STATS */
+
 	k_spin_unlock(&usage_lock, key);
 }
 #endif /* CONFIG_SCHED_THREAD_USAGE_ALL */
@@ -221,6 +303,13 @@ void z_sched_thread_usage(struct k_thread *thread,
 	stats->idle_cycles = 0;
 #endif /* CONFIG_SCHED_THREAD_USAGE_ALL */
 
+#ifdef CONFIG_SCHED_THREAD_LATENCY_STATS
+	memcpy(stats->wakeup_latency, thread->base.usage.wakeup_latency,
+	       sizeof(stats->wakeup_latency));
+	memcpy(stats->preempt_latency, thread->base.usage.preempt_latency,
+	       sizeof(stats->preempt_latency));
+#endif /* CONFIG_SCHED_THREAD_LATENCY_STATS */
+
 	k_spin_unlock(&usage_lock, key);
 }
 
@@ -382,6 +471,10 @@ int z_thread_stats_reset(struct k_obj_core *obj_core)
 	stats->longest = 0ULL;
 	stats->num_windows = (thread->base.usage.track_usage) ?  1U : 0U;
 #endif /* CONFIG_SCHED_THREAD_USAGE_ANALYSIS */
+#ifdef CONFIG_SCHED_THREAD_LATENCY_STATS
+	memset(stats->wakeup_latency, 0, sizeof(stats->wakeup_latency));
+	memset(stats->preempt_latency, 0, sizeof(stats->preempt_latency));
+#endif /* CONFIG_SCHED_THREAD_LATENCY_STATS */
 
 	if (thread != _current_cpu->current) {
 
@@ -192,6 +192,9 @@ static void queue_flusher_locked(struct k_work_q *queue,
 				 struct z_work_flusher *flusher)
 {
 	init_flusher(flusher);
+#if defined(CONFIG_WORKQUEUE_WORKERS)
+	flusher->target = work;
+#endif /* defined(CONFIG_WORKQUEUE_WORKERS) */
 
 	if ((flags_get(&work->flags) & K_WORK_QUEUED) != 0U) {
 		sys_slist_insert(&queue->pending, &work->node,
@@ -216,6 +219,33 @@ static inline void queue_remove_locked(struct k_work_q *queue,
 	}
 }
 
+/* Test whether a thread is one of the threads serving a queue.
+ *
+ * Invoked with work lock held.
+ *
+ * @param queue the queue to check
+ * @param thread the candidate thread
+ */
+static inline bool queue_thread_locked(const struct k_work_q *queue,
+				       const struct k_thread *thread)
+{
+	if (thread == queue->thread_id) {
+		return true;
+	}
+
+#if defined(CONFIG_WORKQUEUE_WORKERS)
+	struct k_work_q_worker *worker;
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&queue->workers, worker, node) {
+		if (thread == &worker->thread) {
+			return true;
+		}
+	}
+#endif /* defined(CONFIG_WORKQUEUE_WORKERS) */
+
+	return false;
+}
+
 /* Potentially notify a queue that it needs to look for pending work.
  *
  * This may make the work queue thread ready, but as the lock is held it
@@ -265,7 +295,7 @@ static inline int queue_submit_locked(struct k_work_q *queue,
 	}
 
 	int ret;
-	bool chained = (_current == queue->thread_id) && !k_is_in_isr();
+	bool chained = queue_thread_locked(queue, _current) && !k_is_in_isr();
 	bool draining = flag_test(&queue->flags, K_WORK_QUEUE_DRAIN_BIT);
 	bool plugged = flag_test(&queue->flags, K_WORK_QUEUE_PLUGGED_BIT);
 
@@ -648,6 +678,70 @@ static void work_timeout_stop_locked(struct k_work_q *queue)
 }
 #endif /* defined(CONFIG_WORKQUEUE_WORK_TIMEOUT) */
 
+#if defined(CONFIG_WORKQUEUE_WORKERS)
+/* Test whether a pending item has to wait for another worker.
+ *
+ * An item resubmitted while it runs must not start before the running
+ * instance completes, and a flusher must not complete before the item
+ * it flushes.
+ *
+ * Invoked with work lock held.
+ */
+static inline bool work_blocked_locked(struct k_work *work)
+{
+	if (flag_test(&work->flags, K_WORK_RUNNING_BIT)) {
+		return true;
+	}
+
+	if (flag_test(&work->flags, K_WORK_FLUSHING_BIT)) {
+		struct z_work_flusher *flusher
+			= CONTAINER_OF(work, struct z_work_flusher, work);
+
+		return flag_test(&flusher->target->flags, K_WORK_RUNNING_BIT);
+	}
+
+	return false;
+}
+#endif /* defined(CONFIG_WORKQUEUE_WORKERS) */
+
+/* Take the next pending item a work queue thread may start.
+ *
+ * Invoked with work lock held.
+ *
+ * @param queue the queue to take work from
+ *
+ * @return the node of the item, or NULL if none can be started now
+ */
+static sys_snode_t *queue_next_locked(struct k_work_q *queue)
+{
+#if defined(CONFIG_WORKQUEUE_WORKERS)
+	sys_snode_t *node;
+	sys_snode_t *prev = NULL;
+
+	SYS_SLIST_FOR_EACH_NODE(&queue->pending, node) {
+		if (!work_blocked_locked(CONTAINER_OF(node, struct k_work, node))) {
+			sys_slist_remove(&queue->pending, prev, node);
+			return node;
+		}
+		prev = node;
+	}
+
+	return NULL;
+#else
+	return sys_slist_get(&queue->pending);
+#endif /* defined(CONFIG_WORKQUEUE_WORKERS) */
+}
+
+/* Test whether no thread of a work queue has work in hand.
+ *
+ * Invoked with work lock held.
+ */
+static inline bool queue_idle_locked(struct k_work_q *queue)
+{
+	return !flag_test(&queue->flags, K_WORK_QUEUE_BUSY_BIT)
+		&& sys_slist_is_empty(&queue->pending);
+}
+
 /* Loop executed by a work queue thread.
  *
  * @param workq_ptr pointer to the work queue structure
@@ -667,12 +761,15 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 		bool yield;
 
 		/* Check for and prepare any new work. */
-		node = sys_slist_get(&queue->pending);
+		node = queue_next_locked(queue);
 		if (node != NULL) {
 			/* Mark that there's some work active that's
 			 * not on the pending list.
 			 */
 			flag_set(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+#if defined(CONFIG_WORKQUEUE_WORKERS)
+			queue->busy++;
+#endif /* defined(CONFIG_WORKQUEUE_WORKERS) */
 			work = CONTAINER_OF(node, struct k_work, node);
 			flag_set(&work->flags, K_WORK_RUNNING_BIT);
 			flag_clear(&work->flags, K_WORK_QUEUED_BIT);
@@ -690,8 +787,9 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 			 * This means that if node is not NULL, then work will not be NULL.
 			 */
 			handler = work->handler;
-		} else if (flag_test_and_clear(&queue->flags,
-					       K_WORK_QUEUE_DRAIN_BIT)) {
+		} else if (queue_idle_locked(queue)
+			   && flag_test_and_clear(&queue->flags,
+						  K_WORK_QUEUE_DRAIN_BIT)) {
 			/* Not busy and draining: move threads waiting for
 			 * drain to ready state.  The held spinlock inhibits
 			 * immediate reschedule; released threads get their
@@ -702,9 +800,20 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 			 * submissions.
 			 */
 			(void)z_sched_wake_all(&queue->drainq, 1, NULL);
-		} else if (flag_test(&queue->flags, K_WORK_QUEUE_STOP_BIT)) {
+		} else if (flag_test(&queue->flags, K_WORK_QUEUE_STOP_BIT)
+			   && sys_slist_is_empty(&queue->pending)) {
 			/* User has requested that the queue stop. Clear the status flags and exit.
 			 */
+#if defined(CONFIG_WORKQUEUE_WORKERS)
+			/* The last thread to leave clears the flags, and
+			 * makes sure the others get to see the request.
+			 */
+			if (--queue->live != 0U) {
+				(void)z_sched_wake_all(&queue->notifyq, 0, NULL);
+				k_spin_unlock(&lock, key);
+				return;
+			}
+#endif /* defined(CONFIG_WORKQUEUE_WORKERS) */
 			flags_set(&queue->flags, 0);
 			k_spin_unlock(&lock, key);
 			return;
@@ -755,7 +864,13 @@ static void work_queue_main(void *workq_ptr, void *p2, void *p3)
 			finalize_cancel_locked(work);
 		}
 
+#if defined(CONFIG_WORKQUEUE_WORKERS)
+		if (--queue->busy == 0U) {
+			flag_clear(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+		}
+#else
 		flag_clear(&queue->flags, K_WORK_QUEUE_BUSY_BIT);
+#endif /* defined(CONFIG_WORKQUEUE_WORKERS) */
 		yield = !flag_test(&queue->flags, K_WORK_QUEUE_NO_YIELD_BIT);
 		k_spin_unlock(&lock, key);
 
@@ -804,6 +919,11 @@ void k_work_queue_run(struct k_work_q *queue, const struct k_work_queue_config *
 	sys_slist_init(&queue->pending);
 	z_waitq_init(&queue->notifyq);
 	z_waitq_init(&queue->drainq);
+#if defined(CONFIG_WORKQUEUE_WORKERS)
+	sys_slist_init(&queue->workers);
+	queue->live = 1U;
+	queue->busy = 0U;
+#endif /* defined(CONFIG_WORKQUEUE_WORKERS) */
 	queue->thread_id = _current;
 	flags_set(&queue->flags, flags);
 	work_queue_main(queue, NULL, NULL);
@@ -826,6 +946,11 @@ void k_work_queue_start(struct k_work_q *queue,
 	sys_slist_init(&queue->pending);
 	z_waitq_init(&queue->notifyq);
 	z_waitq_init(&queue->drainq);
+#if defined(CONFIG_WORKQUEUE_WORKERS)
+	sys_slist_init(&queue->workers);
+	queue->live = 1U;
+	queue->busy = 0U;
+#endif /* defined(CONFIG_WORKQUEUE_WORKERS) */
 
 	if ((cfg != NULL) && cfg->no_yield) {
 		flags |= K_WORK_QUEUE_NO_YIELD;
@@ -863,6 +988,62 @@ void k_work_queue_start(struct k_work_q *queue,
 	SYS_PORT_TRACING_OBJ_FUNC_EXIT(k_work_queue, start, queue);
 }
 
+#if defined(CONFIG_WORKQUEUE_WORKERS)
+int k_work_queue_add_worker(struct k_work_q *queue,
+			    struct k_work_q_worker *worker,
+			    k_thread_stack_t *stack, size_t stack_size,
+			    int prio, int cpu)
+{
+	__ASSERT_NO_MSG(queue);
+	__ASSERT_NO_MSG(worker);
+	__ASSERT_NO_MSG(stack);
+
+	int ret = 0;
+	k_tid_t tid = k_thread_create(&worker->thread, stack, stack_size,
+				      work_queue_main, queue, NULL, NULL,
+				      prio, 0, K_FOREVER);
+
+	if (cpu >= 0) {
+#if defined(CONFIG_SCHED_CPU_MASK)
+		ret = ((unsigned int)cpu < arch_num_cpus()) ? k_thread_cpu_pin(tid, cpu) : -EINVAL;
+#else
+		ret = -ENOTSUP;
+#endif /* defined(CONFIG_SCHED_CPU_MASK) */
+	}
+
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	if ((ret == 0)
+	    && (!flag_test(&queue->flags, K_WORK_QUEUE_STARTED_BIT)
+		|| flag_test(&queue->flags, K_WORK_QUEUE_STOP_BIT))) {
+		ret = -ENODEV;
+	}
+
+	if (ret == 0) {
+		__ASSERT_NO_MSG(queue->live < UINT8_MAX);
+		sys_slist_append(&queue->workers, &worker->node);
+		queue->live++;
+	}
+
+	k_spin_unlock(&lock, key);
+
+	if (ret != 0) {
+		k_thread_abort(tid);
+		return ret;
+	}
+
+	const char *name = k_thread_name_get(queue->thread_id);
+
+	if (name != NULL) {
+		(void)k_thread_name_set(tid, name);
+	}
+
+	k_thread_start(tid);
+
+	return 0;
+}
+#endif /* defined(CONFIG_WORKQUEUE_WORKERS) */
+
 int k_work_queue_drain(struct k_work_q *queue,
 		       bool plug)
 {
@@ -915,6 +1096,32 @@ int k_work_queue_unplug(struct k_work_q *queue)
 	return ret;
 }
 
+/* Wait for every thread serving a stopping queue to exit.
+ *
+ * @retval 0 if all threads exited
+ * @retval nonzero if the timeout expired first
+ */
+static int work_queue_join(struct k_work_q *queue, k_timeout_t timeout)
+{
+#if defined(CONFIG_WORKQUEUE_WORKERS)
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	struct k_work_q_worker *worker;
+
+	/* The list is only changed by a started queue adding workers,
+	 * which the stop request prevents.
+	 */
+	SYS_SLIST_FOR_EACH_CONTAINER(&queue->workers, worker, node) {
+		if (k_thread_join(&worker->thread, sys_timepoint_timeout(end)) != 0) {
+			return -ETIMEDOUT;
+		}
+	}
+
+	timeout = sys_timepoint_timeout(end);
+#endif /* defined(CONFIG_WORKQUEUE_WORKERS) */
+
+	return k_thread_join(queue->thread_id, timeout);
+}
+
 int k_work_queue_stop(struct k_work_q *queue, k_timeout_t timeout)
 {
 	__ASSERT_NO_MSG(queue);
@@ -935,10 +1142,10 @@ int k_work_queue_stop(struct k_work_q *queue, k_timeout_t timeout)
 	}
 
 	flag_set(&queue->flags, K_WORK_QUEUE_STOP_BIT);
-	notify_queue_locked(queue);
+	(void)z_sched_wake_all(&queue->notifyq, 0, NULL);
 	k_spin_unlock(&lock, key);
 	SYS_PORT_TRACING_OBJ_FUNC_BLOCKING(k_work_queue, stop, queue, timeout);
-	if (k_thread_join(queue->thread_id, timeout)) {
+	if (work_queue_join(queue, timeout)) {
 		key = k_spin_lock(&lock);
 		flag_clear(&queue->flags, K_WORK_QUEUE_STOP_BIT);
 		k_spin_unlock(&lock, key);
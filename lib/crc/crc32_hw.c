@@ -0,0 +1,26 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <stdbool.h>
+
+#include <zephyr/init.h>
+#include <zephyr/app_memory/app_memdomain.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/arch/x86/cpuid.h>
+
+#include "crc32_hw.h"
+
+/* In the C library partition so that user threads can compute CRCs too */
+K_APP_DMEM(z_libc_partition) bool crc32_hw_sse4_2;
+
+static int crc32_hw_init(void)
+{
+	crc32_hw_sse4_2 = (z_x86_cpuid_basic_features() & CPUID_BASIC_SSE4_2) != 0U;
+
+	return 0;
+}
+
+SYS_INIT(crc32_hw_init, PRE_KERNEL_1, 0);
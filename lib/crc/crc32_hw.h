@@ -0,0 +1,108 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * CRC32 (IEEE) and CRC32C (Castagnoli) updates using CPU instructions.
+ *
+ * - ARMv8 CRC32 extension, both polynomials, selected at compile time when
+ *   the compiler targets it (__ARM_FEATURE_CRC32).
+ * - x86 SSE4.2 crc32 instruction, Castagnoli only, detected at boot.
+ *
+ * CRC32_HW_IEEE and CRC32_HW_C tell which updates are provided, and
+ * crc32_hw_available() whether they can be used on the running CPU. All of
+ * them work on the bit-reflected, non-inverted CRC value.
+ *
+ * There is no PCLMULQDQ folding for CRC32 (IEEE) on x86: folding only gets
+ * ahead of slicing-by-8 on buffers of several hundred bytes, and its setup
+ * and Barrett reduction cost more than a table lookup on the short packets
+ * and records CRCs are mostly computed over here.
+ */
+
+#ifndef ZEPHYR_LIB_CRC_CRC32_HW_H_
+#define ZEPHYR_LIB_CRC_CRC32_HW_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <zephyr/sys/byteorder.h>
+
+#if defined(CONFIG_CRC32_HW_ACCEL) && defined(__ARM_FEATURE_CRC32)
+
+#include <arm_acle.h>
+
+#define CRC32_HW_IEEE 1
+#define CRC32_HW_C    1
+
+static inline bool crc32_hw_available(void)
+{
+	return true;
+}
+
+static inline uint32_t crc32_hw_ieee_update(uint32_t crc, const uint8_t *data, size_t len)
+{
+	for (; len >= 8; len -= 8, data += 8) {
+		crc = __crc32d(crc, sys_get_le64(data));
+	}
+
+	for (; len > 0; len--, data++) {
+		crc = __crc32b(crc, *data);
+	}
+
+	return crc;
+}
+
+static inline uint32_t crc32_hw_c_update(uint32_t crc, const uint8_t *data, size_t len)
+{
+	for (; len >= 8; len -= 8, data += 8) {
+		crc = __crc32cd(crc, sys_get_le64(data));
+	}
+
+	for (; len > 0; len--, data++) {
+		crc = __crc32cb(crc, *data);
+	}
+
+	return crc;
+}
+
+#elif defined(CONFIG_CRC32_HW_ACCEL) && defined(CONFIG_X86)
+
+#define CRC32_HW_C 1
+
+/* Set from CPUID at boot by crc32_hw.c */
+extern bool crc32_hw_sse4_2;
+
+static inline bool crc32_hw_available(void)
+{
+	return crc32_hw_sse4_2;
+}
+
+static inline uint32_t crc32_hw_c_update(uint32_t crc, const uint8_t *data, size_t len)
+{
+#ifdef CONFIG_64BIT
+	uint64_t crc64 = crc;
+
+	for (; len >= 8; len -= 8, data += 8) {
+		__asm__("crc32q %1, %0" : "+r"(crc64) : "r"(sys_get_le64(data)));
+	}
+
+	crc = (uint32_t)crc64;
+#endif
+
+	for (; len >= 4; len -= 4, data += 4) {
+		__asm__("crc32l %1, %0" : "+r"(crc) : "r"(sys_get_le32(data)));
+	}
+
+	for (; len > 0; len--, data++) {
+		__asm__("crc32b %1, %0" : "+r"(crc) : "q"(*data));
+	}
+
+	return crc;
+}
+
+#endif
+
+#endif /* ZEPHYR_LIB_CRC_CRC32_HW_H_ */
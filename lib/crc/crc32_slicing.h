@@ -0,0 +1,61 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * Slicing-by-4/8 update of reflected 32-bit CRCs.
+ *
+ * Table 0 is the usual byte-wise table of the polynomial, and table k gives
+ * the CRC of a byte followed by k zero bytes. The CRC of 4 or 8 bytes is then
+ * the XOR of one lookup per byte, without any dependency between lookups.
+ */
+
+#ifndef ZEPHYR_LIB_CRC_CRC32_SLICING_H_
+#define ZEPHYR_LIB_CRC_CRC32_SLICING_H_
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <zephyr/sys/byteorder.h>
+
+#if defined(CONFIG_CRC32_SW_SLICING_BY_8)
+#define CRC32_SLICES 8
+#elif defined(CONFIG_CRC32_SW_SLICING_BY_4)
+#define CRC32_SLICES 4
+#endif
+
+#ifdef CRC32_SLICES
+
+static inline uint32_t crc32_slicing_update(const uint32_t table[][256], uint32_t crc,
+					    const uint8_t *data, size_t len)
+{
+	uint32_t word;
+
+	for (; len >= CRC32_SLICES; len -= CRC32_SLICES, data += CRC32_SLICES) {
+		word = crc ^ sys_get_le32(data);
+
+#if CRC32_SLICES == 8
+		crc = table[7][word & 0xff] ^ table[6][(word >> 8) & 0xff] ^
+		      table[5][(word >> 16) & 0xff] ^ table[4][word >> 24];
+
+		word = sys_get_le32(data + 4);
+		crc ^= table[3][word & 0xff] ^ table[2][(word >> 8) & 0xff] ^
+		       table[1][(word >> 16) & 0xff] ^ table[0][word >> 24];
+#else
+		crc = table[3][word & 0xff] ^ table[2][(word >> 8) & 0xff] ^
+		      table[1][(word >> 16) & 0xff] ^ table[0][word >> 24];
+#endif
+	}
+
+	for (; len > 0; len--, data++) {
+		crc = table[0][(crc ^ *data) & 0xff] ^ (crc >> 8);
+	}
+
+	return crc;
+}
+
+#endif /* CRC32_SLICES */
+
+#endif /* ZEPHYR_LIB_CRC_CRC32_SLICING_H_ */
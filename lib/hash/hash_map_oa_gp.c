@@ -0,0 +1,406 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Open-Addressing / Group Probe Hashmap, in the style of "Swiss tables".
+ *
+ * Buckets are split in groups of GROUP_SIZE. Each bucket has a control byte
+ * which is either EMPTY or holds 7 bits of the hash of its key. The control
+ * bytes of a group are loaded as a single 64-bit word and matched against
+ * the hash of the searched key in a few instructions (SWAR), so that only
+ * the entries whose control byte matches are ever compared.
+ *
+ * Probing moves from one group to the next (triangular sequence), rather
+ * than from one bucket to the next. Each group counts the keys that probed
+ * past it because it was full. A lookup stops at the first group holding
+ * no match and no overflow, and a removal decrements the counts along the
+ * probe sequence of the removed key, so that no tombstones are needed.
+ *
+ * The entries, control bytes and overflow counts of a table are a single
+ * allocation:
+ *
+ *   | entries: n_buckets * 16 | control: n_buckets | overflow: n_groups |
+ */
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/sys/hash_map.h>
+#include <zephyr/sys/hash_map_oa_gp.h>
+#include <zephyr/sys/math_extras.h>
+#include <zephyr/sys/util.h>
+
+#define GROUP_SIZE 8
+
+#define CTRL_EMPTY 0x80
+#define CTRL_HASH(_hash) ((uint8_t)((_hash) & 0x7f))
+#define GROUP_HASH(_hash) ((_hash) >> 7)
+
+#define LSB_BYTES 0x0101010101010101ULL
+#define MSB_BYTES 0x8080808080808080ULL
+
+/* saturated overflow counts are never decremented again */
+#define OVERFLOW_MAX UINT8_MAX
+
+struct oagp_entry {
+	uint64_t key;
+	uint64_t value;
+};
+
+static inline uint8_t *oagp_ctrl(const struct sys_hashmap_data *data)
+{
+	return (uint8_t *)data->buckets + data->n_buckets * sizeof(struct oagp_entry);
+}
+
+static inline uint8_t *oagp_overflow(const struct sys_hashmap_data *data)
+{
+	return oagp_ctrl(data) + data->n_buckets;
+}
+
+static inline size_t oagp_alloc_size(size_t n_buckets)
+{
+	return n_buckets * (sizeof(struct oagp_entry) + 1) + n_buckets / GROUP_SIZE;
+}
+
+static inline uint64_t oagp_group_load(const uint8_t *ctrl)
+{
+	uint64_t word;
+
+	memcpy(&word, ctrl, sizeof(word));
+
+	/* byte i of the group is byte i of the word, whatever the endianness */
+	return sys_le64_to_cpu(word);
+}
+
+/*
+ * Return a mask with the MSB set in every byte equal to @p h. There can be
+ * false positives above a true match, which the key comparison discards.
+ */
+static inline uint64_t oagp_group_match(uint64_t group, uint8_t h)
+{
+	uint64_t x = group ^ (LSB_BYTES * h);
+
+	return (x - LSB_BYTES) & ~x & MSB_BYTES;
+}
+
+static inline uint64_t oagp_group_match_empty(uint64_t group)
+{
+	return group & MSB_BYTES;
+}
+
+static inline size_t oagp_mask_next(uint64_t *mask)
+{
+	size_t i = u64_count_trailing_zeros(*mask) / BITS_PER_BYTE;
+
+	*mask &= *mask - 1;
+
+	return i;
+}
+
+/*
+ * Find the bucket holding @p key and the number of groups probed before
+ * reaching its group, or return SIZE_MAX.
+ */
+static size_t sys_hashmap_oa_gp_find(const struct sys_hashmap *map, uint64_t key, size_t *n_probes)
+{
+	uint64_t mask;
+	size_t bucket;
+	const struct sys_hashmap_data *data = map->data;
+	const size_t n_groups = data->n_buckets / GROUP_SIZE;
+	const struct oagp_entry *const entries = data->buckets;
+	const uint8_t *const ctrl = oagp_ctrl(data);
+	const uint8_t *const overflow = oagp_overflow(data);
+	uint32_t hash;
+
+	if (n_groups == 0) {
+		return SIZE_MAX;
+	}
+
+	hash = map->hash_func(&key, sizeof(key));
+
+	for (size_t i = 0, g = GROUP_HASH(hash); i < n_groups; g += ++i) {
+		g &= (n_groups - 1);
+
+		mask = oagp_group_match(oagp_group_load(&ctrl[g * GROUP_SIZE]), CTRL_HASH(hash));
+		while (mask != 0) {
+			bucket = g * GROUP_SIZE + oagp_mask_next(&mask);
+			if (entries[bucket].key == key) {
+				if (n_probes != NULL) {
+					*n_probes = i;
+				}
+				return bucket;
+			}
+		}
+
+		if (overflow[g] == 0) {
+			break;
+		}
+	}
+
+	return SIZE_MAX;
+}
+
+/* Place a key that is known not to be in the map */
+static struct oagp_entry *sys_hashmap_oa_gp_place(struct sys_hashmap *map, uint64_t key)
+{
+	uint64_t mask;
+	size_t bucket;
+	struct sys_hashmap_data *data = map->data;
+	const size_t n_groups = data->n_buckets / GROUP_SIZE;
+	struct oagp_entry *const entries = data->buckets;
+	uint8_t *const ctrl = oagp_ctrl(data);
+	uint8_t *const overflow = oagp_overflow(data);
+	uint32_t hash = map->hash_func(&key, sizeof(key));
+
+	for (size_t i = 0, g = GROUP_HASH(hash); i < n_groups; g += ++i) {
+		g &= (n_groups - 1);
+
+		mask = oagp_group_match_empty(oagp_group_load(&ctrl[g * GROUP_SIZE]));
+		if (mask != 0) {
+			bucket = g * GROUP_SIZE + oagp_mask_next(&mask);
+			ctrl[bucket] = CTRL_HASH(hash);
+			entries[bucket].key = key;
+			++data->size;
+
+			return &entries[bucket];
+		}
+
+		if (overflow[g] != OVERFLOW_MAX) {
+			++overflow[g];
+		}
+	}
+
+	__ASSERT(false, "No empty bucket in Hashmap");
+
+	return NULL;
+}
+
+static int sys_hashmap_oa_gp_rehash(struct sys_hashmap *map, bool grow)
+{
+	size_t old_size;
+	size_t old_n_buckets;
+	size_t new_n_buckets = 0;
+	struct oagp_entry *entry;
+	uint8_t *old_ctrl;
+	void *old_buckets;
+	void *new_buckets;
+	struct sys_hashmap_data *data = map->data;
+
+	/*
+	 * The load factor is rounded down, so make sure that a full table grows
+	 * and that a table never shrinks below its size.
+	 */
+	if (!sys_hashmap_should_rehash(map, grow, 0, &new_n_buckets) &&
+	    !(grow && data->size == data->n_buckets)) {
+		return 0;
+	}
+
+	/* groups are the unit of allocation */
+	new_n_buckets = ROUND_UP(new_n_buckets, GROUP_SIZE);
+	if (new_n_buckets == data->n_buckets || new_n_buckets < data->size) {
+		return 0;
+	}
+
+	if (map->data->size != SIZE_MAX && map->data->size == map->config->max_size) {
+		return -ENOSPC;
+	}
+
+	old_size = data->size;
+	old_n_buckets = data->n_buckets;
+	old_buckets = data->buckets;
+	old_ctrl = oagp_ctrl(data);
+
+	new_buckets = map->alloc_func(NULL, oagp_alloc_size(new_n_buckets));
+	if (new_buckets == NULL && new_n_buckets != 0) {
+		return -ENOMEM;
+	}
+
+	data->size = 0;
+	data->buckets = new_buckets;
+	data->n_buckets = new_n_buckets;
+
+	if (new_buckets != NULL) {
+		memset(oagp_ctrl(data), CTRL_EMPTY, new_n_buckets);
+		memset(oagp_overflow(data), 0, new_n_buckets / GROUP_SIZE);
+	}
+
+	/* re-insert all entries into the hashmap */
+	for (size_t i = 0, j = 0; i < old_n_buckets && j < old_size; ++i) {
+		if (old_ctrl[i] == CTRL_EMPTY) {
+			continue;
+		}
+
+		entry = &((struct oagp_entry *)old_buckets)[i];
+		sys_hashmap_oa_gp_place(map, entry->key)->value = entry->value;
+		++j;
+	}
+
+	map->alloc_func(old_buckets, 0);
+
+	return 0;
+}
+
+static void sys_hashmap_oa_gp_iter_next(struct sys_hashmap_iterator *it)
+{
+	size_t i;
+	const struct sys_hashmap *map = (const struct sys_hashmap *)it->map;
+	struct oagp_entry *entries = map->data->buckets;
+	const uint8_t *const ctrl = oagp_ctrl(map->data);
+
+	__ASSERT(it->size == map->data->size, "Concurrent modification!");
+	__ASSERT(sys_hashmap_iterator_has_next(it), "Attempt to access beyond current bound!");
+
+	if (it->pos == 0) {
+		it->state = entries;
+	}
+
+	i = (struct oagp_entry *)it->state - entries;
+	__ASSERT(i < map->data->n_buckets, "Invalid iterator state %p", it->state);
+
+	for (; i < map->data->n_buckets; ++i) {
+		if (ctrl[i] != CTRL_EMPTY) {
+			it->state = &entries[i + 1];
+			it->key = entries[i].key;
+			it->value = entries[i].value;
+			++it->pos;
+			return;
+		}
+	}
+
+	__ASSERT(false, "Entire Hashmap traversed and no entry was found");
+}
+
+/*
+ * Open Addressing / Group Probe Hashmap API
+ */
+
+static void sys_hashmap_oa_gp_iter(const struct sys_hashmap *map, struct sys_hashmap_iterator *it)
+{
+	it->map = map;
+	it->next = sys_hashmap_oa_gp_iter_next;
+	it->pos = 0;
+	*((size_t *)&it->size) = map->data->size;
+}
+
+static void sys_hashmap_oa_gp_clear(struct sys_hashmap *map, sys_hashmap_callback_t cb,
+				    void *cookie)
+{
+	struct sys_hashmap_data *data = map->data;
+	struct oagp_entry *entries = data->buckets;
+	const uint8_t *const ctrl = oagp_ctrl(data);
+
+	for (size_t i = 0, j = 0; cb != NULL && i < data->n_buckets && j < data->size; ++i) {
+		if (ctrl[i] != CTRL_EMPTY) {
+			cb(entries[i].key, entries[i].value, cookie);
+			++j;
+		}
+	}
+
+	if (data->buckets != NULL) {
+		map->alloc_func(data->buckets, 0);
+		data->buckets = NULL;
+	}
+
+	data->n_buckets = 0;
+	data->size = 0;
+}
+
+static int sys_hashmap_oa_gp_insert(struct sys_hashmap *map, uint64_t key, uint64_t value,
+				    uint64_t *old_value)
+{
+	int ret;
+	size_t bucket;
+	struct oagp_entry *entry;
+	struct oagp_entry *const entries = map->data->buckets;
+
+	bucket = sys_hashmap_oa_gp_find(map, key, NULL);
+	if (bucket != SIZE_MAX) {
+		if (old_value != NULL) {
+			*old_value = entries[bucket].value;
+		}
+		entries[bucket].value = value;
+
+		return 0;
+	}
+
+	ret = sys_hashmap_oa_gp_rehash(map, true);
+	if (ret < 0) {
+		return ret;
+	}
+
+	entry = sys_hashmap_oa_gp_place(map, key);
+	__ASSERT_NO_MSG(entry != NULL);
+	entry->value = value;
+
+	return 1;
+}
+
+static bool sys_hashmap_oa_gp_remove(struct sys_hashmap *map, uint64_t key, uint64_t *value)
+{
+	size_t bucket;
+	size_t n_probes;
+	uint32_t hash;
+	struct sys_hashmap_data *data = map->data;
+	const size_t n_groups = data->n_buckets / GROUP_SIZE;
+	struct oagp_entry *const entries = data->buckets;
+	uint8_t *const overflow = oagp_overflow(data);
+
+	bucket = sys_hashmap_oa_gp_find(map, key, &n_probes);
+	if (bucket == SIZE_MAX) {
+		return false;
+	}
+
+	if (value != NULL) {
+		*value = entries[bucket].value;
+	}
+
+	/* undo the overflow the key caused when it was placed */
+	hash = map->hash_func(&key, sizeof(key));
+	for (size_t i = 0, g = GROUP_HASH(hash); i < n_probes; g += ++i) {
+		g &= (n_groups - 1);
+
+		__ASSERT_NO_MSG(overflow[g] != 0);
+		if (overflow[g] != OVERFLOW_MAX) {
+			--overflow[g];
+		}
+	}
+
+	oagp_ctrl(data)[bucket] = CTRL_EMPTY;
+	--data->size;
+
+	/* ignore a possible -ENOMEM since the table will remain intact */
+	(void)sys_hashmap_oa_gp_rehash(map, false);
+
+	return true;
+}
+
+static bool sys_hashmap_oa_gp_get(const struct sys_hashmap *map, uint64_t key, uint64_t *value)
+{
+	size_t bucket;
+	const struct oagp_entry *const entries = map->data->buckets;
+
+	bucket = sys_hashmap_oa_gp_find(map, key, NULL);
+	if (bucket == SIZE_MAX) {
+		return false;
+	}
+
+	if (value != NULL) {
+		*value = entries[bucket].value;
+	}
+
+	return true;
+}
+
+const struct sys_hashmap_api sys_hashmap_oa_gp_api = {
+	.iter = sys_hashmap_oa_gp_iter,
+	.clear = sys_hashmap_oa_gp_clear,
+	.insert = sys_hashmap_oa_gp_insert,
+	.remove = sys_hashmap_oa_gp_remove,
+	.get = sys_hashmap_oa_gp_get,
+};
@@ -21,16 +21,6 @@ static inline void increase_allocated_bytes(struct z_heap *h, size_t num_bytes)
 }
 #endif
 
-static void *chunk_mem(struct z_heap *h, chunkid_t c)
-{
-	chunk_unit_t *buf = chunk_buf(h);
-	uint8_t *ret = ((uint8_t *)&buf[c]) + chunk_header_bytes(h);
-
-	CHECK(!(((uintptr_t)ret) & (big_heap(h) ? 7 : 3)));
-
-	return ret;
-}
-
 static void free_list_remove_bidx(struct z_heap *h, chunkid_t c, int bidx)
 {
 	struct z_heap_bucket *b = &h->buckets[bidx];
@@ -148,18 +138,6 @@ static void free_chunk(struct z_heap *h, chunkid_t c)
 	free_list_add(h, c);
 }
 
-/*
- * Return the closest chunk ID corresponding to given memory pointer.
- * Here "closest" is only meaningful in the context of sys_heap_aligned_alloc()
- * where wanted alignment might not always correspond to a chunk header
- * boundary.
- */
-static chunkid_t mem_to_chunkid(struct z_heap *h, void *p)
-{
-	uint8_t *mem = p, *base = (uint8_t *)chunk_buf(h);
-	return (mem - chunk_header_bytes(h) - base) / CHUNK_UNIT;
-}
-
 void sys_heap_free(struct sys_heap *heap, void *mem)
 {
 	if (mem == NULL) {
@@ -548,6 +526,9 @@ void sys_heap_init(struct sys_heap *heap, void *mem, size_t bytes)
 
 	struct z_heap *h = (struct z_heap *)addr;
 	heap->heap = h;
+#ifdef CONFIG_SYS_HEAP_CPU_CACHE
+	heap->cache = NULL;
+#endif
 	h->end_chunk = heap_sz;
 	h->avail_buckets = 0;
 
@@ -0,0 +1,136 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#include <zephyr/sys/sys_heap.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/kernel.h>
+#include <string.h>
+#include "heap.h"
+
+#define CACHE_CLASSES CONFIG_SYS_HEAP_CPU_CACHE_CLASSES
+#define CACHE_DEPTH   CONFIG_SYS_HEAP_CPU_CACHE_DEPTH
+
+/* Magazine index for a chunk size, or -1 if that size isn't cached */
+static inline int cache_class(chunksz_t sz)
+{
+	return ((sz > 0U) && (sz <= CACHE_CLASSES)) ? (int)sz - 1 : -1;
+}
+
+void sys_heap_cache_init(struct sys_heap *heap, struct sys_heap_cpu_cache *cache)
+{
+	if (cache != NULL) {
+		memset(cache, 0, CONFIG_MP_MAX_NUM_CPUS * sizeof(*cache));
+	}
+	heap->cache = cache;
+}
+
+void *sys_heap_cache_alloc(struct sys_heap *heap, unsigned int cpu, size_t bytes)
+{
+	struct sys_heap_cpu_cache *cache;
+	int cls;
+
+	if ((heap->cache == NULL) || (bytes == 0U)) {
+		return NULL;
+	}
+
+	cls = cache_class(bytes_to_chunksz(heap->heap, bytes, 0));
+	if (cls < 0) {
+		return NULL;
+	}
+
+	cache = &heap->cache[cpu];
+	if (cache->count[cls] == 0U) {
+		cache->misses++;
+		return NULL;
+	}
+
+	cache->hits++;
+	return cache->blocks[cls][--cache->count[cls]];
+}
+
+bool sys_heap_cache_free(struct sys_heap *heap, unsigned int cpu, void *mem)
+{
+	struct z_heap *h = heap->heap;
+	struct sys_heap_cpu_cache *cache;
+	chunkid_t c;
+	int cls;
+
+	if ((heap->cache == NULL) || (mem == NULL)) {
+		return false;
+	}
+
+	c = mem_to_chunkid(h, mem);
+
+	/* Same cheap sanity checks as sys_heap_free() */
+	__ASSERT(chunk_used(h, c),
+		 "unexpected heap state (double-free?) for memory at %p", mem);
+	__ASSERT(left_chunk(h, right_chunk(h, c)) == c,
+		 "corrupted heap bounds (buffer overflow?) for memory at %p",
+		 mem);
+
+	/* Aligned blocks may start past the chunk's natural payload
+	 * address and would come up short for a plain allocation.
+	 */
+	cls = cache_class(chunk_size(h, c));
+	if ((cls < 0) || (mem != chunk_mem(h, c))) {
+		return false;
+	}
+
+	cache = &heap->cache[cpu];
+	if (cache->count[cls] == CACHE_DEPTH) {
+		return false;
+	}
+
+	cache->blocks[cls][cache->count[cls]++] = mem;
+	return true;
+}
+
+void *sys_heap_cache_refill(struct sys_heap *heap, unsigned int cpu, size_t bytes)
+{
+	void *mem = sys_heap_alloc(heap, bytes);
+	struct sys_heap_cpu_cache *cache;
+	int cls;
+
+	if ((mem == NULL) || (heap->cache == NULL)) {
+		return mem;
+	}
+
+	cls = cache_class(chunk_size(heap->heap, mem_to_chunkid(heap->heap, mem)));
+	if (cls < 0) {
+		return mem;
+	}
+
+	cache = &heap->cache[cpu];
+	for (int n = CACHE_DEPTH / 2; (n > 0) && (cache->count[cls] < CACHE_DEPTH); n--) {
+		void *extra = sys_heap_alloc(heap, bytes);
+
+		if (extra == NULL) {
+			break;
+		}
+		cache->blocks[cls][cache->count[cls]++] = extra;
+	}
+
+	return mem;
+}
+
+size_t sys_heap_cache_drain(struct sys_heap *heap, unsigned int cpu, size_t keep)
+{
+	struct sys_heap_cpu_cache *cache;
+	size_t freed = 0;
+
+	if (heap->cache == NULL) {
+		return 0;
+	}
+
+	cache = &heap->cache[cpu];
+	for (int i = 0; i < CACHE_CLASSES; i++) {
+		while (cache->count[i] > keep) {
+			sys_heap_free(heap, cache->blocks[i][--cache->count[i]]);
+			freed++;
+		}
+	}
+
+	return freed;
+}
@@ -19,6 +19,27 @@ int sys_heap_runtime_stats_get(struct sys_heap *heap,
 	stats->allocated_bytes = heap->heap->allocated_bytes;
 	stats->max_allocated_bytes = heap->heap->max_allocated_bytes;
 
+#ifdef CONFIG_SYS_HEAP_CPU_CACHE
+	stats->cache_hits = 0U;
+	stats->cache_misses = 0U;
+
+	/* Cached blocks are allocated as far as the heap knows, but
+	 * nobody owns them: report them as free.
+	 */
+	for (unsigned int cpu = 0; (heap->cache != NULL) && (cpu < arch_num_cpus()); cpu++) {
+		struct sys_heap_cpu_cache *cache = &heap->cache[cpu];
+
+		for (int i = 0; i < CONFIG_SYS_HEAP_CPU_CACHE_CLASSES; i++) {
+			size_t cached = chunksz_to_bytes(heap->heap, i + 1) * cache->count[i];
+
+			stats->allocated_bytes -= cached;
+			stats->free_bytes += cached;
+		}
+		stats->cache_hits += cache->hits;
+		stats->cache_misses += cache->misses;
+	}
+#endif
+
 	return 0;
 }
 
@@ -10,6 +10,11 @@
 #include <stdint.h>
 #include <sys/types.h>
 
+#define MEM_WORD_ONES ((mem_word_t)-1 / 0xff)
+
+/* Non-zero if any byte of <w> is zero */
+#define MEM_WORD_HAS_ZERO(w) (((w) - MEM_WORD_ONES) & ~(w) & (MEM_WORD_ONES << 7))
+
 /**
  *
  * @brief Copy a string
@@ -106,14 +111,38 @@ char *strrchr(const char *s, int c)
 
 size_t strlen(const char *s)
 {
-	size_t n = 0;
+	const char *start = s;
+
+#if !defined(CONFIG_MINIMAL_LIBC_OPTIMIZE_STRING_FOR_SIZE)
+	/* do byte-sized scanning until word-aligned */
+
+	while (((uintptr_t)s) & (sizeof(mem_word_t) - 1)) {
+		if (*s == '\0') {
+			return s - start;
+		}
+		s++;
+	}
+
+	/*
+	 * Scan a word at a time until a word holds a zero byte. Aligned
+	 * words never cross a page or memory region boundary, so reading
+	 * past the terminator within its word is harmless.
+	 */
+
+	const mem_word_t *s_word = (const mem_word_t *)s;
+
+	while (!MEM_WORD_HAS_ZERO(*s_word)) {
+		s_word++;
+	}
+
+	s = (const char *)s_word;
+#endif
 
 	while (*s != '\0') {
 		s++;
-		n++;
 	}
 
-	return n;
+	return s - start;
 }
 
 /**
@@ -234,6 +263,123 @@ int memcmp(const void *m1, const void *m2, size_t n)
 	return *c1 - *c2;
 }
 
+#if !defined(CONFIG_MINIMAL_LIBC_OPTIMIZE_STRING_FOR_SIZE)
+/*
+ * Copy whole words forward from a source not aligned like the word-aligned
+ * destination. Source words are read aligned and shifted into place, so no
+ * byte outside the source is accessed. Also safe when <d> is below an
+ * overlapping <s>, as every source byte is read before its location is
+ * written.
+ *
+ * Returns the number of bytes copied; the caller copies the remainder.
+ */
+static size_t copy_words_shifted(mem_word_t *d_word, const unsigned char *s_byte, size_t n)
+{
+	const size_t word = sizeof(mem_word_t);
+	const size_t offset = (uintptr_t)s_byte & (word - 1);
+	const unsigned int lo_shift = 8 * offset;
+	const unsigned int hi_shift = 8 * (word - offset);
+	const mem_word_t *s_word;
+	mem_word_t prev = 0;
+	mem_word_t next;
+	size_t copied = 0;
+
+	if (n < 2 * word) {
+		return 0;
+	}
+
+	/* gather the source bytes up to the next aligned source word */
+
+	for (size_t i = offset; i < word; i++) {
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+		prev |= (mem_word_t)*(s_byte++) << (8 * (word - 1 - i));
+#else
+		prev |= (mem_word_t)*(s_byte++) << (8 * i);
+#endif
+	}
+
+	s_word = (const mem_word_t *)s_byte;
+
+	/* the bytes gathered in <prev> are read but not yet written */
+
+	while (n - copied >= (word - offset) + word) {
+		next = *(s_word++);
+#if __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+		*(d_word++) = (prev << lo_shift) | (next >> hi_shift);
+#else
+		*(d_word++) = (prev >> lo_shift) | (next << hi_shift);
+#endif
+		prev = next;
+		copied += word;
+	}
+
+	return copied;
+}
+
+/*
+ * Copy forward, a word at a time where possible. Also safe when <d> is
+ * below an overlapping <s>.
+ */
+static void copy_forward(unsigned char *d_byte, const unsigned char *s_byte, size_t n)
+{
+	const uintptr_t mask = sizeof(mem_word_t) - 1;
+
+	if (n >= 2 * sizeof(mem_word_t)) {
+
+		/* do byte-sized copying until the destination is word-aligned */
+
+		while (((uintptr_t)d_byte) & mask) {
+			*(d_byte++) = *(s_byte++);
+			n--;
+		}
+
+		mem_word_t *d_word = (mem_word_t *)d_byte;
+
+		if ((((uintptr_t)s_byte) & mask) == 0) {
+			const mem_word_t *s_word = (const mem_word_t *)s_byte;
+
+			/* do word-sized copying, four words per iteration */
+
+			while (n >= 4 * sizeof(mem_word_t)) {
+				mem_word_t w0 = s_word[0];
+				mem_word_t w1 = s_word[1];
+				mem_word_t w2 = s_word[2];
+				mem_word_t w3 = s_word[3];
+
+				d_word[0] = w0;
+				d_word[1] = w1;
+				d_word[2] = w2;
+				d_word[3] = w3;
+				d_word += 4;
+				s_word += 4;
+				n -= 4 * sizeof(mem_word_t);
+			}
+
+			while (n >= sizeof(mem_word_t)) {
+				*(d_word++) = *(s_word++);
+				n -= sizeof(mem_word_t);
+			}
+
+			d_byte = (unsigned char *)d_word;
+			s_byte = (const unsigned char *)s_word;
+		} else {
+			size_t copied = copy_words_shifted(d_word, s_byte, n);
+
+			d_byte += copied;
+			s_byte += copied;
+			n -= copied;
+		}
+	}
+
+	/* do byte-sized copying until finished */
+
+	while (n > 0) {
+		*(d_byte++) = *(s_byte++);
+		n--;
+	}
+}
+#endif
+
 /**
  *
  * @brief Copy bytes in memory with overlapping areas
@@ -252,18 +398,46 @@ void *memmove(void *d, const void *s, size_t n)
 		 * Copy backwards to prevent the premature corruption of <src>.
 		 */
 
+#if !defined(CONFIG_MINIMAL_LIBC_OPTIMIZE_STRING_FOR_SIZE)
+		const uintptr_t mask = sizeof(mem_word_t) - 1;
+
+		if ((((uintptr_t)dest ^ (uintptr_t)src) & mask) == 0) {
+
+			/* do byte-sized copying until word-aligned or finished */
+
+			while (((uintptr_t)(dest + n)) & mask) {
+				if (n == 0) {
+					return d;
+				}
+				n--;
+				dest[n] = src[n];
+			}
+
+			/* do word-sized copying as long as possible */
+
+			while (n >= sizeof(mem_word_t)) {
+				n -= sizeof(mem_word_t);
+				*(mem_word_t *)(dest + n) = *(const mem_word_t *)(src + n);
+			}
+		}
+#endif
+
 		while (n > 0) {
 			n--;
 			dest[n] = src[n];
 		}
 	} else {
 		/* It is safe to perform a forward-copy */
+#if !defined(CONFIG_MINIMAL_LIBC_OPTIMIZE_STRING_FOR_SIZE)
+		copy_forward((unsigned char *)dest, (const unsigned char *)src, n);
+#else
 		while (n > 0) {
 			*dest = *src;
 			dest++;
 			src++;
 			n--;
 		}
+#endif
 	}
 
 	return d;
@@ -278,47 +452,19 @@ void *memmove(void *d, const void *s, size_t n)
 
 void *memcpy(void *ZRESTRICT d, const void *ZRESTRICT s, size_t n)
 {
-	/* attempt word-sized copying only if buffers have identical alignment */
-
+#if !defined(CONFIG_MINIMAL_LIBC_OPTIMIZE_STRING_FOR_SIZE)
+	copy_forward((unsigned char *)d, (const unsigned char *)s, n);
+#else
 	unsigned char *d_byte = (unsigned char *)d;
 	const unsigned char *s_byte = (const unsigned char *)s;
 
-#if !defined(CONFIG_MINIMAL_LIBC_OPTIMIZE_STRING_FOR_SIZE)
-	const uintptr_t mask = sizeof(mem_word_t) - 1;
-
-	if ((((uintptr_t)d ^ (uintptr_t)s_byte) & mask) == 0) {
-
-		/* do byte-sized copying until word-aligned or finished */
-
-		while (((uintptr_t)d_byte) & mask) {
-			if (n == 0) {
-				return d;
-			}
-			*(d_byte++) = *(s_byte++);
-			n--;
-		}
-
-		/* do word-sized copying as long as possible */
-
-		mem_word_t *d_word = (mem_word_t *)d_byte;
-		const mem_word_t *s_word = (const mem_word_t *)s_byte;
-
-		while (n >= sizeof(mem_word_t)) {
-			*(d_word++) = *(s_word++);
-			n -= sizeof(mem_word_t);
-		}
-
-		d_byte = (unsigned char *)d_word;
-		s_byte = (unsigned char *)s_word;
-	}
-#endif
-
 	/* do byte-sized copying until finished */
 
 	while (n > 0) {
 		*(d_byte++) = *(s_byte++);
 		n--;
 	}
+#endif
 
 	return d;
 }
@@ -357,6 +503,15 @@ void *memset(void *buf, int c, size_t n)
 	c_word |= c_word << 32;
 #endif
 
+	while (n >= 4 * sizeof(mem_word_t)) {
+		d_word[0] = c_word;
+		d_word[1] = c_word;
+		d_word[2] = c_word;
+		d_word[3] = c_word;
+		d_word += 4;
+		n -= 4 * sizeof(mem_word_t);
+	}
+
 	while (n >= sizeof(mem_word_t)) {
 		*(d_word++) = c_word;
 		n -= sizeof(mem_word_t);
@@ -230,6 +230,130 @@ const struct net_buf_data_alloc net_buf_heap_alloc = {
 
 #endif /* K_HEAP_MEM_POOL_SIZE > 0 */
 
+#if CONFIG_NET_BUF_POOL_CPU_CACHE_SIZE > 0
+static struct net_buf_pool_cpu_cache *local_cache(struct net_buf_pool *pool)
+{
+	/* Being migrated meanwhile only means using another CPU's cache */
+	return &pool->cpu_cache[arch_curr_cpu()->id];
+}
+
+static size_t cache_get(struct net_buf_pool *pool, struct net_buf **bufs, size_t count)
+{
+	struct net_buf_pool_cpu_cache *cache = local_cache(pool);
+	k_spinlock_key_t key;
+	size_t n = 0;
+
+	key = k_spin_lock(&cache->lock);
+
+	while (n < count && cache->count > 0) {
+		bufs[n++] = cache->bufs[--cache->count];
+	}
+
+	k_spin_unlock(&cache->lock, key);
+
+	return n;
+}
+
+/* Move the buffers cached by all CPUs to the free LIFO, for threads to wait on it */
+static void cache_flush_all(struct net_buf_pool *pool)
+{
+	unsigned int num_cpus = arch_num_cpus();
+
+	for (unsigned int cpu = 0; cpu < num_cpus; cpu++) {
+		struct net_buf_pool_cpu_cache *cache = &pool->cpu_cache[cpu];
+		struct net_buf *head = NULL;
+		struct net_buf *tail = NULL;
+		k_spinlock_key_t key;
+
+		key = k_spin_lock(&cache->lock);
+
+		while (cache->count > 0) {
+			struct net_buf *buf = cache->bufs[--cache->count];
+
+			buf->node.next = (head != NULL) ? &head->node : NULL;
+			head = buf;
+			if (tail == NULL) {
+				tail = buf;
+			}
+		}
+
+		k_spin_unlock(&cache->lock, key);
+
+		if (head != NULL) {
+			k_queue_append_list(&pool->free._queue, head, tail);
+		}
+	}
+}
+#endif /* CONFIG_NET_BUF_POOL_CPU_CACHE_SIZE > 0 */
+
+void z_net_buf_pool_put_list(struct net_buf_pool *pool, struct net_buf *head,
+			     struct net_buf *tail)
+{
+#if CONFIG_NET_BUF_POOL_CPU_CACHE_SIZE > 0
+	struct net_buf_pool_cpu_cache *cache = local_cache(pool);
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&cache->lock);
+
+	/* Threads waiting on the free LIFO must get the buffers. Checking with
+	 * the cache locked pairs with cache_flush_all() called by these threads
+	 * once they are counted.
+	 */
+	if (atomic_get(&pool->cache_waiters) == 0) {
+		while (head != NULL && cache->count < CONFIG_NET_BUF_POOL_CPU_CACHE_SIZE) {
+			cache->bufs[cache->count++] = head;
+			head = (head == tail) ? NULL : (struct net_buf *)head->node.next;
+		}
+	}
+
+	k_spin_unlock(&cache->lock, key);
+
+	if (head == NULL) {
+		return;
+	}
+#endif
+
+	if (head == tail) {
+		k_lifo_put(&pool->free, head);
+	} else {
+		k_queue_append_list(&pool->free._queue, head, tail);
+	}
+}
+
+/* Buffers to return to a pool together, linked through their node */
+struct free_list {
+	struct net_buf_pool *pool;
+	struct net_buf *head;
+	struct net_buf *tail;
+};
+
+static void free_list_flush(struct free_list *list)
+{
+	if (list->head != NULL) {
+		z_net_buf_pool_put_list(list->pool, list->head, list->tail);
+		list->head = NULL;
+	}
+}
+
+static void free_list_add(struct free_list *list, struct net_buf_pool *pool,
+			  struct net_buf *buf)
+{
+	if (list->head != NULL && list->pool != pool) {
+		free_list_flush(list);
+	}
+
+	buf->node.next = NULL;
+
+	if (list->head == NULL) {
+		list->pool = pool;
+		list->head = buf;
+	} else {
+		list->tail->node.next = &buf->node;
+	}
+
+	list->tail = buf;
+}
+
 static uint8_t *data_alloc(struct net_buf *buf, size_t *size, k_timeout_t timeout)
 {
 	struct net_buf_pool *pool = net_buf_pool_get(buf->pool_id);
@@ -244,6 +368,45 @@ static uint8_t *data_ref(struct net_buf *buf, uint8_t *data)
 	return pool->alloc->cb->ref(buf, data);
 }
 
+/* Allocate the data of a buffer taken from the pool and initialize it */
+static int buf_setup(struct net_buf_pool *pool, struct net_buf *buf, size_t size,
+		     k_timepoint_t end)
+{
+	NET_BUF_DBG("allocated buf %p", buf);
+
+	if (size) {
+#if __ASSERT_ON
+		size_t req_size = size;
+#endif
+		buf->__buf = data_alloc(buf, &size, sys_timepoint_timeout(end));
+		if (!buf->__buf) {
+			net_buf_destroy(buf);
+			return -ENOMEM;
+		}
+
+#if __ASSERT_ON
+		NET_BUF_ASSERT(req_size <= size);
+#endif
+	} else {
+		buf->__buf = NULL;
+	}
+
+	buf->ref   = 1U;
+	buf->flags = 0U;
+	buf->frags = NULL;
+	buf->size  = size;
+	memset(buf->user_data, 0, buf->user_data_size);
+	net_buf_reset(buf);
+
+#if defined(CONFIG_NET_BUF_POOL_USAGE)
+	atomic_dec(&pool->avail_count);
+	__ASSERT_NO_MSG(atomic_get(&pool->avail_count) >= 0);
+	pool->max_used = MAX(pool->max_used,
+			     pool->buf_count - atomic_get(&pool->avail_count));
+#endif
+	return 0;
+}
+
 #if defined(CONFIG_NET_BUF_LOG)
 struct net_buf *net_buf_alloc_len_debug(struct net_buf_pool *pool, size_t size,
 					k_timeout_t timeout, const char *func,
@@ -261,6 +424,12 @@ struct net_buf *net_buf_alloc_len(struct net_buf_pool *pool, size_t size,
 
 	NET_BUF_DBG("%s():%d: pool %p size %zu", func, line, pool, size);
 
+#if CONFIG_NET_BUF_POOL_CPU_CACHE_SIZE > 0
+	if (cache_get(pool, &buf, 1) > 0) {
+		goto success;
+	}
+#endif
+
 	/* We need to prevent race conditions
 	 * when accessing pool->uninit_count.
 	 */
@@ -293,6 +462,17 @@ struct net_buf *net_buf_alloc_len(struct net_buf_pool *pool, size_t size,
 
 	k_spin_unlock(&pool->lock, key);
 
+#if CONFIG_NET_BUF_POOL_CPU_CACHE_SIZE > 0
+	buf = k_lifo_get(&pool->free, K_NO_WAIT);
+	if (buf) {
+		goto success;
+	}
+
+	/* Gather the buffers cached by all CPUs before waiting for one */
+	atomic_inc(&pool->cache_waiters);
+	cache_flush_all(pool);
+#endif
+
 #if defined(CONFIG_NET_BUF_LOG) && (CONFIG_NET_BUF_LOG_LEVEL >= LOG_LEVEL_WRN)
 	if (K_TIMEOUT_EQ(timeout, K_FOREVER)) {
 		uint32_t ref = k_uptime_get_32();
@@ -321,6 +501,9 @@ struct net_buf *net_buf_alloc_len(struct net_buf_pool *pool, size_t size,
 	}
 #else
 	buf = k_lifo_get(&pool->free, timeout);
+#endif
+#if CONFIG_NET_BUF_POOL_CPU_CACHE_SIZE > 0
+	atomic_dec(&pool->cache_waiters);
 #endif
 	if (!buf) {
 		NET_BUF_ERR("%s():%d: Failed to get free buffer", func, line);
@@ -328,42 +511,81 @@ struct net_buf *net_buf_alloc_len(struct net_buf_pool *pool, size_t size,
 	}
 
 success:
-	NET_BUF_DBG("allocated buf %p", buf);
+	if (buf_setup(pool, buf, size, end) < 0) {
+		NET_BUF_ERR("%s():%d: Failed to allocate data", func, line);
+		return NULL;
+	}
 
-	if (size) {
-#if __ASSERT_ON
-		size_t req_size = size;
+	return buf;
+}
+
+#if defined(CONFIG_NET_BUF_LOG)
+size_t net_buf_alloc_batch_debug(struct net_buf_pool *pool, size_t size,
+				 struct net_buf **bufs, size_t count,
+				 k_timeout_t timeout, const char *func, int line)
+#else
+size_t net_buf_alloc_batch(struct net_buf_pool *pool, size_t size,
+			   struct net_buf **bufs, size_t count,
+			   k_timeout_t timeout)
 #endif
-		timeout = sys_timepoint_timeout(end);
-		buf->__buf = data_alloc(buf, &size, timeout);
-		if (!buf->__buf) {
-			NET_BUF_ERR("%s():%d: Failed to allocate data",
-				    func, line);
-			net_buf_destroy(buf);
-			return NULL;
-		}
+{
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	k_spinlock_key_t key;
+	size_t taken = 0;
+	size_t n = 0;
 
-#if __ASSERT_ON
-		NET_BUF_ASSERT(req_size <= size);
+	__ASSERT_NO_MSG(pool);
+	__ASSERT_NO_MSG(bufs || count == 0);
+
+	NET_BUF_DBG("%s():%d: pool %p size %zu count %zu", func, line, pool, size, count);
+
+#if CONFIG_NET_BUF_POOL_CPU_CACHE_SIZE > 0
+	taken = cache_get(pool, bufs, count);
 #endif
-	} else {
-		buf->__buf = NULL;
+
+	/* Reuse freed buffers first, then take as many uninitialized ones as
+	 * still needed, each source under a single lock.
+	 */
+	taken += k_queue_get_multi(&pool->free._queue, (void **)&bufs[taken], count - taken);
+
+	key = k_spin_lock(&pool->lock);
+
+	while (taken < count && pool->uninit_count) {
+		bufs[taken++] = pool_get_uninit(pool, pool->uninit_count--);
 	}
 
-	buf->ref   = 1U;
-	buf->flags = 0U;
-	buf->frags = NULL;
-	buf->size  = size;
-	memset(buf->user_data, 0, buf->user_data_size);
-	net_buf_reset(buf);
+	k_spin_unlock(&pool->lock, key);
 
-#if defined(CONFIG_NET_BUF_POOL_USAGE)
-	atomic_dec(&pool->avail_count);
-	__ASSERT_NO_MSG(atomic_get(&pool->avail_count) >= 0);
-	pool->max_used = MAX(pool->max_used,
-			     pool->buf_count - atomic_get(&pool->avail_count));
+	for (size_t i = 0; i < taken; i++) {
+		if (buf_setup(pool, bufs[i], size, end) < 0) {
+			NET_BUF_ERR("%s():%d: Failed to allocate data", func, line);
+			continue;
+		}
+
+		bufs[n++] = bufs[i];
+	}
+
+	/* Out of data, no need to take more buffers */
+	if (n < taken) {
+		return n;
+	}
+
+	/* Allocate the remaining buffers one by one */
+	while (n < count) {
+#if defined(CONFIG_NET_BUF_LOG)
+		bufs[n] = net_buf_alloc_len_debug(pool, size, sys_timepoint_timeout(end),
+						  func, line);
+#else
+		bufs[n] = net_buf_alloc_len(pool, size, sys_timepoint_timeout(end));
 #endif
-	return buf;
+		if (!bufs[n]) {
+			break;
+		}
+
+		n++;
+	}
+
+	return n;
 }
 
 #if defined(CONFIG_NET_BUF_LOG)
@@ -440,11 +662,10 @@ struct net_buf *net_buf_slist_get(sys_slist_t *list)
 	return buf;
 }
 
-#if defined(CONFIG_NET_BUF_LOG)
-void net_buf_unref_debug(struct net_buf *buf, const char *func, int line)
-#else
-void net_buf_unref(struct net_buf *buf)
-#endif
+/* Drop a reference on a buffer and its fragments, collecting the ones going
+ * back to their pool in @a list.
+ */
+static void buf_unref(struct net_buf *buf, struct free_list *list, const char *func, int line)
 {
 	__ASSERT_NO_MSG(buf);
 
@@ -479,13 +700,57 @@ void net_buf_unref(struct net_buf *buf)
 		if (pool->destroy) {
 			pool->destroy(buf);
 		} else {
-			net_buf_destroy(buf);
+			/* As net_buf_destroy(), returning the buffer with the others */
+			if (buf->__buf) {
+				if (!(buf->flags & NET_BUF_EXTERNAL_DATA)) {
+					pool->alloc->cb->unref(buf, buf->__buf);
+				}
+				buf->__buf = NULL;
+			}
+
+			free_list_add(list, pool, buf);
 		}
 
 		buf = frags;
 	}
 }
 
+#if defined(CONFIG_NET_BUF_LOG)
+void net_buf_unref_debug(struct net_buf *buf, const char *func, int line)
+#else
+void net_buf_unref(struct net_buf *buf)
+#endif
+{
+	struct free_list list = { 0 };
+
+#if defined(CONFIG_NET_BUF_LOG)
+	buf_unref(buf, &list, func, line);
+#else
+	buf_unref(buf, &list, NULL, 0);
+#endif
+	free_list_flush(&list);
+}
+
+#if defined(CONFIG_NET_BUF_LOG)
+void net_buf_unref_batch_debug(struct net_buf **bufs, size_t count, const char *func,
+			       int line)
+#else
+void net_buf_unref_batch(struct net_buf **bufs, size_t count)
+#endif
+{
+	struct free_list list = { 0 };
+
+	for (size_t i = 0; i < count; i++) {
+#if defined(CONFIG_NET_BUF_LOG)
+		buf_unref(bufs[i], &list, func, line);
+#else
+		buf_unref(bufs[i], &list, NULL, 0);
+#endif
+	}
+
+	free_list_flush(&list);
+}
+
 struct net_buf *net_buf_ref(struct net_buf *buf)
 {
 	__ASSERT_NO_MSG(buf);
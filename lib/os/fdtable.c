@@ -26,6 +26,10 @@
 
 struct stat;
 
+#if defined(CONFIG_ZVFS_EPOLL)
+void zvfs_epoll_close_fd(int fd);
+#endif
+
 struct fd_entry {
 	void *obj;
 	const struct fd_op_vtable *vtable;
@@ -392,6 +396,11 @@ int zvfs_close(int fd)
 		return -1;
 	}
 
+#if defined(CONFIG_ZVFS_EPOLL)
+	/* Drop the descriptor from epoll instances before it can be reused */
+	zvfs_epoll_close_fd(fd);
+#endif
+
 	(void)k_mutex_lock(&fdtable[fd].lock, K_FOREVER);
 	if (fdtable[fd].vtable->close != NULL) {
 		/* close() is optional - e.g. stdinout_fd_op_vtable */
@@ -8,6 +8,7 @@
 #include <zephyr/sys/mutex.h>
 #include <zephyr/internal/syscall_handler.h>
 #include <zephyr/kernel_structs.h>
+#include <kernel_internal.h>
 
 static struct k_mutex *get_k_mutex(struct sys_mutex *mutex)
 {
@@ -72,3 +73,144 @@ static inline int z_vrfy_z_sys_mutex_kernel_unlock(struct sys_mutex *mutex)
 	return z_impl_z_sys_mutex_kernel_unlock(mutex);
 }
 #include <zephyr/syscalls/z_sys_mutex_kernel_unlock_mrsh.c>
+
+#ifdef CONFIG_SYS_MUTEX_FUTEX
+/* Set in the mutex word when threads may be waiting for the mutex */
+#define SYS_MUTEX_CONTENDED ((atomic_val_t)BIT(0))
+
+/* Protects the wait queues of all futex mode mutexes, only taken on contention */
+static struct k_spinlock futex_lock;
+
+int z_impl_z_sys_mutex_kernel_wait(struct sys_mutex *mutex, atomic_val_t expected,
+				   k_timeout_t timeout)
+{
+	struct k_mutex *kernel_mutex = get_k_mutex(mutex);
+
+	if (kernel_mutex == NULL) {
+		return -EINVAL;
+	}
+
+	/* The backing k_mutex is never locked in futex mode, waiters just
+	 * borrow its wait queue
+	 */
+	return z_futex_wait_queue(&mutex->val, expected, &futex_lock,
+				  &kernel_mutex->wait_q, timeout);
+}
+
+static inline int z_vrfy_z_sys_mutex_kernel_wait(struct sys_mutex *mutex,
+						 atomic_val_t expected,
+						 k_timeout_t timeout)
+{
+	if (check_sys_mutex_addr(mutex)) {
+		return -EACCES;
+	}
+
+	return z_impl_z_sys_mutex_kernel_wait(mutex, expected, timeout);
+}
+#include <zephyr/syscalls/z_sys_mutex_kernel_wait_mrsh.c>
+
+int z_impl_z_sys_mutex_kernel_wake(struct sys_mutex *mutex)
+{
+	struct k_mutex *kernel_mutex = get_k_mutex(mutex);
+
+	if (kernel_mutex == NULL) {
+		return -EINVAL;
+	}
+
+	return z_futex_wake_queue(&futex_lock, &kernel_mutex->wait_q, false);
+}
+
+static inline int z_vrfy_z_sys_mutex_kernel_wake(struct sys_mutex *mutex)
+{
+	if (check_sys_mutex_addr(mutex)) {
+		return -EACCES;
+	}
+
+	return z_impl_z_sys_mutex_kernel_wake(mutex);
+}
+#include <zephyr/syscalls/z_sys_mutex_kernel_wake_mrsh.c>
+
+/* The functions below run in the caller's mode: the kernel is only
+ * entered to wait for, or to wake up, a contender.
+ */
+int z_sys_mutex_futex_lock(struct sys_mutex *mutex, k_timeout_t timeout)
+{
+	atomic_val_t self = (atomic_val_t)k_current_get();
+	k_timepoint_t end;
+	atomic_val_t val;
+	int ret;
+
+	if (atomic_cas(&mutex->val, 0, self)) {
+		mutex->lock_count = 1U;
+		return 0;
+	}
+
+	if ((atomic_get(&mutex->val) & ~SYS_MUTEX_CONTENDED) == self) {
+		mutex->lock_count++;
+		return 0;
+	}
+
+	end = sys_timepoint_calc(timeout);
+
+	for (;;) {
+		val = atomic_get(&mutex->val);
+		if (val == 0) {
+			/* Others may still be waiting, have the unlock wake them */
+			if (atomic_cas(&mutex->val, 0, self | SYS_MUTEX_CONTENDED)) {
+				mutex->lock_count = 1U;
+				return 0;
+			}
+			continue;
+		}
+
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			return -EBUSY;
+		}
+
+		if (sys_timepoint_expired(end)) {
+			return -EAGAIN;
+		}
+
+		if ((val & SYS_MUTEX_CONTENDED) == 0) {
+			if (!atomic_cas(&mutex->val, val, val | SYS_MUTEX_CONTENDED)) {
+				continue;
+			}
+			val |= SYS_MUTEX_CONTENDED;
+		}
+
+		ret = z_sys_mutex_kernel_wait(mutex, val, sys_timepoint_timeout(end));
+		if ((ret != 0) && (ret != -EAGAIN) && (ret != -ETIMEDOUT)) {
+			return ret;
+		}
+	}
+}
+
+int z_sys_mutex_futex_unlock(struct sys_mutex *mutex)
+{
+	atomic_val_t self = (atomic_val_t)k_current_get();
+	atomic_val_t val = atomic_get(&mutex->val);
+	int ret;
+
+	if (val == 0) {
+		return -EINVAL;
+	}
+
+	if ((val & ~SYS_MUTEX_CONTENDED) != self) {
+		return -EPERM;
+	}
+
+	if (--mutex->lock_count > 0U) {
+		return 0;
+	}
+
+	if (atomic_cas(&mutex->val, self, 0)) {
+		return 0;
+	}
+
+	/* Contended: release, then wake one waiter to compete for it */
+	atomic_clear(&mutex->val);
+	ret = z_sys_mutex_kernel_wake(mutex);
+
+	return (ret < 0) ? ret : 0;
+}
+#endif /* CONFIG_SYS_MUTEX_FUTEX */
@@ -0,0 +1,428 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+
+#include <zephyr/init.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/bitarray.h>
+#include <zephyr/sys/dlist.h>
+#include <zephyr/sys/fdtable.h>
+#include <zephyr/zvfs/epoll.h>
+
+/* Poll events a single descriptor may prepare (one per direction) */
+#define ZVFS_EPOLL_PEV_MAX 2
+
+#define ZVFS_EPOLL_EVENTS                                                                          \
+	(ZVFS_EPOLLIN | ZVFS_EPOLLPRI | ZVFS_EPOLLOUT | ZVFS_EPOLLERR | ZVFS_EPOLLHUP)
+
+struct zvfs_epoll_entry {
+	/* tag holds the index, to find the entry back from a ready event */
+	struct k_poll_event pev[ZVFS_EPOLL_PEV_MAX];
+	struct zvfs_epoll_event event;
+	/* on the instance pending list while waiting to be reported */
+	sys_dnode_t node;
+	int fd;
+	uint8_t num_pev;
+	/* POLL_PREPARE found the descriptor ready without a kernel object */
+	bool sticky;
+	/* reported at least once, edge-triggered entries are now armed on edges */
+	bool reported;
+};
+
+struct zvfs_epoll {
+	struct k_mutex lock;
+	struct k_poll_set set;
+	sys_dlist_t pending;
+	struct zvfs_epoll_entry entries[CONFIG_ZVFS_EPOLL_FD_MAX];
+	bool in_use;
+};
+
+SYS_BITARRAY_DEFINE_STATIC(epolls_bitarray, CONFIG_ZVFS_EPOLL_MAX);
+static struct zvfs_epoll epolls[CONFIG_ZVFS_EPOLL_MAX];
+static const struct fd_op_vtable zvfs_epoll_fd_vtable;
+
+static void zvfs_epoll_disarm(struct zvfs_epoll *ep, struct zvfs_epoll_entry *entry)
+{
+	for (int i = 0; i < entry->num_pev; i++) {
+		(void)k_poll_set_remove(&ep->set, &entry->pev[i]);
+	}
+
+	entry->num_pev = 0;
+	entry->sticky = false;
+}
+
+static void zvfs_epoll_release(struct zvfs_epoll *ep, struct zvfs_epoll_entry *entry)
+{
+	zvfs_epoll_disarm(ep, entry);
+
+	if (sys_dnode_is_linked(&entry->node)) {
+		sys_dlist_remove(&entry->node);
+	}
+
+	entry->fd = -1;
+}
+
+/* must be called with the instance locked */
+static int zvfs_epoll_arm(struct zvfs_epoll *ep, struct zvfs_epoll_entry *entry)
+{
+	struct zvfs_pollfd pfd = {
+		.fd = entry->fd,
+		.events = entry->event.events & ZVFS_EPOLL_EVENTS,
+	};
+	const struct fd_op_vtable *vtable;
+	struct k_poll_event *pev = entry->pev;
+	struct k_mutex *lock;
+	uint32_t flags = 0U;
+	void *ctx;
+	int result;
+
+	zvfs_epoll_disarm(ep, entry);
+
+	ctx = zvfs_get_fd_obj_and_vtable(entry->fd, &vtable, &lock);
+	if (ctx == NULL) {
+		return -EBADF;
+	}
+
+	(void)k_mutex_lock(lock, K_FOREVER);
+	result = zvfs_fdtable_call_ioctl(vtable, ctx, ZFD_IOCTL_POLL_PREPARE, &pfd, &pev,
+					 entry->pev + ARRAY_SIZE(entry->pev));
+	k_mutex_unlock(lock);
+
+	if (result == -EALREADY) {
+		entry->sticky = true;
+		result = 0;
+	} else if (result == -EXDEV) {
+		/* Offloaded sockets poll through their own driver */
+		return -ENOTSUP;
+	} else if (result < 0) {
+		return (result == -1) ? -errno : result;
+	}
+
+	if (((entry->event.events & ZVFS_EPOLLET) != 0U) && entry->reported) {
+		flags = K_POLL_SET_EDGE;
+	}
+
+	entry->num_pev = pev - entry->pev;
+	for (int i = 0; i < entry->num_pev; i++) {
+		entry->pev[i].tag = i;
+		entry->pev[i].poller = NULL;
+		(void)k_poll_set_add(&ep->set, &entry->pev[i], flags);
+	}
+
+	if (entry->sticky && !sys_dnode_is_linked(&entry->node)) {
+		sys_dlist_append(&ep->pending, &entry->node);
+	}
+
+	return 0;
+}
+
+static struct zvfs_epoll_entry *zvfs_epoll_find(struct zvfs_epoll *ep, int fd)
+{
+	ARRAY_FOR_EACH_PTR(ep->entries, entry) {
+		if (entry->fd == fd) {
+			return entry;
+		}
+	}
+
+	return NULL;
+}
+
+/* must be called with the instance locked */
+static int zvfs_epoll_report(struct zvfs_epoll *ep, struct zvfs_epoll_event *events,
+			     int maxevents)
+{
+	sys_dlist_t requeue = SYS_DLIST_STATIC_INIT(&requeue);
+	struct zvfs_epoll_entry *entry;
+	sys_dnode_t *node;
+	int count = 0;
+
+	while ((count < maxevents) && ((node = sys_dlist_get(&ep->pending)) != NULL)) {
+		struct zvfs_pollfd pfd;
+		const struct fd_op_vtable *vtable;
+		struct k_poll_event *pev;
+		struct k_mutex *lock;
+		void *ctx;
+		int result;
+
+		entry = CONTAINER_OF(node, struct zvfs_epoll_entry, node);
+
+		pfd.fd = entry->fd;
+		pfd.events = entry->event.events & ZVFS_EPOLL_EVENTS;
+		pfd.revents = 0;
+
+		ctx = zvfs_get_fd_obj_and_vtable(entry->fd, &vtable, &lock);
+		if (ctx == NULL) {
+			zvfs_epoll_release(ep, entry);
+			continue;
+		}
+
+		pev = entry->pev;
+		(void)k_mutex_lock(lock, K_FOREVER);
+		result = zvfs_fdtable_call_ioctl(vtable, ctx, ZFD_IOCTL_POLL_UPDATE, &pfd, &pev);
+		k_mutex_unlock(lock);
+
+		if ((result != 0) && (result != -EAGAIN)) {
+			pfd.revents = ZVFS_POLLERR;
+		}
+
+		if (pfd.revents != 0) {
+			events[count].events = pfd.revents;
+			events[count].data = entry->event.data;
+			count++;
+			entry->reported = true;
+		}
+
+		/* The update consumed the event states: take a fresh look */
+		if (zvfs_epoll_arm(ep, entry) < 0) {
+			zvfs_epoll_release(ep, entry);
+			continue;
+		}
+
+		/* Still ready without a kernel object to say so: report again next time,
+		 * unless edge-triggered.
+		 */
+		if (sys_dnode_is_linked(&entry->node)) {
+			sys_dlist_remove(&entry->node);
+			if ((pfd.revents != 0) && ((entry->event.events & ZVFS_EPOLLET) == 0U)) {
+				sys_dlist_append(&requeue, &entry->node);
+			}
+		}
+	}
+
+	while ((node = sys_dlist_get(&requeue)) != NULL) {
+		sys_dlist_append(&ep->pending, node);
+	}
+
+	return count;
+}
+
+static int zvfs_epoll_close_op(void *obj)
+{
+	struct zvfs_epoll *ep = obj;
+
+	(void)k_mutex_lock(&ep->lock, K_FOREVER);
+
+	ARRAY_FOR_EACH_PTR(ep->entries, entry) {
+		if (entry->fd >= 0) {
+			zvfs_epoll_release(ep, entry);
+		}
+	}
+
+	ep->in_use = false;
+	k_mutex_unlock(&ep->lock);
+
+	(void)sys_bitarray_free(&epolls_bitarray, 1, ep - epolls);
+
+	return 0;
+}
+
+static const struct fd_op_vtable zvfs_epoll_fd_vtable = {
+	.close = zvfs_epoll_close_op,
+};
+
+void zvfs_epoll_close_fd(int fd)
+{
+	ARRAY_FOR_EACH_PTR(epolls, ep) {
+		struct zvfs_epoll_entry *entry;
+
+		if (!ep->in_use) {
+			continue;
+		}
+
+		(void)k_mutex_lock(&ep->lock, K_FOREVER);
+		if (ep->in_use) {
+			entry = zvfs_epoll_find(ep, fd);
+			if (entry != NULL) {
+				zvfs_epoll_release(ep, entry);
+			}
+		}
+		k_mutex_unlock(&ep->lock);
+	}
+}
+
+/* Instances are set up once, so that zvfs_epoll_close_fd() may always lock them */
+static int zvfs_epoll_init(void)
+{
+	ARRAY_FOR_EACH_PTR(epolls, ep) {
+		k_mutex_init(&ep->lock);
+		k_poll_set_init(&ep->set);
+		sys_dlist_init(&ep->pending);
+		ARRAY_FOR_EACH_PTR(ep->entries, entry) {
+			entry->fd = -1;
+			sys_dnode_init(&entry->node);
+		}
+	}
+
+	return 0;
+}
+
+SYS_INIT(zvfs_epoll_init, PRE_KERNEL_1, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
+
+/*
+ * Public-facing API
+ */
+
+int zvfs_epoll_create(int flags)
+{
+	struct zvfs_epoll *ep;
+	size_t offset;
+	int fd;
+
+	if (flags != 0) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	if (sys_bitarray_alloc(&epolls_bitarray, 1, &offset) < 0) {
+		errno = ENOMEM;
+		return -1;
+	}
+
+	ep = &epolls[offset];
+
+	fd = zvfs_reserve_fd();
+	if (fd < 0) {
+		sys_bitarray_free(&epolls_bitarray, 1, offset);
+		return -1;
+	}
+
+	(void)k_mutex_lock(&ep->lock, K_FOREVER);
+	ep->in_use = true;
+	k_mutex_unlock(&ep->lock);
+
+	zvfs_finalize_fd(fd, ep, &zvfs_epoll_fd_vtable);
+
+	return fd;
+}
+
+int zvfs_epoll_ctl(int epfd, int op, int fd, struct zvfs_epoll_event *ev)
+{
+	struct zvfs_epoll_entry *entry;
+	struct zvfs_epoll *ep;
+	int ret = 0;
+
+	ep = zvfs_get_fd_obj(epfd, &zvfs_epoll_fd_vtable, EBADF);
+	if (ep == NULL) {
+		return -1;
+	}
+
+	if (fd < 0) {
+		errno = EBADF;
+		return -1;
+	}
+
+	if ((fd == epfd) || ((op != ZVFS_EPOLL_CTL_DEL) && (ev == NULL))) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	(void)k_mutex_lock(&ep->lock, K_FOREVER);
+
+	entry = zvfs_epoll_find(ep, fd);
+
+	switch (op) {
+	case ZVFS_EPOLL_CTL_ADD:
+		if (entry != NULL) {
+			ret = -EEXIST;
+			break;
+		}
+
+		entry = zvfs_epoll_find(ep, -1);
+		if (entry == NULL) {
+			ret = -ENOSPC;
+			break;
+		}
+
+		entry->fd = fd;
+		entry->event = *ev;
+		entry->reported = false;
+		ret = zvfs_epoll_arm(ep, entry);
+		if (ret < 0) {
+			zvfs_epoll_release(ep, entry);
+		}
+		break;
+	case ZVFS_EPOLL_CTL_MOD:
+		if (entry == NULL) {
+			ret = -ENOENT;
+			break;
+		}
+
+		entry->event = *ev;
+		entry->reported = false;
+		ret = zvfs_epoll_arm(ep, entry);
+		break;
+	case ZVFS_EPOLL_CTL_DEL:
+		if (entry == NULL) {
+			ret = -ENOENT;
+			break;
+		}
+
+		zvfs_epoll_release(ep, entry);
+		break;
+	default:
+		ret = -EINVAL;
+		break;
+	}
+
+	k_mutex_unlock(&ep->lock);
+
+	if (ret < 0) {
+		errno = -ret;
+		return -1;
+	}
+
+	return 0;
+}
+
+int zvfs_epoll_wait(int epfd, struct zvfs_epoll_event *events, int maxevents, int timeout_ms)
+{
+	struct k_poll_event *ready[CONFIG_ZVFS_EPOLL_FD_MAX * ZVFS_EPOLL_PEV_MAX];
+	struct zvfs_epoll *ep;
+	k_timepoint_t end;
+	int ret;
+
+	ep = zvfs_get_fd_obj(epfd, &zvfs_epoll_fd_vtable, EBADF);
+	if (ep == NULL) {
+		return -1;
+	}
+
+	if ((events == NULL) || (maxevents <= 0)) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	end = sys_timepoint_calc((timeout_ms < 0) ? K_FOREVER : K_MSEC(timeout_ms));
+
+	(void)k_mutex_lock(&ep->lock, K_FOREVER);
+
+	do {
+		k_timeout_t timeout = sys_dlist_is_empty(&ep->pending) ?
+					      sys_timepoint_timeout(end) : K_NO_WAIT;
+		int n;
+
+		/* Let epoll_ctl() in while blocked */
+		k_mutex_unlock(&ep->lock);
+		n = k_poll_set_wait(&ep->set, ready, ARRAY_SIZE(ready), timeout);
+		(void)k_mutex_lock(&ep->lock, K_FOREVER);
+
+		for (int i = 0; i < n; i++) {
+			struct zvfs_epoll_entry *entry = CONTAINER_OF(
+				ready[i] - ready[i]->tag, struct zvfs_epoll_entry, pev[0]);
+
+			/* A stale entry is harmless: the update finds nothing to report */
+			if ((entry->fd >= 0) && !sys_dnode_is_linked(&entry->node)) {
+				sys_dlist_append(&ep->pending, &entry->node);
+			}
+		}
+
+		ret = zvfs_epoll_report(ep, events, maxevents);
+	} while ((ret == 0) && !sys_timepoint_expired(end));
+
+	k_mutex_unlock(&ep->lock);
+
+	return ret;
+}
@@ -9,6 +9,7 @@
 #include <errno.h>
 #include <limits.h>
 #include <math.h>
+#include <zephyr/sys/math_extras.h>
 #include <zephyr/sys/printk.h>
 #include <zephyr/sys/util.h>
 #include <stdbool.h>
@@ -90,12 +91,56 @@ static int peek(struct json_lexer *lex)
 	return chr;
 }
 
+/* Word-at-a-time scanning, see "Determine if a word has a byte equal to n" in Bit Twiddling
+ * Hacks. Words holding a byte of interest are left to the byte by byte lexer.
+ */
+#define ONES_WORD (~0UL / 0xff)
+#define HIGH_BITS_WORD (ONES_WORD * 0x80)
+
+static inline unsigned long has_byte(unsigned long word, uint8_t chr)
+{
+	unsigned long x = word ^ (ONES_WORD * chr);
+
+	return (x - ONES_WORD) & ~x & HIGH_BITS_WORD;
+}
+
+/* Skip the characters of a string that need no attention: anything but '"', '\\' and '\0' */
+static char *skip_string_chars(char *pos, const char *end)
+{
+	while (end - pos >= (ptrdiff_t)sizeof(unsigned long)) {
+		unsigned long word = UNALIGNED_GET((unsigned long *)pos);
+
+		if (has_byte(word, '"') || has_byte(word, '\\') || has_byte(word, '\0')) {
+			break;
+		}
+
+		pos += sizeof(unsigned long);
+	}
+
+	return pos;
+}
+
+/* Skip runs of spaces, as found in indented documents */
+static char *skip_spaces(char *pos, const char *end)
+{
+	while (end - pos >= (ptrdiff_t)sizeof(unsigned long) &&
+	       UNALIGNED_GET((unsigned long *)pos) == ONES_WORD * ' ') {
+		pos += sizeof(unsigned long);
+	}
+
+	return pos;
+}
+
 static void *lexer_string(struct json_lexer *lex)
 {
 	ignore(lex);
 
 	while (true) {
-		int chr = next(lex);
+		int chr;
+
+		lex->pos = skip_string_chars(lex->pos, lex->end);
+
+		chr = next(lex);
 
 		if (chr == '\0') {
 			emit(lex, JSON_TOK_ERROR);
@@ -282,6 +327,7 @@ static void *lexer_json(struct json_lexer *lex)
 			__fallthrough;
 		default:
 			if (isspace(chr) != 0) {
+				lex->pos = skip_spaces(lex->pos, lex->end);
 				ignore(lex);
 				continue;
 			}
@@ -1081,12 +1127,42 @@ static int arr_data_parse(struct json_obj *obj, struct json_obj_token *val)
 	return -EINVAL;
 }
 
+/* Find the descriptor of a key, starting from the one following the previously decoded
+ * field: documents usually list their fields in the order of the descriptors, so that the
+ * first candidate is most often the right one.
+ */
+static int find_field(const struct json_obj_descr *descr, size_t descr_len,
+		      int64_t decoded_fields, size_t first,
+		      const struct json_obj_key_value *kv)
+{
+	size_t i = first;
+
+	for (size_t n = 0; n < descr_len; n++, i = (i + 1 < descr_len) ? i + 1 : 0) {
+		/* Field has been decoded already, skip */
+		if (decoded_fields & ((int64_t)1 << i)) {
+			continue;
+		}
+
+		/* Check if it's the i-th field */
+		if (kv->key_len != descr[i].field_name_len) {
+			continue;
+		}
+
+		if (memcmp(kv->key, descr[i].field_name, descr[i].field_name_len) == 0) {
+			return i;
+		}
+	}
+
+	return -ENOENT;
+}
+
 static int64_t obj_parse(struct json_obj *obj, const struct json_obj_descr *descr,
 			 size_t descr_len, void *val)
 {
 	struct json_obj_key_value kv;
 	int64_t decoded_fields = 0;
-	size_t i;
+	size_t next_field = 0;
+	int i;
 	int ret;
 
 	while (!obj_next(obj, &kv)) {
@@ -1094,42 +1170,27 @@ static int64_t obj_parse(struct json_obj *obj, const struct json_obj_descr *desc
 			return decoded_fields;
 		}
 
-		for (i = 0; i < descr_len; i++) {
-			void *decode_field = (char *)val + descr[i].offset;
+		i = find_field(descr, descr_len, decoded_fields, next_field, &kv);
 
-			/* Field has been decoded already, skip */
-			if (decoded_fields & ((int64_t)1 << i)) {
-				continue;
-			}
-
-			/* Check if it's the i-th field */
-			if (kv.key_len != descr[i].field_name_len) {
-				continue;
-			}
-
-			if (memcmp(kv.key, descr[i].field_name,
-				   descr[i].field_name_len)) {
-				continue;
-			}
-
-			/* Store the decoded value */
-			ret = decode_value(obj, &descr[i], &kv.value,
-					   decode_field, val);
+		/* Skip field, if no descriptor was found */
+		if (i < 0) {
+			ret = skip_field(obj, &kv);
 			if (ret < 0) {
 				return ret;
 			}
 
-			decoded_fields |= (int64_t)1<<i;
-			break;
+			continue;
 		}
 
-		/* Skip field, if no descriptor was found */
-		if (i >= descr_len) {
-			ret = skip_field(obj, &kv);
-			if (ret < 0) {
-				return ret;
-			}
+		/* Store the decoded value */
+		ret = decode_value(obj, &descr[i], &kv.value,
+				   (char *)val + descr[i].offset, val);
+		if (ret < 0) {
+			return ret;
 		}
+
+		decoded_fields |= (int64_t)1 << i;
+		next_field = ((size_t)i + 1 < descr_len) ? (size_t)i + 1 : 0;
 	}
 
 	return -EINVAL;
@@ -1170,6 +1231,220 @@ int json_arr_parse(char *payload, size_t len,
 }
 
 
+void json_obj_stream_init(struct json_obj_stream *stream, char *buf, size_t buf_size,
+			  const struct json_obj_descr *descr, size_t descr_len, void *val)
+{
+	__ASSERT_NO_MSG(descr_len < (sizeof(int64_t) * CHAR_BIT - 1));
+
+	*stream = (struct json_obj_stream) {
+		.buf = buf,
+		.buf_size = buf_size,
+		.descr = descr,
+		.descr_len = descr_len,
+		.val = val,
+	};
+}
+
+/* Whether values decoded with descr may point into the parsed data */
+static bool descr_refs_payload(const struct json_obj_descr *descr)
+{
+	switch (descr->type) {
+	case JSON_TOK_OBJECT_START:
+		for (size_t i = 0; i < descr->object.sub_descr_len; i++) {
+			if (descr_refs_payload(&descr->object.sub_descr[i])) {
+				return true;
+			}
+		}
+		return false;
+	case JSON_TOK_ARRAY_START:
+		return descr_refs_payload(descr->array.element_descr);
+	case JSON_TOK_FALSE:
+	case JSON_TOK_TRUE:
+	case JSON_TOK_NUMBER:
+	case JSON_TOK_INT:
+	case JSON_TOK_UINT:
+	case JSON_TOK_INT64:
+	case JSON_TOK_UINT64:
+	case JSON_TOK_FLOAT_FP:
+	case JSON_TOK_DOUBLE_FP:
+	case JSON_TOK_STRING_BUF:
+		return false;
+	default:
+		return true;
+	}
+}
+
+/* Scan the bytes of a member from pos to end, tracking strings and nesting, and return the
+ * comma or brace ending the member, or NULL if it has not been reached.
+ */
+static char *stream_scan(struct json_obj_stream *stream, char *pos, char *end)
+{
+	while (pos < end) {
+		if (stream->in_string) {
+			if (!stream->escape) {
+				pos = skip_string_chars(pos, end);
+				if (pos == end) {
+					break;
+				}
+			}
+
+			if (stream->escape) {
+				stream->escape = false;
+			} else if (*pos == '\\') {
+				stream->escape = true;
+			} else if (*pos == '"') {
+				stream->in_string = false;
+			}
+
+			pos++;
+			continue;
+		}
+
+		switch (*pos) {
+		case '"':
+			stream->in_string = true;
+			break;
+		case '{':
+		case '[':
+			stream->depth++;
+			break;
+		case '}':
+		case ']':
+			if (stream->depth == 1) {
+				return pos;
+			}
+			stream->depth--;
+			break;
+		case ',':
+			if (stream->depth == 1) {
+				return pos;
+			}
+			break;
+		default:
+			break;
+		}
+		pos++;
+	}
+
+	return NULL;
+}
+
+/* Decode the member received at the end of the buffer, as an object of its own, and keep it
+ * in the buffer only if the decoded value points into it.
+ */
+static int64_t stream_parse_member(struct json_obj_stream *stream)
+{
+	char *member = stream->buf + stream->kept;
+	size_t len = stream->len + 2;
+	int64_t ret;
+
+	member[0] = '{';
+	member[len - 1] = '}';
+
+	ret = json_obj_parse(member, len, stream->descr, stream->descr_len, stream->val);
+	if (ret < 0) {
+		return ret;
+	}
+
+	/* A member decodes at most one field, unknown fields decode none */
+	if ((ret != 0) &&
+	    descr_refs_payload(&stream->descr[u64_count_trailing_zeros((uint64_t)ret)])) {
+		stream->kept += len;
+	}
+
+	stream->decoded |= ret;
+	stream->len = 0;
+
+	return 0;
+}
+
+int64_t json_obj_stream_feed(struct json_obj_stream *stream, const void *data, size_t len)
+{
+	const char *chunk = data;
+	char *member;
+	char *pos;
+	char *member_end;
+	size_t copy_len;
+	int64_t ret;
+
+	if (stream->done) {
+		return -EALREADY;
+	}
+
+	while (len > 0) {
+		/* Skip the whitespace preceding the object and its members */
+		if (stream->len == 0) {
+			while (len > 0 && isspace((unsigned char)*chunk) != 0) {
+				chunk++;
+				len--;
+			}
+
+			if (len == 0) {
+				break;
+			}
+
+			if (stream->depth == 0) {
+				if (*chunk != '{') {
+					return -EINVAL;
+				}
+
+				stream->depth = 1;
+				chunk++;
+				len--;
+				continue;
+			}
+
+			if (*chunk == '}') {
+				stream->done = true;
+				return stream->decoded;
+			}
+		}
+
+		/* The member is preceded by an opening brace, see stream_parse_member() */
+		member = stream->buf + stream->kept + 1;
+		if (stream->buf_size <= stream->kept + 1 + stream->len) {
+			return -ENOMEM;
+		}
+
+		copy_len = MIN(len, stream->buf_size - stream->kept - 1 - stream->len);
+		pos = member + stream->len;
+		memcpy(pos, chunk, copy_len);
+
+		member_end = stream_scan(stream, pos, pos + copy_len);
+		if (member_end == NULL) {
+			stream->len += copy_len;
+			chunk += copy_len;
+			len -= copy_len;
+			continue;
+		}
+
+		chunk += member_end - pos + 1;
+		len -= member_end - pos + 1;
+		stream->len = member_end - member;
+
+		if (*member_end == ']') {
+			stream->done = true;
+			return -EINVAL;
+		}
+
+		if (*member_end == '}') {
+			stream->done = true;
+		}
+
+		ret = stream_parse_member(stream);
+		if (ret < 0) {
+			stream->done = true;
+			return ret;
+		}
+
+		if (stream->done) {
+			return stream->decoded;
+		}
+	}
+
+	return -EAGAIN;
+}
+
 int json_arr_separate_object_parse_init(struct json_obj *json, char *payload, size_t len)
 {
 	return arr_init(json, payload, len);
@@ -0,0 +1,210 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Scan resistant eviction algorithm for demand paging, a simplified
+ * CLOCK-Pro.
+ *
+ * Theory of Operation:
+ *
+ * - Every evictable page frame is either hot or cold. A single clock hand
+ *   sweeps over the page frames and clears their accessed flag as it goes.
+ *
+ * - A page that was just paged in is first seen as a cold page in its test
+ *   period, and is not considered for eviction on that first encounter.
+ *
+ * - A cold page found accessed while in its test period is promoted to hot.
+ *   A cold page found accessed outside of it enters a new test period.
+ *
+ * - A hot page found not accessed is demoted to cold.
+ *
+ * - A cold page found not accessed is the eviction victim. If it was still
+ *   in its test period, its virtual address is remembered in a small ring
+ *   of non-resident pages. When that page is paged in again while still
+ *   remembered, its reuse distance is short and it starts out hot.
+ *
+ * Pages touched once, such as during a large sequential scan, thus never
+ * get promoted and are evicted before the hot working set, which has to go
+ * unaccessed for a full sweep before being demoted and another one before
+ * being evicted.
+ */
+
+#include <zephyr/kernel.h>
+#include <mmu.h>
+#include <kernel_arch_interface.h>
+
+#include <zephyr/kernel/mm/demand_paging.h>
+
+/* Per page frame state, zero meaning not seen since it was (re)used */
+#define CLOCK_PRO_SEEN	BIT(0)
+#define CLOCK_PRO_HOT	BIT(1)
+#define CLOCK_PRO_TEST	BIT(2)
+
+static uint8_t clock_pro_state[K_MEM_NUM_PAGE_FRAMES];
+static uint32_t clock_pro_hand;
+
+/* Virtual addresses of recently evicted cold pages still in test period */
+static uintptr_t clock_pro_ghosts[CONFIG_EVICTION_CLOCK_PRO_GHOSTS];
+static uint32_t clock_pro_ghost_next;
+
+static bool clock_pro_ghost_take(uintptr_t va)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(clock_pro_ghosts); i++) {
+		if (clock_pro_ghosts[i] == va) {
+			clock_pro_ghosts[i] = 0;
+			return true;
+		}
+	}
+
+	return false;
+}
+
+static void clock_pro_ghost_add(uintptr_t va)
+{
+	clock_pro_ghosts[clock_pro_ghost_next] = va;
+	clock_pro_ghost_next = (clock_pro_ghost_next + 1) % ARRAY_SIZE(clock_pro_ghosts);
+}
+
+struct k_mem_page_frame *k_mem_paging_eviction_select(bool *dirty_ptr)
+{
+	struct k_mem_page_frame *pf, *fallback = NULL;
+	uint8_t *state;
+	uintptr_t flags;
+	bool fallback_dirty = false;
+	bool accessed;
+	void *va;
+
+	/* Two sweeps age every page to a victim, the third one is a guard */
+	for (uint32_t n = 0; n < 3 * ARRAY_SIZE(k_mem_page_frames); n++) {
+		pf = &k_mem_page_frames[clock_pro_hand];
+		state = &clock_pro_state[clock_pro_hand];
+		clock_pro_hand = (clock_pro_hand + 1) % ARRAY_SIZE(k_mem_page_frames);
+
+		if (!k_mem_page_frame_is_evictable(pf)) {
+			continue;
+		}
+
+		va = k_mem_page_frame_to_virt(pf);
+		flags = arch_page_info_get(va, NULL, true);
+		accessed = (flags & ARCH_DATA_PAGE_ACCESSED) != 0UL;
+
+		/* Implies a mismatch with page frame ontology and page
+		 * tables
+		 */
+		__ASSERT((flags & ARCH_DATA_PAGE_LOADED) != 0U,
+			 "non-present page, %s",
+			 ((flags & ARCH_DATA_PAGE_NOT_MAPPED) != 0U) ?
+			 "un-mapped" : "paged out");
+
+		if (fallback == NULL) {
+			fallback = pf;
+			fallback_dirty = (flags & ARCH_DATA_PAGE_DIRTY) != 0UL;
+		}
+
+		if ((*state & CLOCK_PRO_SEEN) == 0U) {
+			*state = CLOCK_PRO_SEEN |
+				 (clock_pro_ghost_take((uintptr_t)va) ?
+				  CLOCK_PRO_HOT : CLOCK_PRO_TEST);
+			continue;
+		}
+
+		if (accessed) {
+			if ((*state & CLOCK_PRO_TEST) != 0U) {
+				*state = CLOCK_PRO_SEEN | CLOCK_PRO_HOT;
+			} else if ((*state & CLOCK_PRO_HOT) == 0U) {
+				*state = CLOCK_PRO_SEEN | CLOCK_PRO_TEST;
+			}
+			continue;
+		}
+
+		if ((*state & CLOCK_PRO_HOT) != 0U) {
+			*state = CLOCK_PRO_SEEN;
+			continue;
+		}
+
+		if ((*state & CLOCK_PRO_TEST) != 0U) {
+			clock_pro_ghost_add((uintptr_t)va);
+		}
+
+		/* The state is reset once the page is out of the frame */
+		*dirty_ptr = (flags & ARCH_DATA_PAGE_DIRTY) != 0UL;
+
+		return pf;
+	}
+
+	/* Only possible if pages keep being accessed while we sweep */
+	__ASSERT(fallback != NULL, "no page to evict");
+
+	if (fallback != NULL) {
+		*dirty_ptr = fallback_dirty;
+	}
+
+	return fallback;
+}
+
+struct k_mem_page_frame *k_mem_paging_eviction_peek(bool *dirty_ptr)
+{
+	struct k_mem_page_frame *pf;
+	uint32_t hand = clock_pro_hand;
+	uint8_t state;
+	uintptr_t flags;
+
+	/* Selecting changes the state of every evictable page the hand passes,
+	 * but for an unaccessed cold page out of its test period: that one is
+	 * the victim. It can thus only be told when it is the next evictable
+	 * page frame.
+	 */
+	for (uint32_t n = 0; n < ARRAY_SIZE(k_mem_page_frames); n++) {
+		pf = &k_mem_page_frames[hand];
+		state = clock_pro_state[hand];
+		hand = (hand + 1) % ARRAY_SIZE(k_mem_page_frames);
+
+		if (!k_mem_page_frame_is_evictable(pf)) {
+			continue;
+		}
+
+		flags = arch_page_info_get(k_mem_page_frame_to_virt(pf), NULL, false);
+		if ((state != CLOCK_PRO_SEEN) || ((flags & ARCH_DATA_PAGE_ACCESSED) != 0UL)) {
+			return NULL;
+		}
+
+		*dirty_ptr = (flags & ARCH_DATA_PAGE_DIRTY) != 0UL;
+
+		return pf;
+	}
+
+	return NULL;
+}
+
+void k_mem_paging_eviction_reset(struct k_mem_page_frame *pf)
+{
+	clock_pro_state[pf - k_mem_page_frames] = 0U;
+}
+
+void k_mem_paging_eviction_init(void)
+{
+}
+
+#ifdef CONFIG_EVICTION_TRACKING
+/*
+ * Empty functions defined here so that architectures unconditionally
+ * implement eviction tracking can still use this algorithm.
+ */
+
+void k_mem_paging_eviction_add(struct k_mem_page_frame *pf)
+{
+	ARG_UNUSED(pf);
+}
+
+void k_mem_paging_eviction_remove(struct k_mem_page_frame *pf)
+{
+	ARG_UNUSED(pf);
+}
+
+void k_mem_paging_eviction_accessed(uintptr_t phys)
+{
+	ARG_UNUSED(phys);
+}
+
+#endif /* CONFIG_EVICTION_TRACKING */
@@ -175,6 +175,17 @@ struct k_mem_page_frame *k_mem_paging_eviction_select(bool *dirty_ptr)
 	return pf;
 }
 
+struct k_mem_page_frame *k_mem_paging_eviction_peek(bool *dirty_ptr)
+{
+	/* Selecting the head of the queue changes nothing */
+	return k_mem_paging_eviction_select(dirty_ptr);
+}
+
+void k_mem_paging_eviction_reset(struct k_mem_page_frame *pf)
+{
+	ARG_UNUSED(pf);
+}
+
 void k_mem_paging_eviction_init(void)
 {
 }
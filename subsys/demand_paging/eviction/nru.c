@@ -43,7 +43,11 @@ static void nru_periodic_update(struct k_timer *timer)
 	irq_unlock(key);
 }
 
-struct k_mem_page_frame *k_mem_paging_eviction_select(bool *dirty_ptr)
+/* Index of the last page frame selected, the next scan starts after it */
+static uint32_t last_pf_idx;
+
+/* Find the page frame to evict, changing no state */
+static struct k_mem_page_frame *nru_find(bool *dirty_ptr)
 {
 	unsigned int last_prec = 4U;
 	struct k_mem_page_frame *last_pf = NULL, *pf;
@@ -51,12 +55,11 @@ struct k_mem_page_frame *k_mem_paging_eviction_select(bool *dirty_ptr)
 	bool last_dirty = false;
 	bool dirty = false;
 	uintptr_t flags;
-	uint32_t pf_idx;
-	static uint32_t last_pf_idx;
+	uint32_t start_idx, pf_idx;
 
 	/* similar to K_MEM_PAGE_FRAME_FOREACH except we don't always start at 0 */
-	last_pf_idx = (last_pf_idx + 1) % ARRAY_SIZE(k_mem_page_frames);
-	pf_idx = last_pf_idx;
+	start_idx = (last_pf_idx + 1) % ARRAY_SIZE(k_mem_page_frames);
+	pf_idx = start_idx;
 	do {
 		pf = &k_mem_page_frames[pf_idx];
 		pf_idx = (pf_idx + 1) % ARRAY_SIZE(k_mem_page_frames);
@@ -92,17 +95,37 @@ struct k_mem_page_frame *k_mem_paging_eviction_select(bool *dirty_ptr)
 			last_pf = pf;
 			last_dirty = dirty;
 		}
-	} while (pf_idx != last_pf_idx);
+	} while (pf_idx != start_idx);
 
 	/* Shouldn't ever happen unless every page is pinned */
 	__ASSERT(last_pf != NULL, "no page to evict");
 
-	last_pf_idx = last_pf - k_mem_page_frames;
 	*dirty_ptr = last_dirty;
 
 	return last_pf;
 }
 
+struct k_mem_page_frame *k_mem_paging_eviction_select(bool *dirty_ptr)
+{
+	struct k_mem_page_frame *pf = nru_find(dirty_ptr);
+
+	if (pf != NULL) {
+		last_pf_idx = pf - k_mem_page_frames;
+	}
+
+	return pf;
+}
+
+struct k_mem_page_frame *k_mem_paging_eviction_peek(bool *dirty_ptr)
+{
+	return nru_find(dirty_ptr);
+}
+
+void k_mem_paging_eviction_reset(struct k_mem_page_frame *pf)
+{
+	ARG_UNUSED(pf);
+}
+
 static K_TIMER_DEFINE(nru_timer, nru_periodic_update, NULL);
 
 void k_mem_paging_eviction_init(void)
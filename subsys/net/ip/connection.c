@@ -17,6 +17,7 @@
 LOG_MODULE_REGISTER(net_conn, CONFIG_NET_CONN_LOG_LEVEL);
 
 #include <errno.h>
+#include <zephyr/sys/byteorder.h>
 #include <zephyr/sys/util.h>
 
 #include <zephyr/net/net_core.h>
@@ -56,11 +57,32 @@ LOG_MODULE_REGISTER(net_conn, CONFIG_NET_CONN_LOG_LEVEL);
 
 #define NET_CONN_RANK(_flags)		(_flags & 0x78)
 
+#if defined(CONFIG_NET_CONN_HASH_BUCKETS) && (CONFIG_NET_CONN_HASH_BUCKETS > 0)
+#define CONN_HASH_BUCKETS CONFIG_NET_CONN_HASH_BUCKETS
+BUILD_ASSERT(IS_POWER_OF_TWO(CONN_HASH_BUCKETS),
+	     "CONFIG_NET_CONN_HASH_BUCKETS must be a power of two");
+#else
+#define CONN_HASH_BUCKETS 0
+#endif
+
 static struct net_conn conns[CONFIG_NET_MAX_CONN];
 
 static sys_slist_t conn_unused;
 static sys_slist_t conn_used;
 
+/* The lookup index. UDP/TCP connections with a local port are hashed by
+ * protocol and local port, and also by remote address and port when both
+ * are specified. All the other connections are on the wildcard list, which
+ * is compared to every packet.
+ */
+#if CONN_HASH_BUCKETS > 0
+static sys_slist_t conn_hash[CONN_HASH_BUCKETS];
+#endif
+static sys_slist_t conn_wildcard;
+
+/* Registration order of the connections */
+static uint32_t conn_seq;
+
 #if (CONFIG_NET_CONN_LOG_LEVEL >= LOG_LEVEL_DBG)
 static inline
 void conn_register_debug(struct net_conn *conn,
@@ -113,6 +135,90 @@ void conn_register_debug(struct net_conn *conn,
 
 static K_MUTEX_DEFINE(conn_lock);
 
+#if CONN_HASH_BUCKETS > 0
+/* Ports are in network byte order */
+static sys_slist_t *conn_hash_bucket(uint16_t proto, uint16_t local_port,
+				     uint16_t remote_port, const uint8_t *remote_addr,
+				     size_t addr_len)
+{
+	uint32_t hash = proto ^ ((uint32_t)local_port << 16 | remote_port);
+
+	for (size_t i = 0; i < addr_len; i += sizeof(uint32_t)) {
+		hash = (hash ^ sys_get_be32(&remote_addr[i])) * 0x9e3779b1U;
+	}
+
+	hash ^= hash >> 16;
+	hash *= 0x9e3779b1U;
+	hash ^= hash >> 16;
+
+	return &conn_hash[hash & (CONN_HASH_BUCKETS - 1)];
+}
+
+/* Remote address to hash, if it is specified */
+static const uint8_t *conn_hash_addr(const struct sockaddr *addr, size_t *len)
+{
+	if (IS_ENABLED(CONFIG_NET_IPV6) && addr->sa_family == AF_INET6 &&
+	    !net_ipv6_is_addr_unspecified(&net_sin6(addr)->sin6_addr)) {
+		*len = sizeof(struct in6_addr);
+		return (const uint8_t *)&net_sin6(addr)->sin6_addr;
+	}
+
+	if (IS_ENABLED(CONFIG_NET_IPV4) && addr->sa_family == AF_INET &&
+	    net_sin(addr)->sin_addr.s_addr != 0U) {
+		*len = sizeof(struct in_addr);
+		return (const uint8_t *)&net_sin(addr)->sin_addr;
+	}
+
+	return NULL;
+}
+#endif /* CONN_HASH_BUCKETS > 0 */
+
+/* Index list of a connection with these parameters, the ports being in
+ * network byte order. It only depends on the fields a packet must match
+ * exactly, so that the connection is found from the packet headers.
+ */
+static sys_slist_t *conn_index_list(uint16_t proto, uint8_t family,
+				    const struct sockaddr *remote_addr,
+				    uint16_t remote_port, uint16_t local_port)
+{
+#if CONN_HASH_BUCKETS > 0
+	const uint8_t *addr = NULL;
+	size_t len = 0;
+
+	if (local_port == 0U ||
+	    (family != AF_INET && family != AF_INET6 && family != AF_UNSPEC)) {
+		return &conn_wildcard;
+	}
+
+	if (remote_addr != NULL && remote_port != 0U) {
+		addr = conn_hash_addr(remote_addr, &len);
+	}
+
+	if (addr == NULL) {
+		return conn_hash_bucket(proto, local_port, 0U, NULL, 0);
+	}
+
+	return conn_hash_bucket(proto, local_port, remote_port, addr, len);
+#else
+	ARG_UNUSED(proto);
+	ARG_UNUSED(family);
+	ARG_UNUSED(remote_addr);
+	ARG_UNUSED(remote_port);
+	ARG_UNUSED(local_port);
+
+	return &conn_wildcard;
+#endif
+}
+
+static sys_slist_t *conn_index(struct net_conn *conn)
+{
+	return conn_index_list(conn->proto, conn->family,
+			       (conn->flags & NET_CONN_REMOTE_ADDR_SET) ?
+					&conn->remote_addr : NULL,
+			       net_sin(&conn->remote_addr)->sin_port,
+			       net_sin(&conn->local_addr)->sin_port);
+}
+
 static struct net_conn *conn_get_unused(void)
 {
 	sys_snode_t *node;
@@ -137,7 +243,9 @@ static void conn_set_used(struct net_conn *conn)
 	conn->flags |= NET_CONN_IN_USE;
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
+	conn->seq = conn_seq++;
 	sys_slist_prepend(&conn_used, &conn->node);
+	sys_slist_prepend(conn_index(conn), &conn->index_node);
 	k_mutex_unlock(&conn_lock);
 }
 
@@ -160,11 +268,15 @@ static struct net_conn *conn_find_handler(struct net_if *iface,
 					  bool reuseport_set)
 {
 	struct net_conn *conn;
-	struct net_conn *tmp;
+	sys_slist_t *list;
+
+	/* An identical handler is in the index list this one would go to */
+	list = conn_index_list(proto, family, remote_addr, htons(remote_port),
+			       htons(local_port));
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
 
-	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&conn_used, conn, tmp, node) {
+	SYS_SLIST_FOR_EACH_CONTAINER(list, conn, index_node) {
 		if (conn->proto != proto) {
 			continue;
 		}
@@ -463,6 +575,7 @@ int net_conn_unregister(struct net_conn_handle *handle)
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
 	sys_slist_find_and_remove(&conn_used, &conn->node);
+	sys_slist_find_and_remove(conn_index(conn), &conn->index_node);
 	k_mutex_unlock(&conn_lock);
 
 	conn_set_unused(conn);
@@ -489,14 +602,21 @@ int net_conn_update(struct net_conn_handle *handle,
 		return -ENOENT;
 	}
 
+	k_mutex_lock(&conn_lock, K_FOREVER);
+
+	/* The new addresses and ports may move it to another index list */
+	sys_slist_find_and_remove(conn_index(conn), &conn->index_node);
+
 	net_conn_change_callback(conn, cb, user_data);
 
 	ret = net_conn_change_local(conn, local_addr, local_port);
-	if (ret < 0) {
-		return ret;
+	if (ret == 0) {
+		ret = net_conn_change_remote(conn, remote_addr, remote_port);
 	}
 
-	ret = net_conn_change_remote(conn, remote_addr, remote_port);
+	sys_slist_prepend(conn_index(conn), &conn->index_node);
+
+	k_mutex_unlock(&conn_lock);
 
 	return ret;
 }
@@ -871,6 +991,145 @@ enum net_verdict net_conn_can_input(struct net_pkt *pkt, uint8_t proto)
 }
 #endif /* defined(CONFIG_NET_SOCKETS_CAN) */
 
+/* Is the candidate UDP/TCP connection matching the packet? Ports are in
+ * network byte order.
+ */
+static bool conn_is_matching(struct net_conn *conn, struct net_pkt *pkt,
+			     union net_ip_header *ip_hdr, uint8_t proto,
+			     uint16_t src_port, uint16_t dst_port)
+{
+	uint8_t pkt_family = net_pkt_family(pkt);
+
+	/* Is the candidate connection matching the packet's interface? */
+	if (!is_iface_matching(conn, pkt)) {
+		return false; /* wrong interface */
+	}
+
+	/* Is the candidate connection matching the packet's protocol family? */
+	if (conn->family != AF_UNSPEC && conn->family != pkt_family) {
+		if (IS_ENABLED(CONFIG_NET_IPV4_MAPPING_TO_IPV6)) {
+			if (!(conn->family == AF_INET6 && pkt_family == AF_INET &&
+			      !conn->v6only && conn->type != SOCK_RAW)) {
+				return false;
+			}
+		} else {
+			return false; /* wrong protocol family */
+		}
+
+		/* We might have a match for v4-to-v6 mapping, check more */
+	}
+
+	/* Is the candidate connection matching the packet's protocol within the family? */
+	if (conn->proto != proto) {
+		return false; /* wrong protocol */
+	}
+
+	/* Apply protocol-specific matching criteria... */
+	uint8_t conn_family = conn->family;
+
+	if (!((IS_ENABLED(CONFIG_NET_UDP) || IS_ENABLED(CONFIG_NET_TCP)) &&
+	      (conn_family == AF_INET || conn_family == AF_INET6 ||
+	       conn_family == AF_UNSPEC))) {
+		return false;
+	}
+
+	/* Is the candidate connection matching the packet's TCP/UDP
+	 * address and port?
+	 */
+	if (net_sin(&conn->remote_addr)->sin_port &&
+	    net_sin(&conn->remote_addr)->sin_port != src_port) {
+		return false; /* wrong remote port */
+	}
+
+	if (net_sin(&conn->local_addr)->sin_port &&
+	    net_sin(&conn->local_addr)->sin_port != dst_port) {
+		return false; /* wrong local port */
+	}
+
+	if ((conn->flags & NET_CONN_REMOTE_ADDR_SET) &&
+	    !conn_addr_cmp(pkt, ip_hdr, &conn->remote_addr, true)) {
+		return false; /* wrong remote address */
+	}
+
+	if ((conn->flags & NET_CONN_LOCAL_ADDR_SET) &&
+	    !conn_addr_cmp(pkt, ip_hdr, &conn->local_addr, false)) {
+
+		/* Check if we could do a v4-mapping-to-v6 and the IPv6 socket
+		 * has no IPV6_V6ONLY option set and if the local IPV6 address
+		 * is unspecified, then we could accept a connection from IPv4
+		 * address by mapping it to IPv6 address.
+		 */
+		if (IS_ENABLED(CONFIG_NET_IPV4_MAPPING_TO_IPV6)) {
+			if (!(conn->family == AF_INET6 && pkt_family == AF_INET &&
+			      !conn->v6only &&
+			      net_ipv6_is_addr_unspecified(
+				      &net_sin6(&conn->local_addr)->sin6_addr))) {
+				return false; /* wrong local address */
+			}
+		} else {
+			return false; /* wrong local address */
+		}
+
+		/* We might have a match for v4-to-v6 mapping */
+	}
+
+	return true;
+}
+
+/* Find the connection a unicast UDP/TCP packet is for: the matching one
+ * with the highest rank, and the latest registered one among those. Only
+ * the index lists the matching connections can be in are searched.
+ */
+static struct net_conn *conn_find_best_match(struct net_pkt *pkt,
+					     union net_ip_header *ip_hdr,
+					     uint8_t proto, uint16_t src_port,
+					     uint16_t dst_port)
+{
+	struct net_conn *best_match = NULL;
+	struct net_conn *conn;
+	sys_slist_t *lists[3];
+	size_t count = 0;
+#if CONN_HASH_BUCKETS > 0
+	const uint8_t *src_addr;
+	size_t addr_len;
+#endif
+
+	lists[count++] = &conn_wildcard;
+
+#if CONN_HASH_BUCKETS > 0
+	if (IS_ENABLED(CONFIG_NET_IPV6) && net_pkt_family(pkt) == AF_INET6) {
+		src_addr = ip_hdr->ipv6->src;
+		addr_len = NET_IPV6_ADDR_SIZE;
+	} else {
+		src_addr = ip_hdr->ipv4->src;
+		addr_len = NET_IPV4_ADDR_SIZE;
+	}
+
+	lists[count++] = conn_hash_bucket(proto, dst_port, 0U, NULL, 0);
+	lists[count] = conn_hash_bucket(proto, dst_port, src_port, src_addr, addr_len);
+	if (lists[count] != lists[count - 1]) {
+		count++;
+	}
+#endif
+
+	for (size_t i = 0; i < count; i++) {
+		SYS_SLIST_FOR_EACH_CONTAINER(lists[i], conn, index_node) {
+			if (!conn_is_matching(conn, pkt, ip_hdr, proto, src_port, dst_port)) {
+				continue;
+			}
+
+			if (best_match == NULL ||
+			    NET_CONN_RANK(conn->flags) > NET_CONN_RANK(best_match->flags) ||
+			    (NET_CONN_RANK(conn->flags) == NET_CONN_RANK(best_match->flags) &&
+			     (int32_t)(conn->seq - best_match->seq) > 0)) {
+				best_match = conn;
+			}
+		}
+	}
+
+	return best_match;
+}
+
 enum net_verdict net_conn_input(struct net_pkt *pkt,
 				union net_ip_header *ip_hdr,
 				uint8_t proto,
@@ -912,7 +1171,6 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 		ntohs(src_port), ntohs(dst_port), net_pkt_family(pkt));
 
 	struct net_conn *best_match = NULL;
-	int16_t best_rank = -1;
 	bool is_mcast_pkt = false;
 	bool mcast_pkt_delivered = false;
 	bool is_bcast_pkt = false;
@@ -936,118 +1194,44 @@ enum net_verdict net_conn_input(struct net_pkt *pkt,
 
 	k_mutex_lock(&conn_lock, K_FOREVER);
 
-	SYS_SLIST_FOR_EACH_CONTAINER(&conn_used, conn, node) {
-		/* Is the candidate connection matching the packet's interface? */
-		if (!is_iface_matching(conn, pkt)) {
-			continue; /* wrong interface */
-		}
+	if (is_mcast_pkt) {
+		SYS_SLIST_FOR_EACH_CONTAINER(&conn_used, conn, node) {
+			struct net_pkt *mcast_pkt;
 
-		/* Is the candidate connection matching the packet's protocol family? */
-		if (conn->family != AF_UNSPEC && conn->family != pkt_family) {
-			if (IS_ENABLED(CONFIG_NET_IPV4_MAPPING_TO_IPV6)) {
-				if (!(conn->family == AF_INET6 && pkt_family == AF_INET &&
-				      !conn->v6only && conn->type != SOCK_RAW)) {
-					continue;
-				}
-			} else {
-				continue; /* wrong protocol family */
+			if (!conn_is_matching(conn, pkt, ip_hdr, proto, src_port, dst_port)) {
+				continue;
 			}
 
-			/* We might have a match for v4-to-v6 mapping, check more */
-		}
-
-		/* Is the candidate connection matching the packet's protocol within the family? */
-		if (conn->proto != proto) {
-			continue; /* wrong protocol */
-		}
-
-		/* Apply protocol-specific matching criteria... */
-		uint8_t conn_family = conn->family;
-
-		if ((IS_ENABLED(CONFIG_NET_UDP) || IS_ENABLED(CONFIG_NET_TCP)) &&
-		    (conn_family == AF_INET || conn_family == AF_INET6 ||
-		     conn_family == AF_UNSPEC)) {
-			/* Is the candidate connection matching the packet's TCP/UDP
-			 * address and port?
+			/* If we have a multicast packet, and we found
+			 * a match, then deliver the packet immediately
+			 * to the handler. As there might be several
+			 * sockets interested about these, we need to
+			 * clone the received pkt.
 			 */
-			if (net_sin(&conn->remote_addr)->sin_port &&
-			    net_sin(&conn->remote_addr)->sin_port != src_port) {
-				continue; /* wrong remote port */
-			}
 
-			if (net_sin(&conn->local_addr)->sin_port &&
-			    net_sin(&conn->local_addr)->sin_port != dst_port) {
-				continue; /* wrong local port */
-			}
+			NET_DBG("[%p] mcast match found cb %p ud %p", conn, conn->cb,
+				conn->user_data);
 
-			if ((conn->flags & NET_CONN_REMOTE_ADDR_SET) &&
-			    !conn_addr_cmp(pkt, ip_hdr, &conn->remote_addr, true)) {
-				continue; /* wrong remote address */
+			mcast_pkt = net_pkt_clone(
+				pkt, K_MSEC(CONFIG_NET_CONN_PACKET_CLONE_TIMEOUT));
+			if (!mcast_pkt) {
+				k_mutex_unlock(&conn_lock);
+				goto drop;
 			}
 
-			if ((conn->flags & NET_CONN_LOCAL_ADDR_SET) &&
-			    !conn_addr_cmp(pkt, ip_hdr, &conn->local_addr, false)) {
-
-				/* Check if we could do a v4-mapping-to-v6 and the IPv6 socket
-				 * has no IPV6_V6ONLY option set and if the local IPV6 address
-				 * is unspecified, then we could accept a connection from IPv4
-				 * address by mapping it to IPv6 address.
-				 */
-				if (IS_ENABLED(CONFIG_NET_IPV4_MAPPING_TO_IPV6)) {
-					if (!(conn->family == AF_INET6 && pkt_family == AF_INET &&
-					      !conn->v6only &&
-					      net_ipv6_is_addr_unspecified(
-						      &net_sin6(&conn->local_addr)->sin6_addr))) {
-						continue; /* wrong local address */
-					}
-				} else {
-					continue; /* wrong local address */
-				}
-
-				/* We might have a match for v4-to-v6 mapping,
-				 * continue with rank checking.
-				 */
+			if (conn->cb(conn, mcast_pkt, ip_hdr, proto_hdr, conn->user_data) ==
+			    NET_DROP) {
+				net_stats_update_per_proto_drop(pkt_iface, proto);
+				net_pkt_unref(mcast_pkt);
+			} else {
+				net_stats_update_per_proto_recv(pkt_iface, proto);
 			}
 
-			if (best_rank < NET_CONN_RANK(conn->flags)) {
-				struct net_pkt *mcast_pkt;
-
-				if (!is_mcast_pkt) {
-					best_rank = NET_CONN_RANK(conn->flags);
-					best_match = conn;
-
-					continue; /* found a match - but maybe not yet the best */
-				}
-
-				/* If we have a multicast packet, and we found
-				 * a match, then deliver the packet immediately
-				 * to the handler. As there might be several
-				 * sockets interested about these, we need to
-				 * clone the received pkt.
-				 */
-
-				NET_DBG("[%p] mcast match found cb %p ud %p", conn, conn->cb,
-					conn->user_data);
-
-				mcast_pkt = net_pkt_clone(
-					pkt, K_MSEC(CONFIG_NET_CONN_PACKET_CLONE_TIMEOUT));
-				if (!mcast_pkt) {
-					k_mutex_unlock(&conn_lock);
-					goto drop;
-				}
-
-				if (conn->cb(conn, mcast_pkt, ip_hdr, proto_hdr, conn->user_data) ==
-				    NET_DROP) {
-					net_stats_update_per_proto_drop(pkt_iface, proto);
-					net_pkt_unref(mcast_pkt);
-				} else {
-					net_stats_update_per_proto_recv(pkt_iface, proto);
-				}
-
-				mcast_pkt_delivered = true;
-			}
+			mcast_pkt_delivered = true;
 		}
-	} /* loop end */
+	} else {
+		best_match = conn_find_best_match(pkt, ip_hdr, proto, src_port, dst_port);
+	}
 
 	if (best_match != NULL) {
 		cb = best_match->cb;
@@ -1117,6 +1301,13 @@ void net_conn_init(void)
 
 	sys_slist_init(&conn_unused);
 	sys_slist_init(&conn_used);
+	sys_slist_init(&conn_wildcard);
+
+#if CONN_HASH_BUCKETS > 0
+	for (i = 0; i < CONN_HASH_BUCKETS; i++) {
+		sys_slist_init(&conn_hash[i]);
+	}
+#endif
 
 	for (i = 0; i < CONFIG_NET_MAX_CONN; i++) {
 		sys_slist_prepend(&conn_unused, &conns[i].node);
@@ -54,6 +54,9 @@ struct net_conn {
 	/** Internal slist node */
 	sys_snode_t node;
 
+	/** Internal slist node in the lookup index */
+	sys_snode_t index_node;
+
 	/** Remote socket address */
 	struct sockaddr remote_addr;
 
@@ -71,6 +74,9 @@ struct net_conn {
 	/** Possible user to pass to the callback */
 	void *user_data;
 
+	/** Registration order, the latest registered connection wins ties */
+	uint32_t seq;
+
 	/** Connection protocol */
 	uint16_t proto;
 
@@ -2303,7 +2303,8 @@ static int context_sendto(struct net_context *context,
 			  net_context_send_cb_t cb,
 			  k_timeout_t timeout,
 			  void *user_data,
-			  bool sendto)
+			  bool sendto,
+			  struct net_buf *frags)
 {
 	const struct msghdr *msghdr = NULL;
 	struct net_if *iface = NULL;
@@ -2575,7 +2576,9 @@ static int context_sendto(struct net_context *context,
 		goto skip_alloc;
 	}
 
-	pkt = context_alloc_pkt(context, family, len, PKT_WAIT_TIME);
+	/* Data passed as buffers only needs room for the headers */
+	pkt = context_alloc_pkt(context, family, frags != NULL ? 0 : len,
+				PKT_WAIT_TIME);
 	if (!pkt) {
 		NET_ERR("Failed to allocate net_pkt");
 		return -ENOBUFS;
@@ -2583,7 +2586,7 @@ static int context_sendto(struct net_context *context,
 
 	tmp_len = net_pkt_available_payload_buffer(
 				pkt, net_context_get_proto(context));
-	if (tmp_len < len) {
+	if (frags == NULL && tmp_len < len) {
 		if (net_context_get_type(context) == SOCK_DGRAM ||
 		    net_context_get_type(context) == SOCK_RAW) {
 			NET_ERR("Available payload buffer (%zu) is not enough for requested DGRAM (%zu)",
@@ -2645,12 +2648,19 @@ skip_alloc:
 		ret = net_try_send_data(pkt, timeout);
 	} else if (IS_ENABLED(CONFIG_NET_UDP) &&
 	    net_context_get_proto(context) == IPPROTO_UDP) {
-		ret = context_setup_udp_packet(context, family, pkt, buf, len, msghdr,
-					       dst_addr, addrlen);
+		ret = context_setup_udp_packet(context, family, pkt,
+					       frags != NULL ? NULL : buf,
+					       frags != NULL ? 0 : len,
+					       msghdr, dst_addr, addrlen);
 		if (ret < 0) {
 			goto fail;
 		}
 
+		if (frags != NULL) {
+			/* The caller keeps its own reference to the buffers */
+			net_pkt_append_buffer(pkt, net_buf_ref(frags));
+		}
+
 		context_finalize_packet(context, family, pkt);
 
 		ret = net_try_send_data(pkt, timeout);
@@ -2839,7 +2849,7 @@ int net_context_send(struct net_context *context,
 	}
 
 	ret = context_sendto(context, buf, len, &context->remote,
-			     addrlen, cb, timeout, user_data, false);
+			     addrlen, cb, timeout, user_data, false, NULL);
 unlock:
 	k_mutex_unlock(&context->lock);
 
@@ -2858,7 +2868,7 @@ int net_context_sendmsg(struct net_context *context,
 	k_mutex_lock(&context->lock, K_FOREVER);
 
 	ret = context_sendto(context, msghdr, 0, NULL, 0,
-			     cb, timeout, user_data, true);
+			     cb, timeout, user_data, true, NULL);
 
 	k_mutex_unlock(&context->lock);
 
@@ -2879,8 +2889,54 @@ int net_context_sendto(struct net_context *context,
 	k_mutex_lock(&context->lock, K_FOREVER);
 
 	ret = context_sendto(context, buf, len, dst_addr, addrlen,
-			     cb, timeout, user_data, true);
+			     cb, timeout, user_data, true, NULL);
+
+	k_mutex_unlock(&context->lock);
+
+	return ret;
+}
+
+int net_context_send_buf(struct net_context *context,
+			 struct net_buf *frags,
+			 const struct sockaddr *dst_addr,
+			 socklen_t addrlen,
+			 net_context_send_cb_t cb,
+			 k_timeout_t timeout,
+			 void *user_data)
+{
+	bool sendto = true;
+	int ret;
+
+	if (frags == NULL) {
+		return -EINVAL;
+	}
+
+	k_mutex_lock(&context->lock, K_FOREVER);
 
+	if (!IS_ENABLED(CONFIG_NET_UDP) ||
+	    net_context_get_type(context) != SOCK_DGRAM ||
+	    net_context_get_proto(context) != IPPROTO_UDP ||
+	    net_if_is_ip_offloaded(net_context_get_iface(context))) {
+		ret = -EOPNOTSUPP;
+		goto unlock;
+	}
+
+	if (dst_addr == NULL) {
+		if (!(context->flags & NET_CONTEXT_REMOTE_ADDR_SET) ||
+		    net_sin(&context->remote)->sin_port == 0) {
+			ret = -EDESTADDRREQ;
+			goto unlock;
+		}
+
+		dst_addr = &context->remote;
+		addrlen = net_context_get_family(context) == AF_INET6 ?
+			  sizeof(struct sockaddr_in6) : sizeof(struct sockaddr_in);
+		sendto = false;
+	}
+
+	ret = context_sendto(context, NULL, net_buf_frags_len(frags), dst_addr,
+			     addrlen, cb, timeout, user_data, sendto, frags);
+unlock:
 	k_mutex_unlock(&context->lock);
 
 	return ret;
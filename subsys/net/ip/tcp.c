@@ -443,64 +443,167 @@ static void tcp_derive_rto(struct tcp *conn)
 
 #ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
 
-/* Implementation according to RFC6582 */
-
-static void tcp_new_reno_log(struct tcp *conn, char *step)
+static void tcp_ca_log(struct tcp *conn, char *step)
 {
-	NET_DBG("conn: %p, ca %s, cwnd=%d, ssthres=%d, fast_pend=%i",
-		conn, step, conn->ca.cwnd, conn->ca.ssthresh,
+	NET_DBG("conn: %p, ca %s %s, cwnd=%d, ssthres=%d, fast_pend=%i",
+		conn, conn->ca.ops->name, step, conn->ca.cwnd, conn->ca.ssthresh,
 		conn->ca.pending_fast_retransmit_bytes);
 }
 
+/* Implementation according to RFC6582 */
+
 static void tcp_new_reno_init(struct tcp *conn)
 {
-	conn->ca.cwnd = conn_mss(conn) * TCP_CONGESTION_INITIAL_WIN;
 	conn->ca.ssthresh = conn_mss(conn) * TCP_CONGESTION_INITIAL_SSTHRESH;
+}
+
+static void tcp_new_reno_on_ack(struct tcp *conn, uint32_t acked_len)
+{
+	int32_t new_win = conn->ca.cwnd;
+	int32_t win_inc = MIN(acked_len, conn_mss(conn));
+
+	/* Implement a div_ceil	to avoid rounding to 0 */
+	new_win += ((win_inc * win_inc) + conn->ca.cwnd - 1) / conn->ca.cwnd;
+	conn->ca.cwnd = MIN(new_win, UINT16_MAX);
+}
+
+static void tcp_new_reno_on_loss(struct tcp *conn)
+{
+	conn->ca.ssthresh = MAX(conn_mss(conn) * 2, conn->unacked_len / 2);
+}
+
+static const struct tcp_ca_ops tcp_new_reno_ops = {
+	.name = "reno",
+	.init = tcp_new_reno_init,
+	.on_ack = tcp_new_reno_on_ack,
+	.on_loss = tcp_new_reno_on_loss,
+	.on_rto = tcp_new_reno_on_loss,
+};
+
+static const struct tcp_ca_ops *const tcp_ca_algorithms[] = {
+	&tcp_new_reno_ops,
+#ifdef CONFIG_NET_TCP_CUBIC
+	&tcp_cubic_ops,
+#endif
+};
+
+#ifdef CONFIG_NET_TCP_CONGESTION_DEFAULT_CUBIC
+#define TCP_CA_DEFAULT (&tcp_cubic_ops)
+#else
+#define TCP_CA_DEFAULT (&tcp_new_reno_ops)
+#endif
+
+/* Karn's algorithm: a retransmitted segment does not give an RTT sample */
+static void tcp_rtt_cancel(struct tcp *conn)
+{
+	conn->rtt.timing = false;
+}
+
+/* New data is sent, time it if no segment is being timed already */
+static void tcp_rtt_start(struct tcp *conn, uint32_t seq)
+{
+	if (conn->rtt.timing) {
+		return;
+	}
+
+	conn->rtt.timing = true;
+	conn->rtt.seq = seq;
+	conn->rtt.start = (uint32_t)k_uptime_ticks();
+}
+
+static void tcp_rtt_sample(struct tcp *conn, uint32_t ack)
+{
+	uint32_t rtt;
+
+	if (!conn->rtt.timing || net_tcp_seq_cmp(ack, conn->rtt.seq) < 0) {
+		return;
+	}
+
+	conn->rtt.timing = false;
+	rtt = k_ticks_to_us_floor32((uint32_t)k_uptime_ticks() - conn->rtt.start);
+
+	if (conn->rtt.srtt == 0) {
+		conn->rtt.srtt = MAX(rtt, 1);
+		conn->rtt.rttvar = rtt / 2;
+	} else {
+		uint32_t delta = (rtt > conn->rtt.srtt) ? rtt - conn->rtt.srtt
+							  : conn->rtt.srtt - rtt;
+
+		/* rttvar = 3/4 rttvar + 1/4 |delta|, srtt = 7/8 srtt + 1/8 rtt */
+		conn->rtt.rttvar = conn->rtt.rttvar - conn->rtt.rttvar / 4 + delta / 4;
+		conn->rtt.srtt = MAX(conn->rtt.srtt - conn->rtt.srtt / 8 + rtt / 8, 1);
+	}
+
+	NET_DBG("conn: %p rtt=%u us, srtt=%u us, rttvar=%u us", conn, rtt,
+		conn->rtt.srtt, conn->rtt.rttvar);
+}
+
+static void tcp_ca_conn_init(struct tcp *conn)
+{
+	/* Initially set the congestion window at its max size, since only the MSS
+	 * is available as soon as the connection is established
+	 */
+	conn->ca.cwnd = UINT16_MAX;
+	conn->ca.ops = TCP_CA_DEFAULT;
+	memset(&conn->rtt, 0, sizeof(conn->rtt));
+}
+
+static void tcp_ca_param_copy(struct tcp *to, struct tcp *from)
+{
+	to->ca.ops = from->ca.ops;
+}
+
+static void tcp_ca_init(struct tcp *conn)
+{
+	conn->ca.cwnd = conn_mss(conn) * TCP_CONGESTION_INITIAL_WIN;
 	conn->ca.pending_fast_retransmit_bytes = 0;
-	tcp_new_reno_log(conn, "init");
+	conn->ca.ops->init(conn);
+	tcp_ca_log(conn, "init");
 }
 
-static void tcp_new_reno_fast_retransmit(struct tcp *conn)
+static void tcp_ca_fast_retransmit(struct tcp *conn)
 {
+	tcp_rtt_cancel(conn);
+
 	if (conn->ca.pending_fast_retransmit_bytes == 0) {
-		conn->ca.ssthresh = MAX(conn_mss(conn) * 2, conn->unacked_len / 2);
+		conn->ca.ops->on_loss(conn);
 		/* Account for the lost segments */
-		conn->ca.cwnd = conn_mss(conn) * 3 + conn->ca.ssthresh;
+		conn->ca.cwnd = MIN(conn_mss(conn) * 3 + conn->ca.ssthresh, UINT16_MAX);
 		conn->ca.pending_fast_retransmit_bytes = conn->unacked_len;
-		tcp_new_reno_log(conn, "fast_retransmit");
+		tcp_ca_log(conn, "fast_retransmit");
 	}
 }
 
-static void tcp_new_reno_timeout(struct tcp *conn)
+static void tcp_ca_timeout(struct tcp *conn)
 {
-	conn->ca.ssthresh = MAX(conn_mss(conn) * 2, conn->unacked_len / 2);
+	tcp_rtt_cancel(conn);
+
+	conn->ca.ops->on_rto(conn);
 	conn->ca.cwnd = conn_mss(conn);
-	tcp_new_reno_log(conn, "timeout");
+	tcp_ca_log(conn, "timeout");
 }
 
 /* For every duplicate ack increment the cwnd by mss */
-static void tcp_new_reno_dup_ack(struct tcp *conn)
+static void tcp_ca_dup_ack(struct tcp *conn)
 {
 	int32_t new_win = conn->ca.cwnd;
 
 	new_win += conn_mss(conn);
 	conn->ca.cwnd = MIN(new_win, UINT16_MAX);
-	tcp_new_reno_log(conn, "dup_ack");
+	tcp_ca_log(conn, "dup_ack");
 }
 
-static void tcp_new_reno_pkts_acked(struct tcp *conn, uint32_t acked_len)
+static void tcp_ca_pkts_acked(struct tcp *conn, uint32_t acked_len)
 {
 	int32_t new_win = conn->ca.cwnd;
-	int32_t win_inc = MIN(acked_len, conn_mss(conn));
 
 	if (conn->ca.pending_fast_retransmit_bytes == 0) {
 		if (conn->ca.cwnd < conn->ca.ssthresh) {
-			new_win += win_inc;
+			new_win += MIN(acked_len, conn_mss(conn));
+			conn->ca.cwnd = MIN(new_win, UINT16_MAX);
 		} else {
-			/* Implement a div_ceil	to avoid rounding to 0 */
-			new_win += ((win_inc * win_inc) + conn->ca.cwnd - 1) / conn->ca.cwnd;
+			conn->ca.ops->on_ack(conn, acked_len);
 		}
-		conn->ca.cwnd = MIN(new_win, UINT16_MAX);
 	} else {
 		/* Check if it is still in fast recovery mode */
 		if (conn->ca.pending_fast_retransmit_bytes <= acked_len) {
@@ -511,35 +614,72 @@ static void tcp_new_reno_pkts_acked(struct tcp *conn, uint32_t acked_len)
 			conn->ca.cwnd -= acked_len;
 		}
 	}
-	tcp_new_reno_log(conn, "pkts_acked");
+	tcp_ca_log(conn, "pkts_acked");
 }
 
-static void tcp_ca_init(struct tcp *conn)
+static int set_tcp_congestion(struct tcp *conn, const void *value, size_t len)
 {
-	tcp_new_reno_init(conn);
-}
+	const struct tcp_ca_ops *ops = NULL;
 
-static void tcp_ca_fast_retransmit(struct tcp *conn)
-{
-	tcp_new_reno_fast_retransmit(conn);
-}
+	if (value == NULL) {
+		return -EINVAL;
+	}
 
-static void tcp_ca_timeout(struct tcp *conn)
-{
-	tcp_new_reno_timeout(conn);
-}
+	len = strnlen(value, len);
 
-static void tcp_ca_dup_ack(struct tcp *conn)
-{
-	tcp_new_reno_dup_ack(conn);
+	for (size_t i = 0; i < ARRAY_SIZE(tcp_ca_algorithms); i++) {
+		if (strlen(tcp_ca_algorithms[i]->name) == len &&
+		    strncmp(tcp_ca_algorithms[i]->name, value, len) == 0) {
+			ops = tcp_ca_algorithms[i];
+			break;
+		}
+	}
+
+	if (ops == NULL) {
+		return -ENOENT;
+	}
+
+	if (ops != conn->ca.ops) {
+		conn->ca.ops = ops;
+
+		/* Switching on a live connection keeps the current window and
+		 * slow start threshold, only the algorithm state is reset.
+		 */
+		if (conn->state == TCP_ESTABLISHED || conn->state == TCP_CLOSE_WAIT) {
+			uint16_t ssthresh = conn->ca.ssthresh;
+
+			ops->init(conn);
+			conn->ca.ssthresh = ssthresh;
+			tcp_ca_log(conn, "switch");
+		}
+	}
+
+	return 0;
 }
 
-static void tcp_ca_pkts_acked(struct tcp *conn, uint32_t acked_len)
+static int get_tcp_congestion(struct tcp *conn, void *value, size_t *len)
 {
-	tcp_new_reno_pkts_acked(conn, acked_len);
+	const char *name = conn->ca.ops->name;
+
+	if (value == NULL || len == NULL || *len == 0) {
+		return -EINVAL;
+	}
+
+	*len = MIN(*len, strlen(name) + 1);
+	memcpy(value, name, *len);
+
+	return 0;
 }
 #else
 
+static void tcp_rtt_start(struct tcp *conn, uint32_t seq) { }
+
+static void tcp_rtt_sample(struct tcp *conn, uint32_t ack) { }
+
+static void tcp_ca_conn_init(struct tcp *conn) { }
+
+static void tcp_ca_param_copy(struct tcp *to, struct tcp *from) { }
+
 static void tcp_ca_init(struct tcp *conn) { }
 
 static void tcp_ca_fast_retransmit(struct tcp *conn) { }
@@ -550,6 +690,9 @@ static void tcp_ca_dup_ack(struct tcp *conn) { }
 
 static void tcp_ca_pkts_acked(struct tcp *conn, uint32_t acked_len) { }
 
+#define set_tcp_congestion(...) (-ENOPROTOOPT)
+#define get_tcp_congestion(...) (-ENOPROTOOPT)
+
 #endif
 
 #if defined(CONFIG_NET_TCP_KEEPALIVE)
@@ -1009,8 +1152,13 @@ static bool tcp_options_check(struct tcp_options *recv_options,
 
 	NET_DBG("len=%zd", len);
 
-	recv_options->mss_found = false;
-	recv_options->wnd_found = false;
+	/* MSS and window scale are only sent on SYN segments, so they are not
+	 * reset here: later segments may carry other options.
+	 */
+#ifdef CONFIG_NET_TCP_SACK
+	recv_options->sack_perm_found = false;
+	recv_options->sack_count = 0;
+#endif
 
 	for ( ; options && len >= 1; options += opt_len, len -= opt_len) {
 		opt = options[0];
@@ -1059,6 +1207,32 @@ static bool tcp_options_check(struct tcp_options *recv_options,
 			recv_options->window = opt;
 			recv_options->wnd_found = true;
 			break;
+#ifdef CONFIG_NET_TCP_SACK
+		case NET_TCP_SACK_PERM_OPT:
+			if (opt_len != NET_TCP_SACK_PERM_SIZE) {
+				result = false;
+				goto end;
+			}
+
+			recv_options->sack_perm_found = true;
+			break;
+		case NET_TCP_SACK_OPT:
+			if (opt_len < NET_TCP_SACK_SIZE(1) ||
+			    ((opt_len - NET_TCP_SACK_SIZE(0)) % 8) != 0) {
+				result = false;
+				goto end;
+			}
+
+			for (int i = NET_TCP_SACK_SIZE(0); i < opt_len &&
+			     recv_options->sack_count < NET_TCP_SACK_MAX_BLOCKS; i += 8) {
+				struct tcp_sack_block *block =
+					&recv_options->sack[recv_options->sack_count++];
+
+				block->start = ntohl(UNALIGNED_GET((uint32_t *)(options + i)));
+				block->end = ntohl(UNALIGNED_GET((uint32_t *)(options + i + 4)));
+			}
+			break;
+#endif
 		default:
 			continue;
 		}
@@ -1250,7 +1424,7 @@ static int tcp_finalize_pkt(struct net_pkt *pkt)
 }
 
 static int tcp_header_add(struct tcp *conn, struct net_pkt *pkt, uint8_t flags,
-			  uint32_t seq)
+			  uint32_t seq, size_t opts_len)
 {
 	NET_PKT_DATA_ACCESS_DEFINE(tcp_access, struct tcphdr);
 	struct tcphdr *th;
@@ -1264,11 +1438,7 @@ static int tcp_header_add(struct tcp *conn, struct net_pkt *pkt, uint8_t flags,
 
 	UNALIGNED_PUT(conn->src.sin.sin_port, UNALIGNED_MEMBER_ADDR(th, th_sport));
 	UNALIGNED_PUT(conn->dst.sin.sin_port, UNALIGNED_MEMBER_ADDR(th, th_dport));
-	th->th_off = 5;
-
-	if (conn->send_options.mss_found) {
-		th->th_off++;
-	}
+	th->th_off = 5 + opts_len / 4;
 
 	UNALIGNED_PUT(flags, &th->th_flags);
 	UNALIGNED_PUT(htons(conn->recv_win), UNALIGNED_MEMBER_ADDR(th, th_win));
@@ -1454,18 +1624,102 @@ err:
 	tcp_pkt_unref(rst);
 }
 
+#ifdef CONFIG_NET_TCP_SACK
+/* Build the SACK options of an outgoing segment: SACK-permitted on our SYN,
+ * or on our SYN-ACK if the peer offered it, and the SACK blocks describing
+ * the out-of-order queue on segments without data. Data segments are
+ * already MSS sized, so they do not have room for the blocks.
+ */
+static size_t tcp_sack_options_get(struct tcp *conn, uint8_t flags,
+				   struct net_pkt *data, uint8_t *opts)
+{
+	struct tcp_sack_block blocks[NET_TCP_SACK_MAX_BLOCKS];
+	struct net_buf *buf;
+	int count = 0;
+
+	opts[0] = NET_TCP_NOP_OPT;
+	opts[1] = NET_TCP_NOP_OPT;
+
+	if (flags & SYN) {
+		if (!conn->send_options.mss_found ||
+		    ((flags & ACK) && !conn->sack_perm)) {
+			return 0;
+		}
+
+		opts[2] = NET_TCP_SACK_PERM_OPT;
+		opts[3] = NET_TCP_SACK_PERM_SIZE;
+
+		return 2 + NET_TCP_SACK_PERM_SIZE;
+	}
+
+	if (!(flags & ACK) || data != NULL || !conn->sack_perm ||
+	    conn->queue_recv_data == NULL) {
+		return 0;
+	}
+
+	/* Every fragment of the queue holds its starting sequence number,
+	 * report each contiguous run of them as one block.
+	 */
+	for (buf = conn->queue_recv_data->buffer; buf != NULL; buf = buf->frags) {
+		uint32_t seq = tcp_get_seq(buf);
+
+		if (net_tcp_seq_cmp(seq + buf->len, conn->ack) <= 0) {
+			continue;
+		}
+
+		if (count > 0 && blocks[count - 1].end == seq) {
+			blocks[count - 1].end += buf->len;
+			continue;
+		}
+
+		if (count == NET_TCP_SACK_MAX_BLOCKS) {
+			break;
+		}
+
+		blocks[count].start = seq;
+		blocks[count].end = seq + buf->len;
+		count++;
+	}
+
+	if (count == 0) {
+		return 0;
+	}
+
+	opts[2] = NET_TCP_SACK_OPT;
+	opts[3] = NET_TCP_SACK_SIZE(count);
+
+	for (int i = 0; i < count; i++) {
+		UNALIGNED_PUT(htonl(blocks[i].start), (uint32_t *)(opts + 4 + i * 8));
+		UNALIGNED_PUT(htonl(blocks[i].end), (uint32_t *)(opts + 8 + i * 8));
+	}
+
+	return 2 + NET_TCP_SACK_SIZE(count);
+}
+#else
+static size_t tcp_sack_options_get(struct tcp *conn, uint8_t flags,
+				   struct net_pkt *data, uint8_t *opts)
+{
+	return 0;
+}
+#endif
+
 static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 		       uint32_t seq)
 {
-	size_t alloc_len = sizeof(struct tcphdr);
+	uint8_t sack_opts[2 + NET_TCP_SACK_SIZE(NET_TCP_SACK_MAX_BLOCKS)];
+	size_t sack_opts_len;
+	size_t opts_len;
 	struct net_pkt *pkt;
 	int ret = 0;
 
+	sack_opts_len = tcp_sack_options_get(conn, flags, data, sack_opts);
+	opts_len = sack_opts_len;
+
 	if (conn->send_options.mss_found) {
-		alloc_len += sizeof(uint32_t);
+		opts_len += NET_TCP_MSS_SIZE;
 	}
 
-	pkt = tcp_pkt_alloc(conn, alloc_len);
+	pkt = tcp_pkt_alloc(conn, sizeof(struct tcphdr) + opts_len);
 	if (!pkt) {
 		ret = -ENOBUFS;
 		goto out;
@@ -1483,7 +1737,7 @@ static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 		goto out;
 	}
 
-	ret = tcp_header_add(conn, pkt, flags, seq);
+	ret = tcp_header_add(conn, pkt, flags, seq, opts_len);
 	if (ret < 0) {
 		tcp_pkt_unref(pkt);
 		goto out;
@@ -1497,6 +1751,14 @@ static int tcp_out_ext(struct tcp *conn, uint8_t flags, struct net_pkt *data,
 		}
 	}
 
+	if (sack_opts_len > 0) {
+		ret = net_pkt_write(pkt, sack_opts, sack_opts_len);
+		if (ret < 0) {
+			tcp_pkt_unref(pkt);
+			goto out;
+		}
+	}
+
 	ret = tcp_finalize_pkt(pkt);
 	if (ret < 0) {
 		tcp_pkt_unref(pkt);
@@ -1714,11 +1976,39 @@ static void tcp_setup_retransmission(struct tcp *conn)
 	k_work_reschedule_for_queue(&tcp_work_q, &conn->send_data_timer, K_MSEC(TCP_RTO_MS));
 }
 
+/* Send len bytes of the send_data, starting offset bytes after SND.UNA */
+static int tcp_send_segment(struct tcp *conn, int offset, int len)
+{
+	struct net_pkt *pkt;
+	int ret;
+
+	pkt = tcp_pkt_alloc(conn, len);
+	if (!pkt) {
+		NET_ERR("conn: %p packet allocation failed, len=%d", conn, len);
+		return -ENOBUFS;
+	}
+
+	ret = tcp_pkt_peek(pkt, conn->send_data, offset, len);
+	if (ret < 0) {
+		tcp_pkt_unref(pkt);
+		return -ENOBUFS;
+	}
+
+	ret = tcp_out_ext(conn, PSH | ACK, pkt, conn->seq + offset);
+
+	/* The data we want to send, has been moved to the send queue so we
+	 * can unref the head net_pkt. If there was an error, we need to remove
+	 * the packet anyway.
+	 */
+	tcp_pkt_unref(pkt);
+
+	return ret;
+}
+
 static int tcp_send_data(struct tcp *conn)
 {
 	int ret = 0;
 	int len;
-	struct net_pkt *pkt;
 
 	len = MIN(tcp_unsent_len(conn), conn_mss(conn));
 	if (len < 0) {
@@ -1731,21 +2021,7 @@ static int tcp_send_data(struct tcp *conn)
 		goto out;
 	}
 
-	pkt = tcp_pkt_alloc(conn, len);
-	if (!pkt) {
-		NET_ERR("conn: %p packet allocation failed, len=%d", conn, len);
-		ret = -ENOBUFS;
-		goto out;
-	}
-
-	ret = tcp_pkt_peek(pkt, conn->send_data, conn->unacked_len, len);
-	if (ret < 0) {
-		tcp_pkt_unref(pkt);
-		ret = -ENOBUFS;
-		goto out;
-	}
-
-	ret = tcp_out_ext(conn, PSH | ACK, pkt, conn->seq + conn->unacked_len);
+	ret = tcp_send_segment(conn, conn->unacked_len, len);
 	if (ret == 0) {
 		conn->unacked_len += len;
 
@@ -1753,23 +2029,287 @@ static int tcp_send_data(struct tcp *conn)
 			net_stats_update_tcp_resent(conn->iface, len);
 			net_stats_update_tcp_seg_rexmit(conn->iface);
 		} else {
+			tcp_rtt_start(conn, conn->seq + conn->unacked_len);
 			net_stats_update_tcp_sent(conn->iface, len);
 			net_stats_update_tcp_seg_sent(conn->iface);
 		}
 	}
 
-	/* The data we want to send, has been moved to the send queue so we
-	 * can unref the head net_pkt. If there was an error, we need to remove
-	 * the packet anyway.
-	 */
-	tcp_pkt_unref(pkt);
-
 	conn_send_data_dump(conn);
 
  out:
 	return ret;
 }
 
+#ifdef CONFIG_NET_TCP_SACK
+
+/* SACK based loss recovery according to RFC 6675. The peer reports what it
+ * received above SND.UNA, and only the holes in between are retransmitted.
+ * The congestion window is still managed by the RFC 6582 fast recovery, so
+ * "pipe" is not computed: a hole is retransmitted on each duplicate and
+ * partial ACK.
+ */
+
+static bool tcp_sack_active(struct tcp *conn)
+{
+	return conn->sack_perm;
+}
+
+static void tcp_sack_negotiate(struct tcp *conn)
+{
+	conn->sack_perm = conn->recv_options.sack_perm_found;
+}
+
+static void tcp_sack_reset(struct tcp *conn)
+{
+	conn->sack.count = 0;
+	conn->sack.in_recovery = false;
+}
+
+/* Add a range to the scoreboard, merging it with the ranges it touches. When
+ * the scoreboard is full, the highest range is forgotten.
+ */
+static void tcp_sack_insert(struct tcp_sack_scoreboard *sb, uint32_t start, uint32_t end)
+{
+	struct tcp_sack_block merged[NET_TCP_SACK_MAX_BLOCKS + 1];
+	bool placed = false;
+	int count = 0;
+
+	for (int i = 0; i < sb->count; i++) {
+		struct tcp_sack_block *block = &sb->blocks[i];
+
+		if (net_tcp_seq_cmp(block->end, start) < 0) {
+			merged[count++] = *block;
+		} else if (net_tcp_seq_cmp(block->start, end) > 0) {
+			if (!placed) {
+				merged[count].start = start;
+				merged[count].end = end;
+				count++;
+				placed = true;
+			}
+
+			merged[count++] = *block;
+		} else {
+			if (net_tcp_seq_cmp(block->start, start) < 0) {
+				start = block->start;
+			}
+
+			if (net_tcp_seq_cmp(block->end, end) > 0) {
+				end = block->end;
+			}
+		}
+	}
+
+	if (!placed) {
+		merged[count].start = start;
+		merged[count].end = end;
+		count++;
+	}
+
+	sb->count = MIN(count, NET_TCP_SACK_MAX_BLOCKS);
+	memcpy(sb->blocks, merged, sb->count * sizeof(sb->blocks[0]));
+}
+
+/* Drop what the ACK covers from the scoreboard and merge the SACK blocks it
+ * carries.
+ */
+static void tcp_sack_update(struct tcp *conn, uint32_t ack)
+{
+	struct tcp_sack_scoreboard *sb = &conn->sack;
+	uint32_t high_data = conn->seq + conn->send_data_total;
+	int count = 0;
+
+	for (int i = 0; i < sb->count; i++) {
+		if (net_tcp_seq_cmp(sb->blocks[i].end, ack) <= 0) {
+			continue;
+		}
+
+		sb->blocks[count] = sb->blocks[i];
+		if (net_tcp_seq_cmp(sb->blocks[count].start, ack) < 0) {
+			sb->blocks[count].start = ack;
+		}
+
+		count++;
+	}
+
+	sb->count = count;
+
+	for (int i = 0; i < conn->recv_options.sack_count; i++) {
+		struct tcp_sack_block *block = &conn->recv_options.sack[i];
+
+		/* Ignore D-SACK blocks and blocks outside of the sent data */
+		if (net_tcp_seq_cmp(block->start, ack) < 0 ||
+		    net_tcp_seq_cmp(block->end, block->start) <= 0 ||
+		    net_tcp_seq_cmp(block->end, high_data) > 0) {
+			continue;
+		}
+
+		tcp_sack_insert(sb, block->start, block->end);
+	}
+
+	conn->recv_options.sack_count = 0;
+}
+
+/* IsLost(): more than DupThresh - 1 segments worth of data, or DupThresh
+ * ranges, have been SACKed above seq.
+ */
+static bool tcp_sack_is_lost(struct tcp *conn, uint32_t seq)
+{
+	struct tcp_sack_scoreboard *sb = &conn->sack;
+	uint32_t sacked = 0;
+	int ranges = 0;
+
+	for (int i = 0; i < sb->count; i++) {
+		struct tcp_sack_block *block = &sb->blocks[i];
+
+		if (net_tcp_seq_cmp(block->end, seq) <= 0) {
+			continue;
+		}
+
+		if (net_tcp_seq_cmp(block->start, seq) > 0) {
+			sacked += block->end - block->start;
+		} else {
+			sacked += block->end - seq;
+		}
+
+		ranges++;
+	}
+
+	return ranges >= DUPLICATE_ACK_RETRANSMIT_TRHESHOLD ||
+	       sacked > (DUPLICATE_ACK_RETRANSMIT_TRHESHOLD - 1) * conn_mss(conn);
+}
+
+/* Retransmit at most one MSS of the hole starting at seq */
+static void tcp_sack_send_hole(struct tcp *conn, uint32_t seq)
+{
+	struct tcp_sack_scoreboard *sb = &conn->sack;
+	uint32_t end = conn->seq + conn->unacked_len;
+	int len;
+
+	for (int i = 0; i < sb->count; i++) {
+		if (net_tcp_seq_cmp(sb->blocks[i].start, seq) > 0) {
+			if (net_tcp_seq_cmp(sb->blocks[i].start, end) < 0) {
+				end = sb->blocks[i].start;
+			}
+
+			break;
+		}
+	}
+
+	if (net_tcp_seq_cmp(end, seq) <= 0) {
+		return;
+	}
+
+	len = MIN((int)(end - seq), conn_mss(conn));
+
+	NET_DBG("conn: %p retransmit seq %u len %d", conn, seq, len);
+
+	if (tcp_send_segment(conn, seq - conn->seq, len) == 0) {
+		sb->high_rxt = seq + len;
+
+		net_stats_update_tcp_resent(conn->iface, len);
+		net_stats_update_tcp_seg_rexmit(conn->iface);
+	}
+}
+
+/* NextSeg() rule 1: retransmit the first hole above HighRxt deemed lost */
+static void tcp_sack_retransmit(struct tcp *conn)
+{
+	struct tcp_sack_scoreboard *sb = &conn->sack;
+	uint32_t seq = conn->seq;
+
+	if (net_tcp_seq_cmp(sb->high_rxt, seq) > 0) {
+		seq = sb->high_rxt;
+	}
+
+	for (int i = 0; i < sb->count; i++) {
+		struct tcp_sack_block *block = &sb->blocks[i];
+
+		if (net_tcp_seq_cmp(seq, block->start) < 0) {
+			/* Holes further up are even less likely to be lost */
+			if (tcp_sack_is_lost(conn, seq)) {
+				tcp_sack_send_hole(conn, seq);
+			}
+
+			return;
+		}
+
+		if (net_tcp_seq_cmp(seq, block->end) < 0) {
+			seq = block->end;
+		}
+	}
+}
+
+static void tcp_sack_dup_ack(struct tcp *conn)
+{
+	struct tcp_sack_scoreboard *sb = &conn->sack;
+
+	if (sb->in_recovery) {
+		tcp_sack_retransmit(conn);
+		return;
+	}
+
+	/* Only enter loss recovery when not already in a resend state */
+	if ((conn->data_mode != TCP_DATA_MODE_SEND) ||
+	    ((conn->dup_ack_cnt < DUPLICATE_ACK_RETRANSMIT_TRHESHOLD) &&
+	     !tcp_sack_is_lost(conn, conn->seq))) {
+		return;
+	}
+
+	NET_DBG("conn: %p enter loss recovery, %d SACK ranges", conn, sb->count);
+
+	sb->in_recovery = true;
+	sb->recovery_point = conn->seq + conn->unacked_len;
+	sb->high_rxt = conn->seq;
+
+	tcp_ca_fast_retransmit(conn);
+	if (tcp_window_full(conn)) {
+		(void)k_sem_take(&conn->tx_sem, K_NO_WAIT);
+	}
+
+	tcp_sack_send_hole(conn, conn->seq);
+}
+
+/* SND.UNA moved forward */
+static void tcp_sack_acked(struct tcp *conn)
+{
+	struct tcp_sack_scoreboard *sb = &conn->sack;
+
+	if (!sb->in_recovery) {
+		return;
+	}
+
+	if (net_tcp_seq_cmp(conn->seq, sb->recovery_point) >= 0) {
+		NET_DBG("conn: %p exit loss recovery", conn);
+		sb->in_recovery = false;
+		return;
+	}
+
+	/* A partial ACK beyond what was retransmitted means that the segment
+	 * at SND.UNA was lost too (RFC 6582).
+	 */
+	if (net_tcp_seq_cmp(conn->seq, sb->high_rxt) >= 0) {
+		tcp_sack_send_hole(conn, conn->seq);
+	} else {
+		tcp_sack_retransmit(conn);
+	}
+}
+#else
+
+static bool tcp_sack_active(struct tcp *conn) { return false; }
+
+static void tcp_sack_negotiate(struct tcp *conn) { }
+
+static void tcp_sack_reset(struct tcp *conn) { }
+
+static void tcp_sack_update(struct tcp *conn, uint32_t ack) { }
+
+static void tcp_sack_dup_ack(struct tcp *conn) { }
+
+static void tcp_sack_acked(struct tcp *conn) { }
+
+#endif
+
 /* Send all queued but unsent data from the send_data packet by packet
  * until the receiver's window is full. */
 static int tcp_send_queued_data(struct tcp *conn)
@@ -1868,6 +2408,9 @@ static void tcp_resend_data(struct k_work *work)
 			}
 		}
 
+		/* The peer may have dropped what it SACKed (RFC 2018) */
+		tcp_sack_reset(conn);
+
 		conn->data_mode = TCP_DATA_MODE_RESEND;
 		conn->unacked_len = 0;
 
@@ -2108,12 +2651,7 @@ static struct tcp *tcp_conn_alloc(void)
 #ifdef CONFIG_NET_TCP_FAST_RETRANSMIT
 	conn->dup_ack_cnt = 0;
 #endif
-#ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
-	/* Initially set the congestion window at its max size, since only the MSS
-	 * is available as soon as the connection is established
-	 */
-	conn->ca.cwnd = UINT16_MAX;
-#endif
+	tcp_ca_conn_init(conn);
 
 	/* The ISN value will be set when we get the connection attempt or
 	 * when trying to create a connection.
@@ -2983,6 +3521,7 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 		if (FL(&fl, ==, SYN)) {
 			/* Make sure our MSS is also sent in the ACK */
 			conn->send_options.mss_found = true;
+			tcp_sack_negotiate(conn);
 			conn_ack(conn, th_seq(th) + 1); /* capture peer's isn */
 			tcp_out(conn, SYN | ACK);
 			conn->send_options.mss_found = false;
@@ -3011,6 +3550,7 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 				accept_cb = conn->accepted_conn->accept_cb;
 				context = conn->accepted_conn->context;
 				keep_alive_param_copy(conn, conn->accepted_conn);
+				tcp_ca_param_copy(conn, conn->accepted_conn);
 			}
 
 			k_work_cancel_delayable(&conn->establish_timer);
@@ -3098,6 +3638,7 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 		 */
 		if (FL(&fl, &, SYN | ACK, th && th_ack(th) == conn->seq)) {
 			k_work_cancel_delayable(&conn->send_data_timer);
+			tcp_sack_negotiate(conn);
 			conn_ack(conn, th_seq(th) + 1);
 			if (len) {
 				verdict = tcp_data_get(conn, pkt, &len);
@@ -3172,6 +3713,8 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 		keep_alive_timer_restart(conn);
 
 #ifdef CONFIG_NET_TCP_FAST_RETRANSMIT
+		tcp_sack_update(conn, th_ack(th));
+
 		if (net_tcp_seq_cmp(th_ack(th), conn->seq) == 0) {
 			/* Only if there is pending data, increment the duplicate ack count */
 			if (conn->send_data_total > 0) {
@@ -3188,10 +3731,13 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 				conn->dup_ack_cnt = 0;
 			}
 
-			/* Only do fast retransmit when not already in a resend state */
-			if ((conn->data_mode == TCP_DATA_MODE_SEND) &&
-			    (conn->dup_ack_cnt == DUPLICATE_ACK_RETRANSMIT_TRHESHOLD)) {
-				/* Apply a fast retransmit */
+			if (tcp_sack_active(conn)) {
+				if ((conn->send_data_total > 0) && (len == 0)) {
+					tcp_sack_dup_ack(conn);
+				}
+			} else if ((conn->data_mode == TCP_DATA_MODE_SEND) &&
+				   (conn->dup_ack_cnt == DUPLICATE_ACK_RETRANSMIT_TRHESHOLD)) {
+				/* Apply a fast retransmit, when not already in a resend state */
 				int temp_unacked_len = conn->unacked_len;
 
 				conn->unacked_len = 0;
@@ -3235,6 +3781,7 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 			/* New segment, reset duplicate ack counter */
 			conn->dup_ack_cnt = 0;
 #endif
+			tcp_rtt_sample(conn, th_ack(th));
 			tcp_ca_pkts_acked(conn, len_acked);
 
 			conn->send_data_total -= len_acked;
@@ -3251,6 +3798,8 @@ static enum net_verdict tcp_in(struct tcp *conn, struct net_pkt *pkt)
 			conn_seq(conn, + len_acked);
 			net_stats_update_tcp_seg_recv(conn->iface);
 
+			tcp_sack_acked(conn);
+
 			/* Receipt of an acknowledgment that covers a sequence number
 			 * not previously acknowledged indicates that the connection
 			 * makes a "forward progress".
@@ -4548,6 +5097,9 @@ int net_tcp_set_option(struct net_context *context,
 	case TCP_OPT_KEEPCNT:
 		ret = set_tcp_keep_cnt(conn, value, len);
 		break;
+	case TCP_OPT_CONGESTION:
+		ret = set_tcp_congestion(conn, value, len);
+		break;
 	}
 
 	k_mutex_unlock(&conn->lock);
@@ -4585,6 +5137,9 @@ int net_tcp_get_option(struct net_context *context,
 	case TCP_OPT_KEEPCNT:
 		ret = get_tcp_keep_cnt(conn, value, len);
 		break;
+	case TCP_OPT_CONGESTION:
+		ret = get_tcp_congestion(conn, value, len);
+		break;
 	}
 
 	k_mutex_unlock(&conn->lock);
@@ -0,0 +1,155 @@
+/** @file
+ * @brief CUBIC TCP congestion control
+ */
+
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(net_tcp, CONFIG_NET_TCP_LOG_LEVEL);
+
+#include <zephyr/kernel.h>
+#include <zephyr/net/net_core.h>
+#include <zephyr/net/net_context.h>
+#include "net_private.h"
+#include "tcp_internal.h"
+
+/* Implementation according to RFC 9438. Windows are in bytes and times in
+ * milliseconds, the constants of the RFC are expressed as fractions:
+ * C = 0.4, beta = 0.7 and alpha = 3 * (1 - beta) / (1 + beta) = 9 / 17.
+ */
+
+/* Bound t - K so that its cube, scaled by the MSS, fits in 64 bits */
+#define CUBIC_MAX_OFFSET_MS 100000
+
+static uint32_t cubic_root(uint64_t x)
+{
+	uint64_t y = 0;
+
+	/* Bitwise integer cube root, three bits of x per bit of the root */
+	for (int s = 63; s >= 0; s -= 3) {
+		uint64_t b;
+
+		y <<= 1;
+		b = 3 * y * (y + 1) + 1;
+		if ((x >> s) >= b) {
+			x -= b << s;
+			y++;
+		}
+	}
+
+	return (uint32_t)y;
+}
+
+/* W_cubic(t) = C * (t - K)^3 + W_max, t and K in s and windows in segments */
+static int64_t cubic_window(struct tcp_cubic *c, uint32_t mss, int64_t t)
+{
+	int64_t offs = CLAMP(t - (int64_t)c->k, -CUBIC_MAX_OFFSET_MS, CUBIC_MAX_OFFSET_MS);
+	int64_t delta = offs * offs * offs / MSEC_PER_SEC;
+
+	/* 0.4 * mss * delta / 1000^2 */
+	return (int64_t)c->w_max + delta * 4 * mss / 10000000;
+}
+
+static void cubic_init(struct tcp *conn)
+{
+	memset(&conn->ca.cubic, 0, sizeof(conn->ca.cubic));
+
+	/* No loss seen yet, slow start until the first one */
+	conn->ca.ssthresh = UINT16_MAX;
+}
+
+static void cubic_on_ack(struct tcp *conn, uint32_t acked_len)
+{
+	struct tcp_cubic *c = &conn->ca.cubic;
+	uint32_t mss = conn_mss(conn);
+	uint32_t cwnd = conn->ca.cwnd;
+	uint32_t now = k_uptime_get_32();
+	int64_t target;
+	int64_t t;
+
+	if (!c->in_epoch) {
+		c->in_epoch = true;
+		c->epoch_start = now;
+		c->w_est = cwnd;
+
+		if (cwnd < c->w_max) {
+			/* K = cbrt((W_max - cwnd) / C), in ms */
+			c->k = cubic_root((uint64_t)(c->w_max - cwnd) * 2500000000ULL / mss);
+		} else {
+			c->k = 0;
+			c->w_max = cwnd;
+		}
+	}
+
+	/* Aim at the window one RTT from now */
+	t = (int64_t)(now - c->epoch_start) + conn->rtt.srtt / USEC_PER_MSEC;
+	target = cubic_window(c, mss, t);
+
+	/* Grow at least as fast as Reno would, alpha becomes 1 above W_max */
+	c->w_est += DIV_ROUND_UP((uint64_t)acked_len * mss * (c->w_est < c->w_max ? 9 : 17),
+				 17 * (uint64_t)cwnd);
+	c->w_est = MIN(c->w_est, UINT16_MAX);
+	target = MAX(target, (int64_t)c->w_est);
+
+	target = CLAMP(target, (int64_t)cwnd, (int64_t)(cwnd + cwnd / 2));
+	if (target > cwnd) {
+		uint64_t inc = DIV_ROUND_UP((uint64_t)(target - cwnd) * acked_len, cwnd);
+
+		conn->ca.cwnd = MIN(cwnd + inc, UINT16_MAX);
+	}
+}
+
+static void cubic_on_loss(struct tcp *conn)
+{
+	struct tcp_cubic *c = &conn->ca.cubic;
+	/* The congestion window is already inflated by the duplicate ACKs,
+	 * the flight size is what the network did hold.
+	 */
+	uint32_t cwnd = MIN(conn->ca.cwnd, conn->unacked_len);
+
+	c->in_epoch = false;
+
+	/* Fast convergence: release bandwidth to newer flows */
+	if (cwnd < c->w_max) {
+		c->w_max = cwnd * 17 / 20;
+	} else {
+		c->w_max = cwnd;
+	}
+
+	conn->ca.ssthresh = MAX(cwnd * 7 / 10, conn_mss(conn) * 2);
+
+	NET_DBG("conn: %p w_max=%u, ssthresh=%u", conn, c->w_max, conn->ca.ssthresh);
+}
+
+static uint32_t cubic_pacing_rate(struct tcp *conn)
+{
+	uint64_t rate;
+
+	if (conn->rtt.srtt == 0) {
+		return 0;
+	}
+
+	rate = (uint64_t)conn->ca.cwnd * USEC_PER_SEC / conn->rtt.srtt;
+
+	/* Leave room for the window to grow within the next RTT */
+	if (conn->ca.cwnd < conn->ca.ssthresh) {
+		rate *= 2;
+	} else {
+		rate = rate * 6 / 5;
+	}
+
+	return (uint32_t)MIN(rate, UINT32_MAX);
+}
+
+const struct tcp_ca_ops tcp_cubic_ops = {
+	.name = "cubic",
+	.init = cubic_init,
+	.on_ack = cubic_on_ack,
+	.on_loss = cubic_on_loss,
+	.on_rto = cubic_on_loss,
+	.pacing_rate = cubic_pacing_rate,
+};
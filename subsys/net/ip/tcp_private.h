@@ -229,26 +229,111 @@ union tcp_endpoint {
 #define NET_TCP_NOP_OPT          1
 #define NET_TCP_MSS_OPT          2
 #define NET_TCP_WINDOW_SCALE_OPT 3
+#define NET_TCP_SACK_PERM_OPT    4
+#define NET_TCP_SACK_OPT         5
 
 /* TCP Option sizes */
 #define NET_TCP_END_SIZE          1
 #define NET_TCP_NOP_SIZE          1
 #define NET_TCP_MSS_SIZE          4
 #define NET_TCP_WINDOW_SCALE_SIZE 3
+#define NET_TCP_SACK_PERM_SIZE    2
+#define NET_TCP_SACK_SIZE(_n)     (2 + (_n) * 8)
+
+/* At most 4 SACK blocks fit in the 40 bytes of TCP options */
+#define NET_TCP_SACK_MAX_BLOCKS   4
+
+struct tcp_sack_block {
+	uint32_t start;
+	uint32_t end;
+};
 
 struct tcp_options {
 	uint16_t mss;
 	uint16_t window;
 	bool mss_found : 1;
 	bool wnd_found : 1;
+#ifdef CONFIG_NET_TCP_SACK
+	bool sack_perm_found : 1;
+	uint8_t sack_count;
+	struct tcp_sack_block sack[NET_TCP_SACK_MAX_BLOCKS];
+#endif
 };
 
 #ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
 
-struct tcp_collision_avoidance_reno {
+struct tcp;
+
+/* Congestion control algorithm. The stack runs slow start and the fast
+ * recovery of RFC 6582 itself, the algorithm decides how the congestion
+ * window grows once out of slow start and how much it shrinks on a loss.
+ */
+struct tcp_ca_ops {
+	const char *name;
+	/* Connection established, set ssthresh and the algorithm state */
+	void (*init)(struct tcp *conn);
+	/* acked_len new bytes acknowledged, in congestion avoidance */
+	void (*on_ack)(struct tcp *conn, uint32_t acked_len);
+	/* Loss detected by duplicate ACKs, set ssthresh */
+	void (*on_loss)(struct tcp *conn);
+	/* Retransmission timeout, set ssthresh */
+	void (*on_rto)(struct tcp *conn);
+	/* Rate in bytes per second the data could be spread at, optional */
+	uint32_t (*pacing_rate)(struct tcp *conn);
+};
+
+#ifdef CONFIG_NET_TCP_CUBIC
+
+/* CUBIC state, RFC 9438 */
+struct tcp_cubic {
+	/* Start of the current congestion avoidance epoch, in ms */
+	uint32_t epoch_start;
+	/* Time to grow back to w_max from the start of the epoch, in ms */
+	uint32_t k;
+	/* Congestion window before the last reduction */
+	uint32_t w_max;
+	/* Window a Reno flow would have, for the TCP-friendly region */
+	uint32_t w_est;
+	bool in_epoch;
+};
+
+extern const struct tcp_ca_ops tcp_cubic_ops;
+#endif
+
+struct tcp_congestion {
+	const struct tcp_ca_ops *ops;
 	uint16_t cwnd;
 	uint16_t ssthresh;
 	uint16_t pending_fast_retransmit_bytes;
+#ifdef CONFIG_NET_TCP_CUBIC
+	struct tcp_cubic cubic;
+#endif
+};
+
+/* Round-trip time estimation, RFC 6298 */
+struct tcp_rtt {
+	/* Smoothed RTT and its variation, in us, 0 before the first sample */
+	uint32_t srtt;
+	uint32_t rttvar;
+	/* Segment being timed: sent at start (in ticks), acked by seq */
+	uint32_t seq;
+	uint32_t start;
+	bool timing;
+};
+#endif
+
+#ifdef CONFIG_NET_TCP_SACK
+
+/* Sender side SACK scoreboard, RFC 6675 */
+struct tcp_sack_scoreboard {
+	/* SACKed ranges above SND.UNA, sorted and disjoint */
+	struct tcp_sack_block blocks[NET_TCP_SACK_MAX_BLOCKS];
+	/* HighData when loss recovery was entered */
+	uint32_t recovery_point;
+	/* Highest sequence number retransmitted during loss recovery */
+	uint32_t high_rxt;
+	uint8_t count;
+	bool in_recovery;
 };
 #endif
 
@@ -324,7 +409,11 @@ struct tcp { /* TCP connection */
 	uint16_t rto;
 #endif
 #ifdef CONFIG_NET_TCP_CONGESTION_AVOIDANCE
-	struct tcp_collision_avoidance_reno ca;
+	struct tcp_congestion ca;
+	struct tcp_rtt rtt;
+#endif
+#ifdef CONFIG_NET_TCP_SACK
+	struct tcp_sack_scoreboard sack;
 #endif
 	uint8_t send_data_retries;
 #ifdef CONFIG_NET_TCP_FAST_RETRANSMIT
@@ -339,6 +428,9 @@ struct tcp { /* TCP connection */
 	bool tcp_nodelay : 1;
 	bool addr_ref_done : 1;
 	bool rst_received : 1;
+#ifdef CONFIG_NET_TCP_SACK
+	bool sack_perm : 1;
+#endif
 };
 
 #define _flags(_fl, _op, _mask, _cond)					\
@@ -131,6 +131,24 @@ static void tcp_cb(struct tcp *conn, void *user_data)
 	(*count)++;
 }
 
+#if defined(CONFIG_NET_TCP_CONGESTION_AVOIDANCE)
+static void tcp_ca_cb(struct tcp *conn, void *user_data)
+{
+	struct net_shell_user_data *data = user_data;
+	const struct shell *sh = data->sh;
+	const struct tcp_ca_ops *ops = conn->ca.ops;
+
+	if (conn->state == TCP_LISTEN) {
+		return;
+	}
+
+	PR("%p %-8s %5u %8u %10u %10u %10u\n",
+	   conn, ops->name, conn->ca.cwnd, conn->ca.ssthresh,
+	   conn->rtt.srtt, conn->rtt.rttvar,
+	   ops->pacing_rate != NULL ? ops->pacing_rate(conn) : 0U);
+}
+#endif /* CONFIG_NET_TCP_CONGESTION_AVOIDANCE */
+
 #if CONFIG_NET_TCP_LOG_LEVEL >= LOG_LEVEL_DBG
 static void tcp_sent_list_cb(struct tcp *conn, void *user_data)
 {
@@ -248,6 +266,12 @@ static int cmd_net_conn(const struct shell *sh, size_t argc, char *argv[])
 	if (count == 0) {
 		PR("No TCP connections\n");
 	} else {
+#if defined(CONFIG_NET_TCP_CONGESTION_AVOIDANCE)
+		PR("\nTCP        CC        Cwnd Ssthresh  SRTT (us) RTTVAR(us) Pacing B/s\n");
+
+		net_tcp_foreach(tcp_ca_cb, &user_data);
+#endif /* CONFIG_NET_TCP_CONGESTION_AVOIDANCE */
+
 #if CONFIG_NET_TCP_LOG_LEVEL >= LOG_LEVEL_DBG
 		/* Print information about pending packets */
 		struct tcp_detail_info details;
@@ -13,7 +13,10 @@ LOG_MODULE_REGISTER(net_sock, CONFIG_NET_SOCKETS_LOG_LEVEL);
 #include <zephyr/kernel.h>
 #include <zephyr/tracing/tracing.h>
 #include <zephyr/net/socket.h>
+#include <zephyr/net_buf.h>
 #include <zephyr/internal/syscall_handler.h>
+#include <zephyr/sys/math_extras.h>
+#include <zephyr/sys/timeutil.h>
 
 #include "sockets_internal.h"
 
@@ -386,90 +389,208 @@ ssize_t z_impl_zsock_sendmsg(int sock, const struct msghdr *msg, int flags)
 }
 
 #ifdef CONFIG_USERSPACE
-static inline ssize_t z_vrfy_zsock_sendmsg(int sock,
-					   const struct msghdr *msg,
-					   int flags)
+/* User space side of a message header whose kernel copy was made by
+ * msghdr_from_user(). Nothing in it is read from user space after the copy.
+ */
+struct msghdr_user {
+	/* User space I/O vector array, and a kernel copy of it */
+	struct iovec *iov;
+	struct iovec *iov_copy;
+	size_t iovlen;
+	void *name;
+	socklen_t namelen;
+	void *control;
+	size_t controllen;
+};
+
+/* Free the kernel copies made by msghdr_from_user() */
+static void msghdr_user_free(struct msghdr *msg_copy, struct msghdr_user *user)
 {
-	struct msghdr msg_copy;
-	size_t i;
-	int ret;
+	k_free(msg_copy->msg_name);
+	k_free(msg_copy->msg_control);
 
-	K_OOPS(k_usermode_from_copy(&msg_copy, (void *)msg, sizeof(msg_copy)));
+	if (msg_copy->msg_iov != NULL) {
+		for (size_t i = 0; i < user->iovlen; i++) {
+			k_free(msg_copy->msg_iov[i].iov_base);
+		}
+
+		k_free(msg_copy->msg_iov);
+	}
+
+	k_free(user->iov_copy);
 
-	msg_copy.msg_name = NULL;
-	msg_copy.msg_control = NULL;
+	msg_copy->msg_name = NULL;
+	msg_copy->msg_control = NULL;
+	msg_copy->msg_iov = NULL;
+	user->iov_copy = NULL;
+}
 
-	msg_copy.msg_iov = k_usermode_alloc_from_copy(msg->msg_iov,
-				       msg->msg_iovlen * sizeof(struct iovec));
-	if (!msg_copy.msg_iov) {
+/* Replace the user space pointers of a message header, already copied to
+ * msg_copy, by kernel copies of the I/O vectors, address and control data.
+ * The user space pointers and sizes are kept in user. On failure, errno is
+ * set and nothing is left allocated.
+ */
+static int msghdr_from_user(struct msghdr *msg_copy, struct msghdr_user *user)
+{
+	size_t size;
+
+	user->iov = msg_copy->msg_iov;
+	user->iov_copy = NULL;
+	user->iovlen = msg_copy->msg_iovlen;
+	user->name = msg_copy->msg_name;
+	user->namelen = msg_copy->msg_namelen;
+	user->control = msg_copy->msg_control;
+	user->controllen = msg_copy->msg_controllen;
+
+	msg_copy->msg_name = NULL;
+	msg_copy->msg_control = NULL;
+	msg_copy->msg_iov = NULL;
+
+	if (user->iov == NULL ||
+	    size_mul_overflow(user->iovlen, sizeof(struct iovec), &size)) {
+		errno = ENOMEM;
+		return -1;
+	}
+
+	user->iov_copy = k_usermode_alloc_from_copy(user->iov, size);
+	if (user->iov_copy == NULL) {
+		errno = ENOMEM;
+		return -1;
+	}
+
+	/* Zeroed, so that a partial failure only frees what was copied */
+	msg_copy->msg_iov = k_calloc(user->iovlen, sizeof(struct iovec));
+	if (msg_copy->msg_iov == NULL && user->iovlen > 0) {
 		errno = ENOMEM;
 		goto fail;
 	}
 
-	for (i = 0; i < msg->msg_iovlen; i++) {
-		msg_copy.msg_iov[i].iov_base =
-			k_usermode_alloc_from_copy(msg->msg_iov[i].iov_base,
-					       msg->msg_iov[i].iov_len);
-		if (!msg_copy.msg_iov[i].iov_base) {
+	for (size_t i = 0; i < user->iovlen; i++) {
+		/* TODO: In practice we do not need to copy the actual data
+		 * in msghdr when receiving data but currently there is no
+		 * ready made function to do just that (unless we want to call
+		 * relevant malloc function here ourselves). So just use
+		 * the copying variant for now.
+		 */
+		msg_copy->msg_iov[i].iov_base =
+			k_usermode_alloc_from_copy(user->iov_copy[i].iov_base,
+						   user->iov_copy[i].iov_len);
+		if (msg_copy->msg_iov[i].iov_base == NULL) {
 			errno = ENOMEM;
 			goto fail;
 		}
 
-		msg_copy.msg_iov[i].iov_len = msg->msg_iov[i].iov_len;
+		msg_copy->msg_iov[i].iov_len = user->iov_copy[i].iov_len;
 	}
 
-	if (msg->msg_namelen > 0) {
-		msg_copy.msg_name = k_usermode_alloc_from_copy(msg->msg_name,
-							   msg->msg_namelen);
-		if (!msg_copy.msg_name) {
+	if (user->namelen > 0) {
+		if (user->name == NULL) {
+			errno = EINVAL;
+			goto fail;
+		}
+
+		msg_copy->msg_name = k_usermode_alloc_from_copy(user->name,
+								user->namelen);
+		if (msg_copy->msg_name == NULL) {
 			errno = ENOMEM;
 			goto fail;
 		}
 	}
 
-	if (msg->msg_controllen > 0) {
-		msg_copy.msg_control = k_usermode_alloc_from_copy(msg->msg_control,
-							  msg->msg_controllen);
-		if (!msg_copy.msg_control) {
+	if (user->controllen > 0) {
+		if (user->control == NULL) {
+			errno = EINVAL;
+			goto fail;
+		}
+
+		msg_copy->msg_control = k_usermode_alloc_from_copy(user->control,
+								   user->controllen);
+		if (msg_copy->msg_control == NULL) {
 			errno = ENOMEM;
 			goto fail;
 		}
 	}
 
-	ret = z_impl_zsock_sendmsg(sock, (const struct msghdr *)&msg_copy,
-				   flags);
-
-	k_free(msg_copy.msg_name);
-	k_free(msg_copy.msg_control);
+	return 0;
 
-	for (i = 0; i < msg_copy.msg_iovlen; i++) {
-		k_free(msg_copy.msg_iov[i].iov_base);
-	}
+fail:
+	msghdr_user_free(msg_copy, user);
 
-	k_free(msg_copy.msg_iov);
+	return -1;
+}
 
-	return ret;
+/* Copy a received message back to the user space message header msg, using
+ * only the kernel copy and the user space pointers kept by msghdr_from_user().
+ */
+static void msghdr_to_user(struct msghdr *msg, const struct msghdr *msg_copy,
+			   const struct msghdr_user *user)
+{
+	size_t controllen = 0U;
+	size_t len;
 
-fail:
-	if (msg_copy.msg_name) {
-		k_free(msg_copy.msg_name);
+	if (user->namelen > 0) {
+		/* msg_namelen is the full address length, even if truncated */
+		len = MIN(msg_copy->msg_namelen, user->namelen);
+		K_OOPS(k_usermode_to_copy(user->name, msg_copy->msg_name, len));
 	}
 
-	if (msg_copy.msg_control) {
-		k_free(msg_copy.msg_control);
+	K_OOPS(k_usermode_to_copy(&msg->msg_namelen, &msg_copy->msg_namelen,
+				  sizeof(msg->msg_namelen)));
+
+	if (user->controllen > 0) {
+		controllen = MIN(msg_copy->msg_controllen, user->controllen);
+		K_OOPS(k_usermode_to_copy(user->control, msg_copy->msg_control,
+					  controllen));
 	}
 
-	if (msg_copy.msg_iov) {
-		for (i = 0; i < msg_copy.msg_iovlen; i++) {
-			if (msg_copy.msg_iov[i].iov_base) {
-				k_free(msg_copy.msg_iov[i].iov_base);
-			}
+	K_OOPS(k_usermode_to_copy(&msg->msg_controllen, &controllen,
+				  sizeof(msg->msg_controllen)));
+
+	/* The new iovlen cannot be bigger than the original one */
+	NET_ASSERT(msg_copy->msg_iovlen <= user->iovlen);
+
+	K_OOPS(k_usermode_to_copy(&msg->msg_iovlen, &msg_copy->msg_iovlen,
+				  sizeof(msg->msg_iovlen)));
+
+	for (size_t i = 0; i < user->iovlen; i++) {
+		/* Clear out those vectors that we could not populate */
+		len = 0U;
+
+		if (i < msg_copy->msg_iovlen) {
+			len = MIN(msg_copy->msg_iov[i].iov_len,
+				  user->iov_copy[i].iov_len);
+			K_OOPS(k_usermode_to_copy(user->iov_copy[i].iov_base,
+						  msg_copy->msg_iov[i].iov_base, len));
 		}
 
-		k_free(msg_copy.msg_iov);
+		K_OOPS(k_usermode_to_copy(&user->iov[i].iov_len, &len,
+					  sizeof(user->iov[i].iov_len)));
 	}
 
-	return -1;
+	K_OOPS(k_usermode_to_copy(&msg->msg_flags, &msg_copy->msg_flags,
+				  sizeof(msg->msg_flags)));
+}
+
+static inline ssize_t z_vrfy_zsock_sendmsg(int sock,
+					   const struct msghdr *msg,
+					   int flags)
+{
+	struct msghdr msg_copy;
+	struct msghdr_user user;
+	int ret;
+
+	K_OOPS(k_usermode_from_copy(&msg_copy, (void *)msg, sizeof(msg_copy)));
+
+	if (msghdr_from_user(&msg_copy, &user) < 0) {
+		return -1;
+	}
+
+	ret = z_impl_zsock_sendmsg(sock, (const struct msghdr *)&msg_copy,
+				   flags);
+
+	msghdr_user_free(&msg_copy, &user);
+
+	return ret;
 }
 #include <zephyr/syscalls/zsock_sendmsg_mrsh.c>
 #endif /* CONFIG_USERSPACE */
@@ -544,8 +665,7 @@ ssize_t z_impl_zsock_recvmsg(int sock, struct msghdr *msg, int flags)
 ssize_t z_vrfy_zsock_recvmsg(int sock, struct msghdr *msg, int flags)
 {
 	struct msghdr msg_copy;
-	size_t iovlen;
-	size_t i;
+	struct msghdr_user user;
 	int ret;
 
 	if (msg == NULL) {
@@ -553,163 +673,331 @@ ssize_t z_vrfy_zsock_recvmsg(int sock, struct msghdr *msg, int flags)
 		return -1;
 	}
 
-	if (msg->msg_iov == NULL) {
-		errno = ENOMEM;
+	K_OOPS(k_usermode_from_copy(&msg_copy, (void *)msg, sizeof(msg_copy)));
+
+	if (msghdr_from_user(&msg_copy, &user) < 0) {
 		return -1;
 	}
 
-	K_OOPS(k_usermode_from_copy(&msg_copy, (void *)msg, sizeof(msg_copy)));
+	ret = z_impl_zsock_recvmsg(sock, &msg_copy, flags);
 
-	k_usermode_from_copy(&iovlen, &msg->msg_iovlen, sizeof(iovlen));
+	/* Do not copy anything back if there was an error or nothing was
+	 * received.
+	 */
+	if (ret > 0) {
+		msghdr_to_user(msg, &msg_copy, &user);
+	}
 
-	msg_copy.msg_name = NULL;
-	msg_copy.msg_control = NULL;
+	msghdr_user_free(&msg_copy, &user);
 
-	msg_copy.msg_iov = k_usermode_alloc_from_copy(msg->msg_iov,
-				       msg->msg_iovlen * sizeof(struct iovec));
-	if (!msg_copy.msg_iov) {
-		errno = ENOMEM;
-		goto fail;
+	return ret;
+}
+#include <zephyr/syscalls/zsock_recvmsg_mrsh.c>
+#endif /* CONFIG_USERSPACE */
+
+/* Receive messages until vlen are received, an error or, once a message has
+ * been received, the end time point is reached. The socket is looked up and
+ * locked once for all of them.
+ */
+static int zsock_recvmmsg_until(int sock, struct mmsghdr *msgvec, unsigned int vlen,
+				int flags, k_timepoint_t end)
+{
+	const struct socket_op_vtable *vtable;
+	struct k_mutex *lock;
+	unsigned int received = 0;
+	int bytes_total = 0;
+	void *obj;
+
+	obj = get_sock_vtable(sock, &vtable, &lock);
+	if (obj == NULL) {
+		errno = EBADF;
+		return -1;
 	}
 
-	/* Clear the pointers in the copy so that if the allocation in the
-	 * next loop fails, we do not try to free non allocated memory
-	 * in fail branch.
-	 */
-	memset(msg_copy.msg_iov, 0, msg->msg_iovlen * sizeof(struct iovec));
+	if (vtable->recvmsg == NULL) {
+		errno = EOPNOTSUPP;
+		return -1;
+	}
 
-	for (i = 0; i < iovlen; i++) {
-		/* TODO: In practice we do not need to copy the actual data
-		 * in msghdr when receiving data but currently there is no
-		 * ready made function to do just that (unless we want to call
-		 * relevant malloc function here ourselves). So just use
-		 * the copying variant for now.
-		 */
-		msg_copy.msg_iov[i].iov_base =
-			k_usermode_alloc_from_copy(msg->msg_iov[i].iov_base,
-						   msg->msg_iov[i].iov_len);
-		if (!msg_copy.msg_iov[i].iov_base) {
-			errno = ENOMEM;
-			goto fail;
+	vlen = MIN(vlen, INT_MAX);
+
+	(void)k_mutex_lock(lock, K_FOREVER);
+
+	while (received < vlen) {
+		struct msghdr *msg = &msgvec[received].msg_hdr;
+		ssize_t bytes_received;
+
+		SYS_PORT_TRACING_OBJ_FUNC_ENTER(socket, recvmsg, sock, msg, flags);
+
+		bytes_received = vtable->recvmsg(obj, msg, flags & ~ZSOCK_MSG_WAITFORONE);
+
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(socket, recvmsg, sock, msg,
+					       bytes_received < 0 ? -errno : bytes_received);
+
+		if (bytes_received < 0) {
+			break;
 		}
 
-		msg_copy.msg_iov[i].iov_len = msg->msg_iov[i].iov_len;
-	}
+		msgvec[received++].msg_len = bytes_received;
+		bytes_total += bytes_received;
 
-	if (msg->msg_namelen > 0) {
-		if (msg->msg_name == NULL) {
-			errno = EINVAL;
-			goto fail;
+		if (flags & ZSOCK_MSG_WAITFORONE) {
+			flags |= ZSOCK_MSG_DONTWAIT;
 		}
 
-		msg_copy.msg_name = k_usermode_alloc_from_copy(msg->msg_name,
-							   msg->msg_namelen);
-		if (msg_copy.msg_name == NULL) {
-			errno = ENOMEM;
-			goto fail;
+		if (sys_timepoint_expired(end)) {
+			break;
 		}
 	}
 
-	if (msg->msg_controllen > 0) {
-		if (msg->msg_control == NULL) {
+	k_mutex_unlock(lock);
+
+	sock_obj_core_update_recv_stats(sock, bytes_total);
+
+	/* An error is only reported if no message was received */
+	return (received > 0 || vlen == 0) ? received : -1;
+}
+
+int z_impl_zsock_recvmmsg(int sock, struct mmsghdr *msgvec, unsigned int vlen,
+			  int flags, struct timespec *timeout)
+{
+	k_timeout_t to = K_FOREVER;
+
+	if (timeout != NULL) {
+		if (!timespec_is_valid(timeout)) {
 			errno = EINVAL;
-			goto fail;
+			return -1;
 		}
 
-		msg_copy.msg_control =
-			k_usermode_alloc_from_copy(msg->msg_control,
-						   msg->msg_controllen);
-		if (msg_copy.msg_control == NULL) {
-			errno = ENOMEM;
-			goto fail;
-		}
+		to = timespec_to_timeout(timeout);
 	}
 
-	ret = z_impl_zsock_recvmsg(sock, &msg_copy, flags);
+	return zsock_recvmmsg_until(sock, msgvec, vlen, flags, sys_timepoint_calc(to));
+}
 
-	/* Do not copy anything back if there was an error or nothing was
-	 * received.
-	 */
-	if (ret > 0) {
-		if (msg->msg_namelen > 0 && msg->msg_name != NULL) {
-			K_OOPS(k_usermode_to_copy(msg->msg_name,
-						  msg_copy.msg_name,
-						  msg_copy.msg_namelen));
-		}
+int z_impl_zsock_sendmmsg(int sock, struct mmsghdr *msgvec, unsigned int vlen,
+			  int flags)
+{
+	const struct socket_op_vtable *vtable;
+	struct k_mutex *lock;
+	unsigned int sent = 0;
+	int bytes_total = 0;
+	void *obj;
+
+	obj = get_sock_vtable(sock, &vtable, &lock);
+	if (obj == NULL) {
+		errno = EBADF;
+		return -1;
+	}
+
+	if (vtable->sendmsg == NULL) {
+		errno = EOPNOTSUPP;
+		return -1;
+	}
+
+	vlen = MIN(vlen, INT_MAX);
+
+	(void)k_mutex_lock(lock, K_FOREVER);
+
+	while (sent < vlen) {
+		struct msghdr *msg = &msgvec[sent].msg_hdr;
+		ssize_t bytes_sent;
+
+		SYS_PORT_TRACING_OBJ_FUNC_ENTER(socket, sendmsg, sock, msg, flags);
 
-		if (msg->msg_controllen > 0 &&
-		    msg->msg_control != NULL) {
-			K_OOPS(k_usermode_to_copy(msg->msg_control,
-						  msg_copy.msg_control,
-						  msg_copy.msg_controllen));
+		bytes_sent = vtable->sendmsg(obj, msg, flags);
 
-			msg->msg_controllen = msg_copy.msg_controllen;
-		} else {
-			msg->msg_controllen = 0U;
+		SYS_PORT_TRACING_OBJ_FUNC_EXIT(socket, sendmsg, sock,
+					       bytes_sent < 0 ? -errno : bytes_sent);
+
+		if (bytes_sent < 0) {
+			break;
 		}
 
-		k_usermode_to_copy(&msg->msg_iovlen,
-				   &msg_copy.msg_iovlen,
-				   sizeof(msg->msg_iovlen));
-
-		/* The new iovlen cannot be bigger than the original one */
-		NET_ASSERT(msg_copy.msg_iovlen <= iovlen);
-
-		for (i = 0; i < iovlen; i++) {
-			if (i < msg_copy.msg_iovlen) {
-				K_OOPS(k_usermode_to_copy(msg->msg_iov[i].iov_base,
-							  msg_copy.msg_iov[i].iov_base,
-							  msg_copy.msg_iov[i].iov_len));
-				K_OOPS(k_usermode_to_copy(&msg->msg_iov[i].iov_len,
-							  &msg_copy.msg_iov[i].iov_len,
-							  sizeof(msg->msg_iov[i].iov_len)));
-			} else {
-				/* Clear out those vectors that we could not populate */
-				msg->msg_iov[i].iov_len = 0;
-			}
+		msgvec[sent++].msg_len = bytes_sent;
+		bytes_total += bytes_sent;
+	}
+
+	k_mutex_unlock(lock);
+
+	sock_obj_core_update_send_stats(sock, bytes_total);
+
+	/* An error is only reported if no message was sent */
+	return (sent > 0 || vlen == 0) ? sent : -1;
+}
+
+#ifdef CONFIG_USERSPACE
+/* Number of messages copied from user space at a time, bounded by the
+ * privileged stack holding their struct msghdr_user.
+ */
+#define MMSG_USER_CHUNK 4
+
+/* Run a chunk of a recvmmsg() or sendmmsg() call on kernel copies of the
+ * user space messages.
+ */
+static int mmsg_user_chunk(int sock, struct mmsghdr *msgvec, unsigned int vlen,
+			   int flags, k_timepoint_t end, bool recv)
+{
+	struct msghdr_user user[MMSG_USER_CHUNK];
+	struct mmsghdr *vec_copy;
+	unsigned int copied;
+	int ret = -1;
+
+	__ASSERT_NO_MSG(vlen <= MMSG_USER_CHUNK);
+
+	vec_copy = k_usermode_alloc_from_copy(msgvec, vlen * sizeof(*msgvec));
+	if (vec_copy == NULL) {
+		errno = ENOMEM;
+		return -1;
+	}
+
+	for (copied = 0; copied < vlen; copied++) {
+		if (msghdr_from_user(&vec_copy[copied].msg_hdr, &user[copied]) < 0) {
+			goto out;
 		}
+	}
 
-		k_usermode_to_copy(&msg->msg_flags,
-				   &msg_copy.msg_flags,
-				   sizeof(msg->msg_flags));
+	if (recv) {
+		ret = zsock_recvmmsg_until(sock, vec_copy, vlen, flags, end);
+	} else {
+		ret = z_impl_zsock_sendmmsg(sock, vec_copy, vlen, flags);
 	}
 
-	k_free(msg_copy.msg_name);
-	k_free(msg_copy.msg_control);
+	for (int i = 0; i < ret; i++) {
+		if (recv && vec_copy[i].msg_len > 0) {
+			msghdr_to_user(&msgvec[i].msg_hdr, &vec_copy[i].msg_hdr, &user[i]);
+		}
 
-	/* Note that we need to free according to original iovlen */
-	for (i = 0; i < iovlen; i++) {
-		k_free(msg_copy.msg_iov[i].iov_base);
+		K_OOPS(k_usermode_to_copy(&msgvec[i].msg_len, &vec_copy[i].msg_len,
+					  sizeof(msgvec[i].msg_len)));
 	}
 
-	k_free(msg_copy.msg_iov);
+out:
+	for (unsigned int i = 0; i < copied; i++) {
+		msghdr_user_free(&vec_copy[i].msg_hdr, &user[i]);
+	}
+
+	k_free(vec_copy);
 
 	return ret;
+}
 
-fail:
-	if (msg_copy.msg_name) {
-		k_free(msg_copy.msg_name);
-	}
+static int mmsg_user(int sock, struct mmsghdr *msgvec, unsigned int vlen, int flags,
+		     k_timepoint_t end, bool recv)
+{
+	unsigned int done = 0;
+
+	vlen = MIN(vlen, INT_MAX);
+
+	while (done < vlen) {
+		unsigned int n = MIN(vlen - done, MMSG_USER_CHUNK);
+		int ret;
 
-	if (msg_copy.msg_control) {
-		k_free(msg_copy.msg_control);
+		ret = mmsg_user_chunk(sock, &msgvec[done], n, flags, end, recv);
+		if (ret < 0) {
+			return (done > 0) ? done : -1;
+		}
+
+		done += ret;
+
+		if (ret < n || (recv && sys_timepoint_expired(end))) {
+			break;
+		}
+
+		if (flags & ZSOCK_MSG_WAITFORONE) {
+			flags |= ZSOCK_MSG_DONTWAIT;
+		}
 	}
 
-	if (msg_copy.msg_iov) {
-		for (i = 0; i < msg_copy.msg_iovlen; i++) {
-			if (msg_copy.msg_iov[i].iov_base) {
-				k_free(msg_copy.msg_iov[i].iov_base);
-			}
+	return done;
+}
+
+int z_vrfy_zsock_recvmmsg(int sock, struct mmsghdr *msgvec, unsigned int vlen,
+			  int flags, struct timespec *timeout)
+{
+	k_timeout_t to = K_FOREVER;
+
+	if (timeout != NULL) {
+		struct timespec timeout_copy;
+
+		K_OOPS(k_usermode_from_copy(&timeout_copy, timeout, sizeof(timeout_copy)));
+
+		if (!timespec_is_valid(&timeout_copy)) {
+			errno = EINVAL;
+			return -1;
 		}
 
-		k_free(msg_copy.msg_iov);
+		to = timespec_to_timeout(&timeout_copy);
 	}
 
-	return -1;
+	return mmsg_user(sock, msgvec, vlen, flags, sys_timepoint_calc(to), true);
 }
-#include <zephyr/syscalls/zsock_recvmsg_mrsh.c>
+#include <zephyr/syscalls/zsock_recvmmsg_mrsh.c>
+
+int z_vrfy_zsock_sendmmsg(int sock, struct mmsghdr *msgvec, unsigned int vlen,
+			  int flags)
+{
+	return mmsg_user(sock, msgvec, vlen, flags, sys_timepoint_calc(K_FOREVER), false);
+}
+#include <zephyr/syscalls/zsock_sendmmsg_mrsh.c>
 #endif /* CONFIG_USERSPACE */
 
+#if defined(CONFIG_NET_SOCKETS_ZEROCOPY)
+ssize_t zsock_recv_loan(int sock, struct net_buf **frags, int flags,
+			struct sockaddr *src_addr, socklen_t *addrlen)
+{
+	ssize_t bytes_received;
+
+	/* Loaned buffers are kernel memory, never hand them to user mode */
+	if (k_is_user_context()) {
+		errno = EPERM;
+		return -1;
+	}
+
+	if (frags == NULL) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	*frags = NULL;
+
+	bytes_received = VTABLE_CALL(recv_loan, sock, frags, flags, src_addr, addrlen);
+
+	sock_obj_core_update_recv_stats(sock, bytes_received);
+
+	return bytes_received;
+}
+
+void zsock_loan_release(struct net_buf *frags)
+{
+	if (frags != NULL) {
+		net_buf_unref(frags);
+	}
+}
+
+ssize_t zsock_send_loan(int sock, struct net_buf *frags, int flags,
+			const struct sockaddr *dest_addr, socklen_t addrlen)
+{
+	ssize_t bytes_sent;
+
+	if (k_is_user_context()) {
+		errno = EPERM;
+		return -1;
+	}
+
+	if (frags == NULL) {
+		errno = EINVAL;
+		return -1;
+	}
+
+	bytes_sent = VTABLE_CALL(send_loan, sock, frags, flags, dest_addr, addrlen);
+
+	sock_obj_core_update_send_stats(sock, bytes_sent);
+
+	return bytes_sent;
+}
+#endif /* CONFIG_NET_SOCKETS_ZEROCOPY */
+
 /* As this is limited function, we don't follow POSIX signature, with
  * "..." instead of last arg.
  */
@@ -1077,6 +1077,41 @@ static int update_msg_controllen(struct msghdr *msg)
 	return 0;
 }
 
+static int sock_get_src_addr(struct net_context *ctx, struct net_pkt *pkt,
+			     struct sockaddr *src_addr, socklen_t *addrlen)
+{
+	int ret;
+
+	if (IS_ENABLED(CONFIG_NET_OFFLOAD) &&
+	    net_if_is_ip_offloaded(net_context_get_iface(ctx))) {
+		ret  = sock_get_offload_pkt_src_addr(pkt, ctx, src_addr,
+							*addrlen);
+		if (ret < 0) {
+			NET_DBG("sock_get_offload_pkt_src_addr %d", ret);
+			return ret;
+		}
+	} else {
+		ret = sock_get_pkt_src_addr(ctx, pkt, src_addr, *addrlen);
+		if (ret < 0) {
+			NET_DBG("sock_get_pkt_src_addr %d", ret);
+			return ret;
+		}
+	}
+
+	/* addrlen is a value-result argument, set to actual
+	 * size of source address
+	 */
+	if (src_addr->sa_family == AF_INET) {
+		*addrlen = sizeof(struct sockaddr_in);
+	} else if (src_addr->sa_family == AF_INET6) {
+		*addrlen = sizeof(struct sockaddr_in6);
+	} else {
+		return -ENOTSUP;
+	}
+
+	return 0;
+}
+
 static ssize_t zsock_recv_dgram(struct net_context *ctx,
 				struct msghdr *msg,
 				void *buf,
@@ -1128,37 +1163,11 @@ static ssize_t zsock_recv_dgram(struct net_context *ctx,
 	net_pkt_cursor_backup(pkt, &backup);
 
 	if (src_addr && addrlen) {
-		if (IS_ENABLED(CONFIG_NET_OFFLOAD) &&
-		    net_if_is_ip_offloaded(net_context_get_iface(ctx))) {
-			int ret;
-
-			ret  = sock_get_offload_pkt_src_addr(pkt, ctx, src_addr,
-								*addrlen);
-			if (ret < 0) {
-				errno = -ret;
-				NET_DBG("sock_get_offload_pkt_src_addr %d", ret);
-				goto fail;
-			}
-		} else {
-			int ret;
-
-			ret = sock_get_pkt_src_addr(ctx, pkt, src_addr, *addrlen);
-			if (ret < 0) {
-				errno = -ret;
-				NET_DBG("sock_get_pkt_src_addr %d", ret);
-				goto fail;
-			}
-		}
+		int ret;
 
-		/* addrlen is a value-result argument, set to actual
-		 * size of source address
-		 */
-		if (src_addr->sa_family == AF_INET) {
-			*addrlen = sizeof(struct sockaddr_in);
-		} else if (src_addr->sa_family == AF_INET6) {
-			*addrlen = sizeof(struct sockaddr_in6);
-		} else {
-			errno = ENOTSUP;
+		ret = sock_get_src_addr(ctx, pkt, src_addr, addrlen);
+		if (ret < 0) {
+			errno = -ret;
 			goto fail;
 		}
 	}
@@ -1530,6 +1539,271 @@ ssize_t zsock_recvmsg_ctx(struct net_context *ctx, struct msghdr *msg,
 	return -1;
 }
 
+#if defined(CONFIG_NET_SOCKETS_ZEROCOPY)
+/* Check whether the buffers up to the cursor are also used by another
+ * packet, so cannot be detached from the packet or pulled.
+ */
+static bool sock_loan_is_shared(struct net_pkt *pkt)
+{
+	for (struct net_buf *buf = pkt->buffer; buf != NULL; buf = buf->frags) {
+		if (buf->ref > 1) {
+			return true;
+		}
+
+		if (buf == pkt->cursor.buf) {
+			break;
+		}
+	}
+
+	return false;
+}
+
+/* Hand the data from the cursor onwards to the caller and free the rest of
+ * the packet, the headers.
+ */
+static int sock_loan_pkt_data(struct net_pkt *pkt, struct net_buf **frags)
+{
+	struct net_buf *buf;
+
+	if (IS_ENABLED(CONFIG_NET_PKT_RXTIME_STATS) ||
+	    IS_ENABLED(CONFIG_TRACING_NET_CORE)) {
+		net_socket_update_tc_rx_time(pkt, k_cycle_get_32());
+	}
+
+	if (sock_loan_is_shared(pkt)) {
+		struct net_pkt *clone;
+
+		clone = net_pkt_rx_clone(pkt, K_NO_WAIT);
+		net_pkt_unref(pkt);
+
+		if (clone == NULL) {
+			return -ENOBUFS;
+		}
+
+		pkt = clone;
+	}
+
+	buf = pkt->cursor.buf;
+	if (buf != NULL) {
+		if (pkt->buffer == buf) {
+			pkt->buffer = NULL;
+		} else {
+			struct net_buf *prev = pkt->buffer;
+
+			while (prev->frags != buf) {
+				prev = prev->frags;
+			}
+
+			prev->frags = NULL;
+		}
+
+		net_buf_pull(buf, pkt->cursor.pos - buf->data);
+	}
+
+	net_pkt_unref(pkt);
+
+	*frags = buf;
+
+	return 0;
+}
+
+static ssize_t zsock_recv_dgram_loan(struct net_context *ctx,
+				     struct net_buf **frags, int flags,
+				     struct sockaddr *src_addr,
+				     socklen_t *addrlen)
+{
+	k_timeout_t timeout = K_FOREVER;
+	struct net_pkt *pkt;
+	size_t recv_len;
+	int ret;
+
+	if ((flags & ZSOCK_MSG_DONTWAIT) || sock_is_nonblock(ctx)) {
+		timeout = K_NO_WAIT;
+	} else {
+		net_context_get_option(ctx, NET_OPT_RCVTIMEO, &timeout, NULL);
+
+		ret = zsock_wait_data(ctx, &timeout);
+		if (ret < 0) {
+			errno = -ret;
+			return -1;
+		}
+	}
+
+	pkt = k_fifo_get(&ctx->recv_q, timeout);
+	if (!pkt) {
+		errno = EAGAIN;
+		return -1;
+	}
+
+	if (src_addr && addrlen) {
+		ret = sock_get_src_addr(ctx, pkt, src_addr, addrlen);
+		if (ret < 0) {
+			net_pkt_unref(pkt);
+			errno = -ret;
+			return -1;
+		}
+	}
+
+	recv_len = net_pkt_remaining_data(pkt);
+
+	ret = sock_loan_pkt_data(pkt, frags);
+	if (ret < 0) {
+		errno = -ret;
+		return -1;
+	}
+
+	return recv_len;
+}
+
+static ssize_t zsock_recv_stream_loan(struct net_context *ctx,
+				      struct net_buf **frags, int flags)
+{
+	k_timeout_t timeout = K_FOREVER;
+	struct net_pkt *pkt;
+	size_t recv_len;
+	int ret;
+
+	if (!net_context_is_used(ctx)) {
+		errno = EBADF;
+		return -1;
+	}
+
+	if (net_context_get_state(ctx) != NET_CONTEXT_CONNECTED) {
+		errno = ENOTCONN;
+		return -1;
+	}
+
+	if ((flags & ZSOCK_MSG_DONTWAIT) || sock_is_nonblock(ctx)) {
+		timeout = K_NO_WAIT;
+	} else if (!sock_is_eof(ctx) && !sock_is_error(ctx)) {
+		net_context_get_option(ctx, NET_OPT_RCVTIMEO, &timeout, NULL);
+	}
+
+	while (1) {
+		if (sock_is_error(ctx)) {
+			errno = POINTER_TO_INT(ctx->user_data);
+			return -1;
+		}
+
+		if (sock_is_eof(ctx)) {
+			return 0;
+		}
+
+		pkt = k_fifo_get(&ctx->recv_q, K_NO_WAIT);
+		if (pkt != NULL) {
+			if (net_pkt_eof(pkt)) {
+				sock_set_eof(ctx);
+			}
+
+			recv_len = net_pkt_remaining_data(pkt);
+			if (recv_len > 0) {
+				break;
+			}
+
+			net_pkt_unref(pkt);
+			continue;
+		}
+
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			errno = EAGAIN;
+			return -1;
+		}
+
+		ret = zsock_wait_data(ctx, &timeout);
+		if (ret < 0) {
+			errno = -ret;
+			return -1;
+		}
+	}
+
+	/* The data has left the socket queue, open the window for more */
+	net_context_update_recv_wnd(ctx, recv_len);
+
+	ret = sock_loan_pkt_data(pkt, frags);
+	if (ret < 0) {
+		errno = -ret;
+		return -1;
+	}
+
+	return recv_len;
+}
+
+static ssize_t zsock_recv_loan_ctx(struct net_context *ctx,
+				   struct net_buf **frags, int flags,
+				   struct sockaddr *src_addr, socklen_t *addrlen)
+{
+	enum net_sock_type sock_type = net_context_get_type(ctx);
+
+	if (flags & ~ZSOCK_MSG_DONTWAIT) {
+		errno = EOPNOTSUPP;
+		return -1;
+	}
+
+	if (sock_type == SOCK_DGRAM || sock_type == SOCK_RAW) {
+		return zsock_recv_dgram_loan(ctx, frags, flags, src_addr, addrlen);
+	} else if (sock_type == SOCK_STREAM) {
+		return zsock_recv_stream_loan(ctx, frags, flags);
+	}
+
+	__ASSERT(0, "Unknown socket type");
+
+	errno = ENOTSUP;
+
+	return -1;
+}
+
+static ssize_t zsock_send_loan_ctx(struct net_context *ctx,
+				   struct net_buf *frags, int flags,
+				   const struct sockaddr *dest_addr,
+				   socklen_t addrlen)
+{
+	k_timeout_t timeout = K_FOREVER;
+	uint32_t retry_timeout = WAIT_BUFS_INITIAL_MS;
+	k_timepoint_t buf_timeout, end;
+	int status;
+
+	if ((flags & ZSOCK_MSG_DONTWAIT) || sock_is_nonblock(ctx)) {
+		timeout = K_NO_WAIT;
+		buf_timeout = sys_timepoint_calc(K_NO_WAIT);
+	} else {
+		net_context_get_option(ctx, NET_OPT_SNDTIMEO, &timeout, NULL);
+		buf_timeout = sys_timepoint_calc(MAX_WAIT_BUFS);
+	}
+	end = sys_timepoint_calc(timeout);
+
+	/* Register the callback before sending in order to receive the response
+	 * from the peer.
+	 */
+	status = net_context_recv(ctx, zsock_received_cb,
+				  K_NO_WAIT, ctx->user_data);
+	if (status < 0) {
+		errno = -status;
+		return -1;
+	}
+
+	while (1) {
+		status = net_context_send_buf(ctx, frags, dest_addr, addrlen,
+					      NULL, timeout, ctx->user_data);
+		if (status < 0) {
+			status = send_check_and_wait(ctx, status, buf_timeout,
+						     timeout, &retry_timeout);
+			if (status < 0) {
+				return status;
+			}
+
+			/* Update the timeout value in case loop is repeated. */
+			timeout = sys_timepoint_timeout(end);
+
+			continue;
+		}
+
+		break;
+	}
+
+	return status;
+}
+#endif /* CONFIG_NET_SOCKETS_ZEROCOPY */
+
 static int zsock_poll_prepare_ctx(struct net_context *ctx,
 				  struct zsock_pollfd *pfd,
 				  struct k_poll_event **pev,
@@ -1914,6 +2188,20 @@ int zsock_getsockopt_ctx(struct net_context *ctx, int level, int optname,
 				return 0;
 			}
 
+			break;
+
+		case TCP_CONGESTION:
+			if (IS_ENABLED(CONFIG_NET_TCP_CONGESTION_AVOIDANCE)) {
+				ret = net_tcp_get_option(ctx, TCP_OPT_CONGESTION,
+							 optval, optlen);
+				if (ret < 0) {
+					errno = -ret;
+					return -1;
+				}
+
+				return 0;
+			}
+
 			break;
 		}
 
@@ -2545,6 +2833,20 @@ int zsock_setsockopt_ctx(struct net_context *ctx, int level, int optname,
 				return 0;
 			}
 
+			break;
+
+		case TCP_CONGESTION:
+			if (IS_ENABLED(CONFIG_NET_TCP_CONGESTION_AVOIDANCE)) {
+				ret = net_tcp_set_option(ctx, TCP_OPT_CONGESTION,
+							 optval, optlen);
+				if (ret < 0) {
+					errno = -ret;
+					return -1;
+				}
+
+				return 0;
+			}
+
 			break;
 		}
 		break;
@@ -3059,6 +3361,20 @@ static ssize_t sock_recvfrom_vmeth(void *obj, void *buf, size_t max_len,
 				  src_addr, addrlen);
 }
 
+#if defined(CONFIG_NET_SOCKETS_ZEROCOPY)
+static ssize_t sock_recv_loan_vmeth(void *obj, struct net_buf **frags, int flags,
+				    struct sockaddr *src_addr, socklen_t *addrlen)
+{
+	return zsock_recv_loan_ctx(obj, frags, flags, src_addr, addrlen);
+}
+
+static ssize_t sock_send_loan_vmeth(void *obj, struct net_buf *frags, int flags,
+				    const struct sockaddr *dest_addr, socklen_t addrlen)
+{
+	return zsock_send_loan_ctx(obj, frags, flags, dest_addr, addrlen);
+}
+#endif /* CONFIG_NET_SOCKETS_ZEROCOPY */
+
 static int sock_getsockopt_vmeth(void *obj, int level, int optname,
 				 void *optval, socklen_t *optlen)
 {
@@ -3107,6 +3423,10 @@ const struct socket_op_vtable sock_fd_op_vtable = {
 	.setsockopt = sock_setsockopt_vmeth,
 	.getpeername = sock_getpeername_vmeth,
 	.getsockname = sock_getsockname_vmeth,
+#if defined(CONFIG_NET_SOCKETS_ZEROCOPY)
+	.recv_loan = sock_recv_loan_vmeth,
+	.send_loan = sock_send_loan_vmeth,
+#endif
 };
 
 static bool inet_is_supported(int family, int type, int proto)
@@ -19,6 +19,12 @@ static uint8_t sample_packet[sizeof(struct zperf_udp_datagram) +
 			     sizeof(struct zperf_client_hdr_v1) +
 			     PACKET_SIZE_MAX];
 
+/* Per datagram headers of a batch, the payload is shared from sample_packet */
+static uint8_t batch_hdr[CONFIG_NET_ZPERF_UDP_BATCH][sizeof(struct zperf_udp_datagram) +
+						    sizeof(struct zperf_client_hdr_v1)];
+static struct iovec batch_iov[CONFIG_NET_ZPERF_UDP_BATCH][2];
+static struct mmsghdr batch_msg[CONFIG_NET_ZPERF_UDP_BATCH];
+
 #if !defined(CONFIG_ZPERF_SESSION_PER_THREAD)
 static struct zperf_async_upload_context udp_async_upload_ctx;
 #endif /* CONFIG_ZPERF_SESSION_PER_THREAD */
@@ -146,6 +152,83 @@ static inline int zperf_upload_fin(int sock,
 	return 0;
 }
 
+static void udp_fill_header(uint8_t *buf, uint32_t id, uint32_t secs, uint32_t usecs,
+			    int port, uint32_t rate_in_kbps, uint32_t packet_size)
+{
+	struct zperf_udp_datagram *datagram;
+	struct zperf_client_hdr_v1 *hdr;
+
+	datagram = (struct zperf_udp_datagram *)buf;
+
+	datagram->id = htonl(id);
+	datagram->tv_sec = htonl(secs);
+	datagram->tv_usec = htonl(usecs);
+
+	hdr = (struct zperf_client_hdr_v1 *)(buf + sizeof(*datagram));
+	hdr->flags = 0;
+	hdr->num_of_threads = htonl(1);
+	hdr->port = htonl(port);
+	hdr->buffer_len = sizeof(sample_packet) -
+		sizeof(*datagram) - sizeof(*hdr);
+	hdr->bandwidth = htonl(rate_in_kbps);
+	hdr->num_of_bytes = htonl(packet_size);
+}
+
+static int udp_send_one(int sock, uint32_t id, uint32_t secs, uint32_t usecs,
+			int port, uint32_t rate_in_kbps, uint32_t packet_size,
+			const struct zperf_upload_params *param, uint64_t data_offset)
+{
+	size_t header_size =
+		sizeof(struct zperf_udp_datagram) + sizeof(struct zperf_client_hdr_v1);
+	int ret;
+
+	/* Fill the packet header */
+	udp_fill_header(sample_packet, id, secs, usecs, port, rate_in_kbps,
+			packet_size);
+
+	/* Load custom data payload if requested */
+	if (param->data_loader != NULL) {
+		ret = param->data_loader(param->data_loader_ctx, data_offset,
+			sample_packet + header_size, packet_size - header_size);
+		if (ret < 0) {
+			NET_ERR("Failed to load data for offset %llu", data_offset);
+			return ret;
+		}
+	}
+
+	/* Send the packet */
+	ret = zsock_send(sock, sample_packet, packet_size, 0);
+	if (ret < 0) {
+		NET_ERR("Failed to send the packet (%d)", errno);
+		return -errno;
+	}
+
+	return ret;
+}
+
+static int udp_send_batch(int sock, uint32_t first_id, uint32_t secs, uint32_t usecs,
+			  int port, uint32_t rate_in_kbps, uint32_t packet_size)
+{
+	size_t hdr_len = MIN(sizeof(batch_hdr[0]), packet_size);
+
+	for (int i = 0; i < ARRAY_SIZE(batch_msg); i++) {
+		udp_fill_header(batch_hdr[i], first_id + i, secs, usecs, port,
+				rate_in_kbps, packet_size);
+
+		batch_iov[i][0].iov_base = batch_hdr[i];
+		batch_iov[i][0].iov_len = hdr_len;
+		batch_iov[i][1].iov_base = sample_packet + hdr_len;
+		batch_iov[i][1].iov_len = packet_size - hdr_len;
+
+		batch_msg[i].msg_hdr = (struct msghdr){
+			.msg_iov = batch_iov[i],
+			.msg_iovlen = packet_size > hdr_len ? 2 : 1,
+		};
+	}
+
+	return zsock_sendmmsg(sock, batch_msg, ARRAY_SIZE(batch_msg), 0);
+}
+
 static int udp_upload(int sock, int port,
 		      const struct zperf_upload_params *param,
 		      struct zperf_results *results)
@@ -160,6 +243,7 @@ static int udp_upload(int sock, int port,
 	uint32_t delay = packet_duration;
 	uint64_t data_offset = 0U;
 	uint32_t nb_packets = 0U;
+	uint32_t nb_sent = 1U;
 	uint64_t usecs64;
 	int64_t start_time, end_time;
 	int64_t print_time, last_loop_time;
@@ -188,8 +272,6 @@ static int udp_upload(int sock, int port,
 	(void)memset(sample_packet, 'z', sizeof(sample_packet));
 
 	do {
-		struct zperf_udp_datagram *datagram;
-		struct zperf_client_hdr_v1 *hdr;
 		uint32_t secs, usecs;
 		int64_t loop_time;
 		int32_t adjust;
@@ -199,7 +281,7 @@ static int udp_upload(int sock, int port,
 
 		/* Algorithm to maintain a given baud rate */
 		if (last_loop_time != loop_time) {
-			adjust = packet_duration;
+			adjust = packet_duration * nb_sent;
 			adjust -= (int32_t)(loop_time - last_loop_time);
 		} else {
 			/* It's the first iteration so no need for adjustment
@@ -219,41 +301,29 @@ static int udp_upload(int sock, int port,
 		secs = usecs64 / USEC_PER_SEC;
 		usecs = usecs64 % USEC_PER_SEC;
 
-		/* Fill the packet header */
-		datagram = (struct zperf_udp_datagram *)sample_packet;
-
-		datagram->id = htonl(nb_packets);
-		datagram->tv_sec = htonl(secs);
-		datagram->tv_usec = htonl(usecs);
-
-		hdr = (struct zperf_client_hdr_v1 *)(sample_packet +
-						     sizeof(*datagram));
-		hdr->flags = 0;
-		hdr->num_of_threads = htonl(1);
-		hdr->port = htonl(port);
-		hdr->buffer_len = sizeof(sample_packet) -
-			sizeof(*datagram) - sizeof(*hdr);
-		hdr->bandwidth = htonl(rate_in_kbps);
-		hdr->num_of_bytes = htonl(packet_size);
+		if (CONFIG_NET_ZPERF_UDP_BATCH > 1 && delay == 0U &&
+		    param->data_loader == NULL) {
+			/* Catch up on the rate with a batch of packets */
+			ret = udp_send_batch(sock, nb_packets, secs, usecs, port,
+					     rate_in_kbps, packet_size);
+			if (ret < 0) {
+				NET_ERR("Failed to send the packets (%d)", errno);
+				return -errno;
+			}
 
-		/* Load custom data payload if requested */
-		if (param->data_loader != NULL) {
-			ret = param->data_loader(param->data_loader_ctx, data_offset,
-				sample_packet + header_size, packet_size - header_size);
+			nb_sent = ret;
+			nb_packets += ret;
+			data_offset += (uint64_t)ret * (packet_size - header_size);
+		} else {
+			ret = udp_send_one(sock, nb_packets, secs, usecs, port,
+					   rate_in_kbps, packet_size, param, data_offset);
 			if (ret < 0) {
-				NET_ERR("Failed to load data for offset %llu", data_offset);
 				return ret;
 			}
-		}
-		data_offset += packet_size - header_size;
 
-		/* Send the packet */
-		ret = zsock_send(sock, sample_packet, packet_size, 0);
-		if (ret < 0) {
-			NET_ERR("Failed to send the packet (%d)", errno);
-			return -errno;
-		} else {
+			nb_sent = 1U;
 			nb_packets++;
+			data_offset += packet_size - header_size;
 		}
 
 		if (IS_ENABLED(CONFIG_NET_ZPERF_LOG_LEVEL_DBG)) {
@@ -67,11 +67,17 @@ static void shell_tdata_dump(const struct k_thread *cthread, void *user_data)
 	size_t unused;
 	size_t size = thread->stack_info.size;
 	const char *tname;
+	k_ticks_t timeout = 0;
 	int ret;
 	char state_str[32];
 
 	tname = k_thread_name_get(thread);
 
+#ifdef CONFIG_SYS_CLOCK_EXISTS
+	/* The timeout keeps a backend specific deadline, show what is left */
+	timeout = k_thread_timeout_remaining_ticks(thread);
+#endif /* CONFIG_SYS_CLOCK_EXISTS */
+
 	shell_print(sh, "%s%p %-10s",
 		    (thread == k_current_get()) ? "*" : " ",
 		    thread,
@@ -80,7 +86,7 @@ static void shell_tdata_dump(const struct k_thread *cthread, void *user_data)
 	shell_print(sh, "\toptions: 0x%x, priority: %d timeout: %" PRId64,
 		    thread->base.user_options,
 		    thread->base.prio,
-		    (int64_t)thread->base.timeout.dticks);
+		    (int64_t)timeout);
 	shell_print(sh, "\tstate: %s, entry: %p",
 		    k_thread_state_str(thread, state_str, sizeof(state_str)),
 		    thread->entry.pEntry);
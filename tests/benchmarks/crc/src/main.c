@@ -0,0 +1,78 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @brief CRC32 throughput benchmarks
+ *
+ * Report the throughput of crc32_ieee() and crc32_c() for buffers of
+ * increasing size, with the software implementation and CPU instructions
+ * selected by the configuration.
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/sys/crc.h>
+
+#define MAX_LEN    16384
+#define TOTAL_LEN  (256 * 1024)
+
+static uint8_t buf[MAX_LEN];
+static volatile uint32_t sink;
+
+static uint32_t run_ieee(size_t len)
+{
+	return crc32_ieee(buf, len);
+}
+
+static uint32_t run_c(size_t len)
+{
+	return crc32_c(0, buf, len, true, true);
+}
+
+static void crc_perf(const char *name, uint32_t (*run)(size_t len))
+{
+	for (size_t len = 16; len <= MAX_LEN; len *= 4) {
+		size_t rounds = TOTAL_LEN / len;
+		timing_t start, end;
+		uint64_t ns;
+
+		start = timing_counter_get();
+		for (size_t i = 0; i < rounds; i++) {
+			sink = run(len);
+		}
+		end = timing_counter_get();
+
+		ns = timing_cycles_to_ns(timing_cycles_get(&start, &end));
+		zassert_true(ns > 0);
+
+		TC_PRINT("%-10s %5zu bytes: %llu ns per buffer, %llu MB/s\n", name, len,
+			 ns / rounds, (uint64_t)TOTAL_LEN * 1000U / ns);
+	}
+}
+
+ZTEST(crc_perf, test_crc32_ieee)
+{
+	crc_perf("crc32_ieee", run_ieee);
+}
+
+ZTEST(crc_perf, test_crc32_c)
+{
+	crc_perf("crc32_c", run_c);
+}
+
+static void *crc_perf_setup(void)
+{
+	for (size_t i = 0; i < sizeof(buf); i++) {
+		buf[i] = (uint8_t)(i * 131 + 7);
+	}
+
+	timing_init();
+	timing_start();
+
+	return NULL;
+}
+
+ZTEST_SUITE(crc_perf, NULL, crc_perf_setup, NULL, NULL, NULL);
@@ -0,0 +1,139 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @brief Hashmap backend benchmarks
+ *
+ * Time the insertion, lookup and removal of the same set of keys with each
+ * Hashmap backend, and report how much heap each one uses per entry.
+ */
+
+#include <inttypes.h>
+#include <stdlib.h>
+
+#include <zephyr/ztest.h>
+#include <zephyr/sys/hash_map.h>
+
+#define NUM_ENTRIES 2048
+
+/* Spread keys over 64 bits, as addresses or flow identifiers would be */
+#define KEY(_i)      ((uint64_t)(_i) * 0x9e3779b97f4a7c15ULL)
+#define MISS_KEY(_i) (KEY(_i) + 1)
+
+static size_t heap_used;
+
+/* A realloc() based allocator that accounts for the memory it hands out */
+static void *counting_alloc(void *ptr, size_t new_size)
+{
+	uint64_t *hdr = (ptr == NULL) ? NULL : (uint64_t *)ptr - 1;
+	uint64_t *new_hdr;
+
+	if (hdr != NULL) {
+		heap_used -= *hdr;
+	}
+
+	if (new_size == 0) {
+		free(hdr);
+		return NULL;
+	}
+
+	new_hdr = realloc(hdr, sizeof(*hdr) + new_size);
+	if (new_hdr == NULL) {
+		if (hdr != NULL) {
+			heap_used += *hdr;
+		}
+		return NULL;
+	}
+
+	*new_hdr = new_size;
+	heap_used += new_size;
+
+	return new_hdr + 1;
+}
+
+SYS_HASHMAP_SC_DEFINE_STATIC_ADVANCED(sc_map, sys_hash32, counting_alloc,
+				      SYS_HASHMAP_CONFIG(SIZE_MAX,
+							 SYS_HASHMAP_DEFAULT_LOAD_FACTOR));
+SYS_HASHMAP_OA_LP_DEFINE_STATIC_ADVANCED(oa_lp_map, sys_hash32, counting_alloc,
+					 SYS_HASHMAP_CONFIG(SIZE_MAX,
+							    SYS_HASHMAP_DEFAULT_LOAD_FACTOR));
+SYS_HASHMAP_OA_GP_DEFINE_STATIC_ADVANCED(oa_gp_map, sys_hash32, counting_alloc,
+					 SYS_HASHMAP_CONFIG(SIZE_MAX,
+							    SYS_HASHMAP_DEFAULT_LOAD_FACTOR));
+
+static uint64_t ns_per_op(uint32_t start, uint32_t end)
+{
+	return k_cyc_to_ns_floor64(end - start) / NUM_ENTRIES;
+}
+
+static void hash_map_perf(const char *name, struct sys_hashmap *map)
+{
+	uint32_t start;
+	uint64_t value;
+	uint64_t insert_ns, hit_ns, miss_ns, churn_ns, remove_ns;
+	size_t per_entry;
+
+	zassert_true(sys_hashmap_is_empty(map));
+
+	start = k_cycle_get_32();
+	for (size_t i = 0; i < NUM_ENTRIES; ++i) {
+		zassert_equal(1, sys_hashmap_insert(map, KEY(i), i, NULL));
+	}
+	insert_ns = ns_per_op(start, k_cycle_get_32());
+
+	per_entry = heap_used / NUM_ENTRIES;
+
+	start = k_cycle_get_32();
+	for (size_t i = 0; i < NUM_ENTRIES; ++i) {
+		zassert_true(sys_hashmap_get(map, KEY(i), &value));
+	}
+	hit_ns = ns_per_op(start, k_cycle_get_32());
+
+	start = k_cycle_get_32();
+	for (size_t i = 0; i < NUM_ENTRIES; ++i) {
+		zassert_false(sys_hashmap_get(map, MISS_KEY(i), &value));
+	}
+	miss_ns = ns_per_op(start, k_cycle_get_32());
+
+	/* replace half of the entries, one at a time */
+	start = k_cycle_get_32();
+	for (size_t i = 0; i < NUM_ENTRIES / 2; ++i) {
+		zassert_true(sys_hashmap_remove(map, KEY(2 * i), NULL));
+		zassert_equal(1, sys_hashmap_insert(map, MISS_KEY(2 * i), i, NULL));
+	}
+	churn_ns = ns_per_op(start, k_cycle_get_32()) * 2;
+
+	start = k_cycle_get_32();
+	for (size_t i = 0; i < NUM_ENTRIES; ++i) {
+		zassert_true(sys_hashmap_remove(map, (i % 2 == 0) ? MISS_KEY(i) : KEY(i), NULL));
+	}
+	remove_ns = ns_per_op(start, k_cycle_get_32());
+
+	zassert_true(sys_hashmap_is_empty(map));
+	zassert_equal(0, heap_used);
+
+	TC_PRINT("%-6s %d entries: insert %" PRIu64 " ns, get (hit) %" PRIu64 " ns, "
+		 "get (miss) %" PRIu64 " ns, remove + insert %" PRIu64 " ns, remove %" PRIu64
+		 " ns, %zu bytes/entry\n",
+		 name, NUM_ENTRIES, insert_ns, hit_ns, miss_ns, churn_ns, remove_ns, per_entry);
+}
+
+ZTEST(hash_map_perf, test_separate_chaining)
+{
+	hash_map_perf("sc", &sc_map);
+}
+
+ZTEST(hash_map_perf, test_open_addressing_linear_probe)
+{
+	hash_map_perf("oa_lp", &oa_lp_map);
+}
+
+ZTEST(hash_map_perf, test_open_addressing_group_probe)
+{
+	hash_map_perf("oa_gp", &oa_gp_map);
+}
+
+ZTEST_SUITE(hash_map_perf, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,215 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @brief MPMC lockfree queue benchmarks
+ *
+ * Hand the same number of items from N producer threads to M consumer
+ * threads through a lockfree MPMC queue, a k_msgq, a lockfree k_msgq and a
+ * k_fifo, and report the time it takes per item. Producers and consumers
+ * never block, they yield when the queue is full or empty, so that the cost
+ * measured is the one of the queue operations. Run on SMP targets to see the
+ * effect of contention.
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/sys/mpmc_lockfree.h>
+
+#define NUM_ITEMS     8192
+#define QUEUE_SIZE    64
+#define MAX_THREADS   4
+#define STACK_SIZE    (512 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define THREAD_PRIO   K_PRIO_PREEMPT(5)
+
+struct fifo_item {
+	void *fifo_reserved;
+	uint32_t val;
+};
+
+struct queue_ops {
+	const char *name;
+	bool (*put)(uint32_t val);
+	bool (*get)(void);
+};
+
+MPMC_DEFINE(bench_mpmc, uint32_t, QUEUE_SIZE);
+K_MSGQ_DEFINE(bench_msgq, sizeof(uint32_t), QUEUE_SIZE, sizeof(uint32_t));
+K_MSGQ_LOCKFREE_DEFINE(bench_msgq_lf, sizeof(uint32_t), QUEUE_SIZE, sizeof(uint32_t));
+K_FIFO_DEFINE(bench_fifo);
+
+static struct fifo_item fifo_items[NUM_ITEMS];
+
+static struct k_thread threads[2 * MAX_THREADS];
+static K_THREAD_STACK_ARRAY_DEFINE(stacks, 2 * MAX_THREADS, STACK_SIZE);
+
+static atomic_t consumed;
+
+static bool mpmc_put(uint32_t val)
+{
+	return mpmc_push(&bench_mpmc, &val);
+}
+
+static bool mpmc_get(void)
+{
+	uint32_t val;
+
+	return mpmc_pop(&bench_mpmc, &val);
+}
+
+static bool msgq_put(uint32_t val)
+{
+	return k_msgq_put(&bench_msgq, &val, K_NO_WAIT) == 0;
+}
+
+static bool msgq_get(void)
+{
+	uint32_t val;
+
+	return k_msgq_get(&bench_msgq, &val, K_NO_WAIT) == 0;
+}
+
+static bool msgq_lf_put(uint32_t val)
+{
+	return k_msgq_put(&bench_msgq_lf, &val, K_NO_WAIT) == 0;
+}
+
+static bool msgq_lf_get(void)
+{
+	uint32_t val;
+
+	return k_msgq_get(&bench_msgq_lf, &val, K_NO_WAIT) == 0;
+}
+
+static bool fifo_put(uint32_t val)
+{
+	fifo_items[val].val = val;
+	k_fifo_put(&bench_fifo, &fifo_items[val]);
+
+	return true;
+}
+
+static bool fifo_get(void)
+{
+	return k_fifo_get(&bench_fifo, K_NO_WAIT) != NULL;
+}
+
+static const struct queue_ops queues[] = {
+	{ "mpmc", mpmc_put, mpmc_get },
+	{ "msgq", msgq_put, msgq_get },
+	{ "msgq_lockfree", msgq_lf_put, msgq_lf_get },
+	{ "fifo", fifo_put, fifo_get },
+};
+
+static void producer(void *p1, void *p2, void *p3)
+{
+	const struct queue_ops *ops = p1;
+	uint32_t first = (uint32_t)(uintptr_t)p2;
+	uint32_t count = (uint32_t)(uintptr_t)p3;
+
+	for (uint32_t i = first; i < first + count; i++) {
+		while (!ops->put(i)) {
+			k_yield();
+		}
+	}
+}
+
+static void consumer(void *p1, void *p2, void *p3)
+{
+	const struct queue_ops *ops = p1;
+
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (atomic_get(&consumed) < NUM_ITEMS) {
+		if (ops->get()) {
+			atomic_inc(&consumed);
+		} else {
+			k_yield();
+		}
+	}
+}
+
+static void queue_perf(const struct queue_ops *ops, uint32_t n_producers, uint32_t n_consumers)
+{
+	uint32_t per_producer = NUM_ITEMS / n_producers;
+	timing_t start, end;
+	uint64_t ns;
+
+	atomic_set(&consumed, 0);
+
+	start = timing_counter_get();
+
+	for (uint32_t i = 0; i < n_consumers; i++) {
+		k_thread_create(&threads[i], stacks[i], STACK_SIZE, consumer,
+				(void *)ops, NULL, NULL, THREAD_PRIO, 0, K_NO_WAIT);
+	}
+
+	for (uint32_t i = 0; i < n_producers; i++) {
+		k_thread_create(&threads[MAX_THREADS + i], stacks[MAX_THREADS + i], STACK_SIZE,
+				producer, (void *)ops, (void *)(uintptr_t)(i * per_producer),
+				(void *)(uintptr_t)per_producer, THREAD_PRIO, 0, K_NO_WAIT);
+	}
+
+	for (uint32_t i = 0; i < n_producers; i++) {
+		k_thread_join(&threads[MAX_THREADS + i], K_FOREVER);
+	}
+
+	for (uint32_t i = 0; i < n_consumers; i++) {
+		k_thread_join(&threads[i], K_FOREVER);
+	}
+
+	end = timing_counter_get();
+
+	zassert_equal(atomic_get(&consumed), NUM_ITEMS);
+	zassert_false(ops->get(), "%s should be empty", ops->name);
+
+	ns = timing_cycles_to_ns(timing_cycles_get(&start, &end));
+
+	TC_PRINT("%s: %u producer(s), %u consumer(s): %llu ns per item\n", ops->name,
+		 n_producers, n_consumers, ns / NUM_ITEMS);
+}
+
+static void queues_perf(uint32_t n_producers, uint32_t n_consumers)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(queues); i++) {
+		queue_perf(&queues[i], n_producers, n_consumers);
+	}
+}
+
+ZTEST(mpmc_perf, test_1_producer_1_consumer)
+{
+	queues_perf(1, 1);
+}
+
+ZTEST(mpmc_perf, test_1_producer_n_consumers)
+{
+	queues_perf(1, MAX_THREADS);
+}
+
+ZTEST(mpmc_perf, test_n_producers_1_consumer)
+{
+	queues_perf(MAX_THREADS, 1);
+}
+
+ZTEST(mpmc_perf, test_n_producers_n_consumers)
+{
+	queues_perf(2, 2);
+	queues_perf(MAX_THREADS, MAX_THREADS);
+}
+
+static void *mpmc_perf_setup(void)
+{
+	TC_PRINT("%u CPU(s), %d items per run\n", arch_num_cpus(), NUM_ITEMS);
+
+	timing_init();
+	timing_start();
+
+	return NULL;
+}
+
+ZTEST_SUITE(mpmc_perf, NULL, mpmc_perf_setup, NULL, NULL, NULL);
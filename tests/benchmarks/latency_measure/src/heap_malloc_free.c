@@ -10,6 +10,7 @@
 
 #define TEST_COUNT 100
 #define TEST_SIZE 10
+#define TEST_BURST 8
 
 void heap_malloc_free(void)
 {
@@ -76,3 +77,78 @@ void heap_malloc_free(void)
 
 	timing_stop();
 }
+
+/*
+ * Allocate and then release a burst of small blocks, which is the pattern
+ * the per-CPU heap caches are meant to serve without touching the heap.
+ */
+void heap_malloc_free_burst(void)
+{
+	timing_t start;
+	timing_t end;
+	void *blocks[TEST_BURST];
+
+	uint32_t count = 0U;
+	uint32_t sum_malloc = 0U;
+	uint32_t sum_free = 0U;
+
+	bool  failed = false;
+	char  error_string[80];
+	char  description[120];
+	const char *notes = "";
+
+	timing_start();
+
+	while (count != TEST_COUNT) {
+		uint32_t i;
+
+		start = timing_counter_get();
+		for (i = 0; i < TEST_BURST; i++) {
+			blocks[i] = k_malloc(TEST_SIZE);
+			if (blocks[i] == NULL) {
+				break;
+			}
+		}
+		end = timing_counter_get();
+
+		if (i != TEST_BURST) {
+			while (i > 0) {
+				k_free(blocks[--i]);
+			}
+			error_count++;
+			snprintk(error_string, 78,
+				  "alloc burst @ iteration %d", count);
+			notes = error_string;
+			break;
+		}
+		sum_malloc += timing_cycles_get(&start, &end);
+
+		start = timing_counter_get();
+		for (i = 0; i < TEST_BURST; i++) {
+			k_free(blocks[i]);
+		}
+		end = timing_counter_get();
+		sum_free += timing_cycles_get(&start, &end);
+
+		count++;
+	}
+
+	if (count == 0) {
+		failed = true;
+		notes = "Memory heap too small--increase it.";
+	}
+
+	count *= TEST_BURST;
+
+	snprintf(description, sizeof(description),
+		 "%-40s - Average time for burst heap malloc",
+		 "heap.malloc.burst");
+	PRINT_STATS_AVG(description, sum_malloc, count, failed, notes);
+
+	snprintf(description, sizeof(description),
+		 "%-40s - Average time for burst heap free",
+		 "heap.free.burst");
+	PRINT_STATS_AVG(description, sum_free, count, failed, notes);
+
+	timing_stop();
+}
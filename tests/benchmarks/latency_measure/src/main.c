@@ -52,6 +52,7 @@ extern void sema_context_switch(uint32_t num_iterations,
 				uint32_t start_options, uint32_t alt_options);
 extern int thread_ops(uint32_t num_iterations, uint32_t start_options,
 		      uint32_t alt_options);
+extern void thread_pool_spawn_join(uint32_t num_iterations);
 extern int fifo_ops(uint32_t num_iterations, uint32_t options);
 extern int fifo_blocking_ops(uint32_t num_iterations, uint32_t start_options,
 			     uint32_t alt_options);
@@ -67,6 +68,7 @@ extern int stack_ops(uint32_t num_iterations, uint32_t options);
 extern int stack_blocking_ops(uint32_t num_iterations, uint32_t start_options,
 			       uint32_t alt_options);
 extern void heap_malloc_free(void);
+extern void heap_malloc_free_burst(void);
 
 #if (CONFIG_MP_MAX_NUM_CPUS > 1)
 static void busy_thread_entry(void *arg1, void *arg2, void *arg3)
@@ -128,6 +130,10 @@ static void test_thread(void *arg1, void *arg2, void *arg3)
 	thread_ops(CONFIG_BENCHMARK_NUM_ITERATIONS, K_USER, 0);
 #endif
 
+	/* Spawning and joining threads, created or taken from a pool */
+
+	thread_pool_spawn_join(CONFIG_BENCHMARK_NUM_ITERATIONS);
+
 	fifo_ops(CONFIG_BENCHMARK_NUM_ITERATIONS, 0);
 #ifdef CONFIG_USERSPACE
 	fifo_ops(CONFIG_BENCHMARK_NUM_ITERATIONS, K_USER);
@@ -202,6 +208,7 @@ static void test_thread(void *arg1, void *arg2, void *arg3)
 #endif
 
 	heap_malloc_free();
+	heap_malloc_free_burst();
 
 	TC_END_REPORT(error_count);
 }
@@ -0,0 +1,104 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/*
+ * @file measure time for spawning and joining threads
+ *
+ * This file contains the test that measures the time it takes to get a
+ * short-lived kernel thread running its entry point and to join it, both
+ * with a thread created for it and with a thread taken from a thread pool.
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include "utils.h"
+
+#define POOL_STACK_SIZE (512 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+K_THREAD_POOL_DEFINE(bench_pool, 1, POOL_STACK_SIZE);
+
+static void spawn_entry(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	/* Finish measuring the time to spawn the thread */
+
+	timestamp.sample = timing_timestamp_get();
+}
+
+void thread_pool_spawn_join(uint32_t num_iterations)
+{
+	timing_t start, finish;
+	uint64_t create_sum = 0ull;
+	uint64_t create_join_sum = 0ull;
+	uint64_t spawn_sum = 0ull;
+	uint64_t spawn_join_sum = 0ull;
+	char description[120];
+	int priority;
+	k_tid_t tid;
+
+	/* Spawned threads run before the spawning thread resumes */
+
+	priority = k_thread_priority_get(k_current_get()) - 1;
+
+	k_thread_pool_start(&bench_pool, priority);
+
+	timing_start();
+
+	for (uint32_t i = 0; i < num_iterations; i++) {
+		start = timing_timestamp_get();
+		k_thread_create(&alt_thread, alt_stack,
+				K_THREAD_STACK_SIZEOF(alt_stack),
+				spawn_entry, NULL, NULL, NULL,
+				priority, 0, K_NO_WAIT);
+		finish = timestamp.sample;
+		create_sum += timing_cycles_get(&start, &finish);
+
+		start = timing_timestamp_get();
+		k_thread_join(&alt_thread, K_FOREVER);
+		finish = timing_timestamp_get();
+		create_join_sum += timing_cycles_get(&start, &finish);
+
+		start = timing_timestamp_get();
+		tid = k_thread_pool_spawn(&bench_pool, spawn_entry, NULL, NULL, NULL,
+					  priority, K_FOREVER);
+		finish = timestamp.sample;
+		spawn_sum += timing_cycles_get(&start, &finish);
+
+		start = timing_timestamp_get();
+		k_thread_pool_join(&bench_pool, tid, K_FOREVER);
+		finish = timing_timestamp_get();
+		spawn_join_sum += timing_cycles_get(&start, &finish);
+	}
+
+	snprintf(description, sizeof(description),
+		 "%-40s - Create and start a thread",
+		 "thread.create_start.immediate.kernel");
+	PRINT_STATS_AVG(description, (uint32_t)create_sum,
+			num_iterations, false, "");
+
+	snprintf(description, sizeof(description),
+		 "%-40s - Join a created thread",
+		 "thread.join.immediate.kernel");
+	PRINT_STATS_AVG(description, (uint32_t)create_join_sum,
+			num_iterations, false, "");
+
+	snprintf(description, sizeof(description),
+		 "%-40s - Spawn a thread from a pool",
+		 "thread_pool.spawn.immediate.kernel");
+	PRINT_STATS_AVG(description, (uint32_t)spawn_sum,
+			num_iterations, false, "");
+
+	snprintf(description, sizeof(description),
+		 "%-40s - Join a thread back to its pool",
+		 "thread_pool.join.immediate.kernel");
+	PRINT_STATS_AVG(description, (uint32_t)spawn_join_sum,
+			num_iterations, false, "");
+
+	timing_stop();
+}
@@ -0,0 +1,132 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+/**
+ * @brief C library string routine benchmarks
+ *
+ * Time memcpy(), memmove(), memset() and strlen() of the C library selected
+ * by the configuration, for a range of sizes, with buffers aligned the same
+ * way and differently.
+ */
+
+#include <string.h>
+
+#include <zephyr/ztest.h>
+#include <zephyr/timing/timing.h>
+
+#define MAX_LEN    4096
+#define TOTAL_LEN  (128 * 1024)
+
+static const size_t sizes[] = { 8, 16, 64, 256, 1024, MAX_LEN };
+
+/* destination and source offsets from a word-aligned address */
+static const struct {
+	size_t dst;
+	size_t src;
+} alignments[] = {
+	{ 0, 0 },
+	{ 1, 1 },
+	{ 0, 1 },
+	{ 3, 2 },
+};
+
+static uint8_t __aligned(16) src_buf[MAX_LEN + 16];
+static uint8_t __aligned(16) dst_buf[MAX_LEN + 16];
+
+enum op {
+	OP_MEMCPY,
+	OP_MEMMOVE,
+	OP_MEMSET,
+	OP_STRLEN,
+};
+
+static const char *const op_names[] = { "memcpy", "memmove", "memset", "strlen" };
+
+static volatile size_t sink;
+
+static void run(enum op op, uint8_t *dst, const uint8_t *src, size_t len)
+{
+	switch (op) {
+	case OP_MEMCPY:
+		memcpy(dst, src, len);
+		break;
+	case OP_MEMMOVE:
+		/* overlapping, forward */
+		memmove(dst, dst + 1, len);
+		break;
+	case OP_MEMSET:
+		memset(dst, 0x5a, len);
+		break;
+	case OP_STRLEN:
+		sink = strlen((const char *)src);
+		break;
+	}
+}
+
+static void string_perf(enum op op)
+{
+	for (size_t a = 0; a < ARRAY_SIZE(alignments); a++) {
+		uint8_t *dst = &dst_buf[alignments[a].dst];
+		uint8_t *src = &src_buf[alignments[a].src];
+
+		for (size_t i = 0; i < ARRAY_SIZE(sizes); i++) {
+			size_t len = sizes[i];
+			size_t rounds = TOTAL_LEN / len;
+			timing_t start, end;
+			uint64_t ns;
+
+			if (op == OP_STRLEN) {
+				memset(src, 'a', len);
+				src[len - 1] = '\0';
+			}
+
+			start = timing_counter_get();
+			for (size_t r = 0; r < rounds; r++) {
+				run(op, dst, src, len);
+			}
+			end = timing_counter_get();
+
+			ns = timing_cycles_to_ns(timing_cycles_get(&start, &end));
+
+			TC_PRINT("%-7s dst+%zu src+%zu %4zu bytes: %llu ns\n", op_names[op],
+				 alignments[a].dst, alignments[a].src, len, ns / rounds);
+		}
+	}
+}
+
+ZTEST(libc_string, test_memcpy)
+{
+	string_perf(OP_MEMCPY);
+}
+
+ZTEST(libc_string, test_memmove)
+{
+	string_perf(OP_MEMMOVE);
+}
+
+ZTEST(libc_string, test_memset)
+{
+	string_perf(OP_MEMSET);
+}
+
+ZTEST(libc_string, test_strlen)
+{
+	string_perf(OP_STRLEN);
+}
+
+static void *libc_string_setup(void)
+{
+	for (size_t i = 0; i < sizeof(src_buf); i++) {
+		src_buf[i] = (uint8_t)(i * 131 + 7);
+	}
+
+	timing_init();
+	timing_start();
+
+	return NULL;
+}
+
+ZTEST_SUITE(libc_string, NULL, libc_string_setup, NULL, NULL, NULL);
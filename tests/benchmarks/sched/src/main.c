@@ -27,6 +27,12 @@
  * It then iterates this many times, reporting timestamp latencies
  * between each numbered step and for the whole cycle, and a running
  * average for all cycles run.
+ *
+ * On SMP targets a scaling pass runs first: one pair of threads per
+ * CPU bounces a pair of semaphores back and forth for a fixed time,
+ * once with 1 CPU's worth of pairs, then 2, and so on.  The total
+ * number of round trips shows how wakeup/switch throughput scales with
+ * core count (e.g. SCHED_CPU_RUNQ vs. the global ready queue).
  */
 
 #define N_RUNS 1000
@@ -60,6 +66,84 @@ uint32_t stamps[NUM_STAMP_STATES];
 
 static struct k_spinlock lock;
 
+#if (CONFIG_MP_MAX_NUM_CPUS > 1)
+#define SCALE_MS 500
+#define SCALE_STACK_SIZE  (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+struct pingpong {
+	struct k_sem ping;
+	struct k_sem pong;
+	uint32_t round_trips;
+};
+
+static struct pingpong pairs[CONFIG_MP_MAX_NUM_CPUS];
+static struct k_thread ping_thread[CONFIG_MP_MAX_NUM_CPUS];
+static struct k_thread pong_thread[CONFIG_MP_MAX_NUM_CPUS];
+static K_THREAD_STACK_ARRAY_DEFINE(ping_stack, CONFIG_MP_MAX_NUM_CPUS, SCALE_STACK_SIZE);
+static K_THREAD_STACK_ARRAY_DEFINE(pong_stack, CONFIG_MP_MAX_NUM_CPUS, SCALE_STACK_SIZE);
+static volatile bool scale_stop;
+
+static void ping_fn(void *arg1, void *arg2, void *arg3)
+{
+	struct pingpong *pp = arg1;
+
+	ARG_UNUSED(arg2);
+	ARG_UNUSED(arg3);
+
+	while (!scale_stop) {
+		k_sem_give(&pp->ping);
+		k_sem_take(&pp->pong, K_FOREVER);
+		pp->round_trips++;
+	}
+}
+
+static void pong_fn(void *arg1, void *arg2, void *arg3)
+{
+	struct pingpong *pp = arg1;
+
+	ARG_UNUSED(arg2);
+	ARG_UNUSED(arg3);
+
+	while (true) {
+		k_sem_take(&pp->ping, K_FOREVER);
+		k_sem_give(&pp->pong);
+	}
+}
+
+static void run_scaling(int prio)
+{
+	unsigned int num_cpus = arch_num_cpus();
+
+	for (unsigned int n = 1; n <= num_cpus; n++) {
+		uint32_t total = 0U;
+
+		scale_stop = false;
+		for (unsigned int i = 0; i < n; i++) {
+			k_sem_init(&pairs[i].ping, 0, 1);
+			k_sem_init(&pairs[i].pong, 0, 1);
+			pairs[i].round_trips = 0U;
+
+			k_thread_create(&pong_thread[i], pong_stack[i], SCALE_STACK_SIZE,
+					pong_fn, &pairs[i], NULL, NULL, prio, 0, K_NO_WAIT);
+			k_thread_create(&ping_thread[i], ping_stack[i], SCALE_STACK_SIZE,
+					ping_fn, &pairs[i], NULL, NULL, prio, 0, K_NO_WAIT);
+		}
+
+		k_sleep(K_MSEC(SCALE_MS));
+		scale_stop = true;
+
+		for (unsigned int i = 0; i < n; i++) {
+			k_thread_join(&ping_thread[i], K_FOREVER);
+			k_thread_abort(&pong_thread[i]);
+			total += pairs[i].round_trips;
+		}
+
+		printk("cpus %u round trips %u (%u/s)\n", n, total,
+		       (uint32_t)(total * 1000ULL / SCALE_MS));
+	}
+}
+#endif /* (CONFIG_MP_MAX_NUM_CPUS > 1) */
+
 static inline int _stamp(int state)
 {
 	uint32_t t;
@@ -108,6 +192,9 @@ static void busy_thread_entry(void *arg1, void *arg2, void *arg3)
 int main(void)
 {
 #if (CONFIG_MP_MAX_NUM_CPUS > 1)
+	/* Worker pairs run below main so it can always stop them */
+	run_scaling(k_thread_priority_get(k_current_get()) + 1);
+
 	/* Spawn busy threads that will execute on the other cores */
 	for (uint32_t i = 0; i < CONFIG_MP_MAX_NUM_CPUS - 1; i++) {
 		k_thread_create(&busy_thread[i], busy_thread_stack[i],
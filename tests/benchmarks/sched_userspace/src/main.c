@@ -5,6 +5,7 @@
  */
 
 #include <zephyr/kernel.h>
+#include <zephyr/sys/mutex.h>
 #include <zephyr/sys/printk.h>
 
 /* private kernel APIs */
@@ -25,6 +26,11 @@ enum {
 
 uint32_t stamps[NUM_STAMP_STATES];
 
+/* Shared by all threads of the mutex tests */
+K_APPMEM_PARTITION_DEFINE(mutex_partition);
+K_APP_DMEM(mutex_partition) SYS_MUTEX_DEFINE(bench_mutex);
+K_APP_DMEM(mutex_partition) SYS_MUTEX_DEFINE(bench_syscall_mutex);
+
 static inline int stamp(int state)
 {
 	uint32_t t;
@@ -45,13 +51,14 @@ static inline int stamp(int state)
 
 static int yielder_status;
 
-void yielder_entry(void *_thread, void *_tid, void *_nb_threads)
+void yielder_entry(void *_thread, void *_user_entry, void *_nb_threads)
 {
 	struct k_app_thread *thread = (struct k_app_thread *) _thread;
 	int ret;
 
 	struct k_mem_partition *parts[] = {
 		thread->partition,
+		&mutex_partition,
 	};
 
 	ret = k_mem_domain_init(&thread->domain, ARRAY_SIZE(parts), parts);
@@ -63,13 +70,13 @@ void yielder_entry(void *_thread, void *_tid, void *_nb_threads)
 
 	k_mem_domain_add_thread(&thread->domain, k_current_get());
 
-	k_thread_user_mode_enter(context_switch_yield, _nb_threads, NULL, NULL);
+	k_thread_user_mode_enter((k_thread_entry_t)_user_entry, _nb_threads, NULL, NULL);
 }
 
 
 static k_tid_t threads[MAX_NB_THREADS];
 
-static int exec_test(uint8_t nb_threads)
+static int run_threads(k_thread_entry_t user_entry, uint8_t nb_threads)
 {
 	if (nb_threads > MAX_NB_THREADS) {
 		printk("Too many threads\n");
@@ -82,12 +89,11 @@ static int exec_test(uint8_t nb_threads)
 		app_threads[tid].partition = app_partitions[tid];
 		app_threads[tid].stack = &app_thread_stacks[tid];
 
-		void *_tid = (void *)(uintptr_t)tid;
-
 		threads[tid] = k_thread_create(&app_threads[tid].thread,
 					app_thread_stacks[tid],
 					APP_STACKSIZE, yielder_entry,
-					&app_threads[tid], _tid, (void *)(uintptr_t)nb_threads,
+					&app_threads[tid], (void *)user_entry,
+					(void *)(uintptr_t)nb_threads,
 					THREADS_PRIO, 0, K_FOREVER);
 	}
 
@@ -106,6 +112,13 @@ static int exec_test(uint8_t nb_threads)
 	}
 	stamp(MEAS_END);
 
+	return yielder_status;
+}
+
+static int exec_test(uint8_t nb_threads)
+{
+	int ret = run_threads(context_switch_yield, nb_threads);
+
 	uint32_t full_time = stamps[MEAS_END] - stamps[MEAS_START];
 	uint64_t time_ms = k_cyc_to_ns_near64(full_time)/NB_YIELDS;
 
@@ -113,7 +126,22 @@ static int exec_test(uint8_t nb_threads)
 				PRIu64 " ns per ctx\n", nb_threads, full_time,
 				NB_YIELDS, time_ms);
 
-	return yielder_status;
+	return ret;
+}
+
+static int exec_mutex_test(k_thread_entry_t user_entry, const char *name,
+			   uint8_t nb_threads)
+{
+	int ret = run_threads(user_entry, nb_threads);
+
+	uint32_t full_time = stamps[MEAS_END] - stamps[MEAS_START];
+	uint64_t time_ns = k_cyc_to_ns_near64(full_time)/NB_LOCKS;
+
+	printk("%-8s %2u threads: %8" PRIu32 " cyc & %6" PRIu32 " rounds -> %6"
+				PRIu64 " ns per lock/unlock\n", name, nb_threads,
+				full_time, NB_LOCKS, time_ns);
+
+	return ret;
 }
 
 
@@ -136,6 +164,25 @@ int main(void)
 		}
 	}
 
+	size_t nb_mutex_threads_list[] = {1, 2, 8, 0};
+
+	printk("============================\n");
+	printk("user sys_mutex lock/unlock (%s)\n",
+	       IS_ENABLED(CONFIG_SYS_MUTEX_FUTEX) ? "futex" : "syscall");
+
+	for (size_t i = 0; nb_mutex_threads_list[i] > 0; i++) {
+		ret = exec_mutex_test(mutex_lock_unlock, "sys_mutex",
+				      nb_mutex_threads_list[i]);
+		if (ret == 0) {
+			ret = exec_mutex_test(mutex_lock_unlock_syscall, "syscall",
+					      nb_mutex_threads_list[i]);
+		}
+		if (ret != 0) {
+			printk("FAIL\n");
+			return 0;
+		}
+	}
+
 	printk("SUCCESS\n");
 	return 0;
 }
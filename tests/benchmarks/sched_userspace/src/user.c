@@ -19,3 +19,26 @@ void context_switch_yield(void *p1, void *p2, void *p3)
 		k_yield();
 	}
 }
+
+void mutex_lock_unlock(void *p1, void *p2, void *p3)
+{
+	uint32_t nb_threads = (uint32_t)(uintptr_t) p1;
+	uint32_t rounds = NB_LOCKS / nb_threads;
+
+	while (rounds--) {
+		sys_mutex_lock(&bench_mutex, K_FOREVER);
+		sys_mutex_unlock(&bench_mutex);
+	}
+}
+
+/* Always enter the kernel, as sys_mutex does without CONFIG_SYS_MUTEX_FUTEX */
+void mutex_lock_unlock_syscall(void *p1, void *p2, void *p3)
+{
+	uint32_t nb_threads = (uint32_t)(uintptr_t) p1;
+	uint32_t rounds = NB_LOCKS / nb_threads;
+
+	while (rounds--) {
+		z_sys_mutex_kernel_lock(&bench_syscall_mutex, K_FOREVER);
+		z_sys_mutex_kernel_unlock(&bench_syscall_mutex);
+	}
+}
@@ -4,6 +4,14 @@
  * SPDX-License-Identifier: Apache-2.0
  */
 
+#include <zephyr/sys/mutex.h>
+
 #define NB_YIELDS UINT32_C(1000000)
+#define NB_LOCKS UINT32_C(1000000)
+
+extern struct sys_mutex bench_mutex;
+extern struct sys_mutex bench_syscall_mutex;
 
 void context_switch_yield(void *p1, void *p2, void *p3);
+void mutex_lock_unlock(void *p1, void *p2, void *p3);
+void mutex_lock_unlock_syscall(void *p1, void *p2, void *p3);
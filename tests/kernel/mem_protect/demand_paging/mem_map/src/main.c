@@ -113,6 +113,12 @@ static void print_paging_stats(struct k_mem_paging_stats_t *stats, const char *s
 	       stats->eviction.clean);
 	printk("    - Dirty pages evicted: %lu\n",
 	       stats->eviction.dirty);
+
+#ifdef CONFIG_DEMAND_PAGING_READAHEAD
+	printk("* Read ahead (%s):\n", scope);
+	printk("    - Pages read ahead: %lu\n", stats->readahead.pages);
+	printk("    - Hits: %lu\n", stats->readahead.hits);
+#endif
 }
 
 static void touch_anon_pages(bool zig, bool zag)
@@ -163,6 +169,10 @@ static void touch_anon_pages(bool zig, bool zag)
 	print_paging_stats(&stats, "kernel");
 	zassert_not_equal(stats.eviction.dirty, 0UL,
 			  "there should be dirty pages being evicted.");
+#ifdef CONFIG_DEMAND_PAGING_READAHEAD
+	zassert_not_equal(stats.readahead.pages, 0UL,
+			  "sequential accesses should have been read ahead.");
+#endif
 
 #ifdef CONFIG_EVICTION_NRU
 	k_msleep(CONFIG_EVICTION_NRU_PERIOD * 2);
@@ -217,6 +227,94 @@ ZTEST(demand_paging, test_touch_anon_pages_zigzag2)
 	touch_anon_pages(false, true);
 }
 
+#ifdef CONFIG_EVICTION_CLOCK_PRO
+#define HOT_PAGES	4
+
+static size_t scan_page = HOT_PAGES;
+
+static size_t evictable_frames_get(void)
+{
+	struct k_mem_page_frame *pf;
+	uintptr_t phys;
+	size_t count = 0;
+
+	K_MEM_PAGE_FRAME_FOREACH(phys, pf) {
+		if (k_mem_page_frame_is_evictable(pf)) {
+			count++;
+		}
+	}
+
+	return count;
+}
+
+static unsigned long evictions_get(void)
+{
+	struct k_mem_paging_stats_t stats;
+
+	k_mem_paging_stats_get(&stats);
+
+	return stats.eviction.clean + stats.eviction.dirty;
+}
+
+static void touch_hot_pages(void)
+{
+	for (size_t i = 0; i < HOT_PAGES; i++) {
+		(void)*(volatile char *)&arena[i * CONFIG_MMU_PAGE_SIZE];
+	}
+}
+
+/* Read the arena one page at a time, wrapping around past the hot pages */
+static void scan_next_page(void)
+{
+	(void)*(volatile char *)&arena[scan_page * CONFIG_MMU_PAGE_SIZE];
+
+	scan_page++;
+	if (scan_page == (arena_size / CONFIG_MMU_PAGE_SIZE)) {
+		scan_page = HOT_PAGES;
+	}
+}
+#endif /* CONFIG_EVICTION_CLOCK_PRO */
+
+ZTEST(demand_paging, test_touch_anon_pages_scan)
+{
+#ifdef CONFIG_EVICTION_CLOCK_PRO
+	unsigned long faults, evictions;
+	unsigned int key;
+	size_t frames = evictable_frames_get();
+
+	zassert_true(frames > HOT_PAGES, "only %zu evictable page frames", frames);
+
+	/* A clock hand revolution evicts at most one page per evictable
+	 * frame, so this many evictions take the hand at least twice over
+	 * the hot pages while they keep being accessed, promoting them.
+	 */
+	evictions = evictions_get();
+	while ((evictions_get() - evictions) < (3 * frames)) {
+		touch_hot_pages();
+		scan_next_page();
+	}
+
+	/* Each frame not accessed in the meantime yields an eviction over
+	 * two revolutions, and a hot page needs more than that to be
+	 * demoted and evicted. Stay well within that bound while scanning.
+	 */
+	evictions = evictions_get();
+	while ((evictions_get() - evictions) < ((frames - HOT_PAGES) / 4)) {
+		scan_next_page();
+	}
+
+	key = irq_lock();
+	faults = k_mem_num_pagefaults_get();
+	touch_hot_pages();
+	faults = k_mem_num_pagefaults_get() - faults;
+	irq_unlock(key);
+
+	zassert_equal(faults, 0, "%lu hot pages evicted by the scan", faults);
+#else
+	ztest_test_skip();
+#endif /* CONFIG_EVICTION_CLOCK_PRO */
+}
+
 ZTEST(demand_paging, test_unmap_anon_pages)
 {
 	 k_mem_unmap(arena, arena_size);
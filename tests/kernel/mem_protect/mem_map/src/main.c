@@ -7,6 +7,7 @@
 #include <zephyr/ztest.h>
 #include <zephyr/toolchain.h>
 #include <mmu.h>
+#include <kernel_arch_interface.h>
 #include <zephyr/linker/sections.h>
 #include <zephyr/cache.h>
 
@@ -280,6 +281,59 @@ ZTEST(mem_map, test_k_mem_map_phys_bare_unmap_reclaim_addr)
 	zassert_equal(mapped, mapped_old, "Virtual memory region not reclaimed!");
 }
 
+/**
+ * Show that a region mapped with large pages keeps working when it is
+ * split by unmapping part of it.
+ *
+ * @ingroup kernel_memprotect_tests
+ */
+ZTEST(mem_map, test_k_mem_map_phys_bare_large_pages)
+{
+#if defined(CONFIG_X86_MMU_LARGE_PAGES) || defined(CONFIG_ARM64)
+	const size_t large_size = MB(2);
+	uintptr_t test_phys = k_mem_phys_addr(test_page);
+	uintptr_t base = ROUND_DOWN(test_phys, large_size);
+	size_t offset = test_phys - base;
+	uintptr_t phys;
+	uint8_t *mapped;
+
+	expect_fault = false;
+
+	if ((base < K_MEM_PHYS_RAM_START) ||
+	    ((base + large_size) > K_MEM_PHYS_RAM_END)) {
+		ztest_test_skip();
+	}
+
+	k_mem_map_phys_bare(&mapped, base, large_size,
+			    BASE_FLAGS | K_MEM_PERM_RW | K_MEM_LARGE_PAGES);
+
+	zassert_equal(POINTER_TO_UINT(mapped) % large_size, 0,
+		      "large region mapped at unaligned address %p", mapped);
+	zassert_ok(arch_page_phys_get(mapped + offset, &phys));
+	zassert_equal(phys, test_phys, "wrong physical address 0x%lx", phys);
+
+	mapped[offset] = 42;
+	zassert_equal(test_page[0], 42, "large page does not alias test_page");
+
+	/* Unmapping the first page splits the large page */
+	k_mem_unmap_phys_bare(mapped, CONFIG_MMU_PAGE_SIZE);
+
+	if (offset >= CONFIG_MMU_PAGE_SIZE) {
+		mapped[offset] = 43;
+		zassert_equal(test_page[0], 43, "split page does not alias test_page");
+		zassert_ok(arch_page_phys_get(mapped + offset, &phys));
+		zassert_equal(phys, test_phys, "wrong physical address 0x%lx", phys);
+	}
+
+	k_mem_unmap_phys_bare(mapped + CONFIG_MMU_PAGE_SIZE,
+			      large_size - CONFIG_MMU_PAGE_SIZE);
+	zassert_not_ok(arch_page_phys_get(mapped + offset, NULL),
+		       "region still mapped after unmap");
+#else
+	ztest_test_skip();
+#endif
+}
+
 /**
  * Basic k_mem_map() and k_mem_unmap() functionality
  *
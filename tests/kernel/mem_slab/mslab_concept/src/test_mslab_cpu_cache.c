@@ -0,0 +1,59 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/ztest.h>
+#include "test_mslab.h"
+
+#define CACHE_BLK_NUM 16
+
+K_MEM_SLAB_DEFINE_STATIC(mslab_cache, BLK_SIZE, CACHE_BLK_NUM, BLK_ALIGN);
+
+static void check_counts(uint32_t used)
+{
+	zassert_equal(k_mem_slab_num_used_get(&mslab_cache), used,
+		      "used count off with blocks in the CPU caches");
+	zassert_equal(k_mem_slab_num_free_get(&mslab_cache), CACHE_BLK_NUM - used,
+		      "free count off with blocks in the CPU caches");
+}
+
+/**
+ * @brief Verify the block counts while blocks are parked in CPU caches
+ *
+ * @details Blocks pulled into a per-CPU cache by an allocation, or left
+ * there by a free, must be reported as free. Allocate and free all blocks
+ * of a slab one by one and check the used and free counts at every step.
+ *
+ * @ingroup kernel_memory_slab_tests
+ *
+ * @see k_mem_slab_num_used_get()
+ * @see k_mem_slab_num_free_get()
+ */
+ZTEST(mslab_concept, test_mslab_cpu_cache_counts)
+{
+	void *block[CACHE_BLK_NUM];
+
+	check_counts(0);
+
+	for (int i = 0; i < CACHE_BLK_NUM; i++) {
+		zassert_ok(k_mem_slab_alloc(&mslab_cache, &block[i], K_NO_WAIT));
+		check_counts(i + 1);
+	}
+
+	for (int i = 0; i < CACHE_BLK_NUM; i++) {
+		k_mem_slab_free(&mslab_cache, block[i]);
+		check_counts(CACHE_BLK_NUM - i - 1);
+	}
+
+	zassert_ok(k_mem_slab_alloc(&mslab_cache, &block[0], K_NO_WAIT));
+#ifdef CONFIG_MEM_SLAB_CPU_CACHE
+	zassert_true(z_mem_slab_cached(&mslab_cache) > 0U,
+		     "no block parked in the CPU caches");
+#endif /* CONFIG_MEM_SLAB_CPU_CACHE */
+	check_counts(1);
+
+	k_mem_slab_free(&mslab_cache, block[0]);
+	check_counts(0);
+}
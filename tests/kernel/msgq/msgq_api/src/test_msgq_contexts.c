@@ -242,6 +242,18 @@ static void put_full_entry(void *p1, void *p2, void *p3)
 	zassert_equal(ret, 0);
 }
 
+static void get_batch_entry(void *p1, void *p2, void *p3)
+{
+	uint32_t rx_buf[MSGQ_LEN] = { 0 };
+	int ret;
+
+	k_sem_give(&end_sema);
+	/* blocks for the first message only */
+	ret = k_msgq_get_batch(p1, rx_buf, MSGQ_LEN, K_FOREVER);
+	zassert_equal(ret, 1);
+	zassert_equal(rx_buf[0], data[0]);
+}
+
 /**
  * @addtogroup kernel_message_queue_tests
  * @{
@@ -452,6 +464,61 @@ ZTEST(msgq_api_1cpu, test_msgq_full)
 	k_thread_abort(tids[0]);
 }
 
+/**
+ * @brief Put and get several messages per call
+ *
+ * @details
+ * - A batch put or get moves as many messages as fit (or are available)
+ *   and returns that number
+ * - It fails with -ENOMSG only when no message at all can be moved
+ * - A reader blocked in a batch get is handed the first message directly
+ *
+ * @see k_msgq_put_batch(), k_msgq_get_batch()
+ */
+ZTEST(msgq_api_1cpu, test_msgq_batch)
+{
+	int pri = k_thread_priority_get(k_current_get()) - 1;
+	uint32_t rx_buf[MSGQ_LEN + 1];
+	uint32_t tx_buf[MSGQ_LEN + 1] = { MSG0, MSG1, MSG0 };
+	int ret;
+
+	k_msgq_init(&msgq, tbuffer, MSG_SIZE, MSGQ_LEN);
+	ret = k_sem_init(&end_sema, 0, 1);
+	zassert_equal(ret, 0);
+
+	zassert_equal(k_msgq_put_batch(&msgq, tx_buf, 0, K_NO_WAIT), -EINVAL);
+	zassert_equal(k_msgq_get_batch(&msgq, rx_buf, 0, K_NO_WAIT), -EINVAL);
+	zassert_equal(k_msgq_get_batch(&msgq, rx_buf, MSGQ_LEN, K_NO_WAIT), -ENOMSG);
+	zassert_equal(k_msgq_get_batch(&msgq, rx_buf, MSGQ_LEN, TIMEOUT), -EAGAIN);
+
+	/* only MSGQ_LEN of the messages fit */
+	ret = k_msgq_put_batch(&msgq, tx_buf, MSGQ_LEN + 1, K_NO_WAIT);
+	zassert_equal(ret, MSGQ_LEN);
+	zassert_equal(k_msgq_num_free_get(&msgq), 0);
+	zassert_equal(k_msgq_put_batch(&msgq, tx_buf, 1, K_NO_WAIT), -ENOMSG);
+	zassert_equal(k_msgq_put_batch(&msgq, tx_buf, 1, TIMEOUT), -EAGAIN);
+
+	ret = k_msgq_get_batch(&msgq, rx_buf, MSGQ_LEN + 1, K_NO_WAIT);
+	zassert_equal(ret, MSGQ_LEN);
+	zassert_equal(rx_buf[0], MSG0);
+	zassert_equal(rx_buf[1], MSG1);
+	zassert_equal(k_msgq_num_used_get(&msgq), 0);
+
+	/* a pending reader takes the first message, the rest is queued */
+	tids[0] = k_thread_create(&tdata2, tstack2, STACK_SIZE,
+				  get_batch_entry, &msgq, NULL,
+				  NULL, pri, 0, K_NO_WAIT);
+	k_sem_take(&end_sema, K_FOREVER);
+	zassert_equal(tids[0]->base.thread_state, _THREAD_PENDING);
+
+	ret = k_msgq_put_batch(&msgq, data, MSGQ_LEN, K_NO_WAIT);
+	zassert_equal(ret, MSGQ_LEN);
+	zassert_equal(k_msgq_num_used_get(&msgq), MSGQ_LEN - 1);
+
+	k_thread_join(tids[0], K_FOREVER);
+	k_msgq_purge(&msgq);
+}
+
 /**
  * @}
  */
@@ -0,0 +1,202 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include "test_msgq.h"
+
+#ifdef CONFIG_MSGQ_LOCKFREE
+
+#define LF_MSGQ_LEN 4
+
+K_THREAD_STACK_DECLARE(tstack, STACK_SIZE);
+extern struct k_thread tdata;
+extern k_tid_t tids[2];
+
+K_MSGQ_LOCKFREE_DEFINE(lf_msgq, MSG_SIZE, LF_MSGQ_LEN, 4);
+
+static void lf_get_entry(void *p1, void *p2, void *p3)
+{
+	uint32_t rx;
+
+	zassert_equal(k_msgq_get(&lf_msgq, &rx, K_FOREVER), 0);
+	zassert_equal(rx, MSG0);
+}
+
+static void lf_put_entry(void *p1, void *p2, void *p3)
+{
+	uint32_t tx = MSG1;
+
+	zassert_equal(k_msgq_put(&lf_msgq, &tx, SYS_TIMEOUT_MS(POINTER_TO_INT(p1))),
+		      POINTER_TO_INT(p2));
+}
+
+static void lf_spawn(k_thread_entry_t entry, void *p1, void *p2)
+{
+	tids[0] = k_thread_create(&tdata, tstack, STACK_SIZE, entry, p1, p2, NULL,
+				  K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	/* let it block on the queue */
+	k_msleep(TIMEOUT_MS >> 1);
+}
+
+static void lf_fill(void)
+{
+	for (uint32_t i = 0; i < LF_MSGQ_LEN; i++) {
+		zassert_equal(k_msgq_put(&lf_msgq, &i, K_NO_WAIT), 0);
+	}
+}
+
+static void lf_reset(void)
+{
+	k_msgq_purge(&lf_msgq);
+}
+
+/**
+ * @addtogroup kernel_message_queue_tests
+ * @{
+ */
+
+/**
+ * @brief Test the basic operations of a lockfree message queue
+ *
+ * - Messages are read in the order they were written
+ * - Writing to a full queue and reading from an empty one fail without
+ *   waiting, or once the waiting period expired
+ * - The number of messages is reported by the count and attribute APIs
+ * - Writing to the front and peeking are not supported
+ *
+ * @see K_MSGQ_LOCKFREE_DEFINE()
+ */
+ZTEST(msgq_api_1cpu, test_msgq_lockfree)
+{
+	struct k_msgq_attrs attrs;
+	uint32_t msg = MSG0;
+
+	lf_reset();
+
+	zassert_equal(k_msgq_get(&lf_msgq, &msg, K_NO_WAIT), -ENOMSG);
+	zassert_equal(k_msgq_get(&lf_msgq, &msg, TIMEOUT), -EAGAIN);
+
+	lf_fill();
+	zassert_equal(k_msgq_put(&lf_msgq, &msg, K_NO_WAIT), -ENOMSG);
+	zassert_equal(k_msgq_put(&lf_msgq, &msg, TIMEOUT), -EAGAIN);
+
+	zassert_equal(k_msgq_num_used_get(&lf_msgq), LF_MSGQ_LEN);
+	zassert_equal(k_msgq_num_free_get(&lf_msgq), 0);
+	k_msgq_get_attrs(&lf_msgq, &attrs);
+	zassert_equal(attrs.used_msgs, LF_MSGQ_LEN);
+	zassert_equal(attrs.max_msgs, LF_MSGQ_LEN);
+
+	zassert_equal(k_msgq_put_front(&lf_msgq, &msg, K_NO_WAIT), -ENOTSUP);
+	zassert_equal(k_msgq_peek(&lf_msgq, &msg), -ENOTSUP);
+	zassert_equal(k_msgq_peek_at(&lf_msgq, &msg, 0), -ENOTSUP);
+
+	for (uint32_t i = 0; i < LF_MSGQ_LEN; i++) {
+		zassert_equal(k_msgq_get(&lf_msgq, &msg, K_NO_WAIT), 0);
+		zassert_equal(msg, i);
+	}
+	zassert_equal(k_msgq_num_used_get(&lf_msgq), 0);
+}
+
+/**
+ * @brief Test threads waiting on a lockfree message queue
+ *
+ * - A reader blocked on an empty queue gets the next message written
+ * - A writer blocked on a full queue writes once a message is read
+ * - Purging the queue fails a blocked writer
+ *
+ * @see K_MSGQ_LOCKFREE_DEFINE(), k_msgq_purge()
+ */
+ZTEST(msgq_api_1cpu, test_msgq_lockfree_pend)
+{
+	uint32_t msg = MSG0;
+
+	lf_reset();
+
+	lf_spawn(lf_get_entry, NULL, NULL);
+	zassert_equal(k_msgq_put(&lf_msgq, &msg, K_NO_WAIT), 0);
+	k_thread_join(tids[0], K_FOREVER);
+	zassert_equal(k_msgq_num_used_get(&lf_msgq), 0);
+
+	lf_fill();
+	lf_spawn(lf_put_entry, INT_TO_POINTER(SYS_FOREVER_MS), INT_TO_POINTER(0));
+	zassert_equal(k_msgq_get(&lf_msgq, &msg, K_NO_WAIT), 0);
+	k_thread_join(tids[0], K_FOREVER);
+	zassert_equal(k_msgq_num_used_get(&lf_msgq), LF_MSGQ_LEN);
+	for (uint32_t i = 1; i < LF_MSGQ_LEN; i++) {
+		zassert_equal(k_msgq_get(&lf_msgq, &msg, K_NO_WAIT), 0);
+		zassert_equal(msg, i);
+	}
+	zassert_equal(k_msgq_get(&lf_msgq, &msg, K_NO_WAIT), 0);
+	zassert_equal(msg, MSG1);
+
+	lf_fill();
+	lf_spawn(lf_put_entry, INT_TO_POINTER(TIMEOUT_MS), INT_TO_POINTER(-ENOMSG));
+	k_msgq_purge(&lf_msgq);
+	k_thread_join(tids[0], K_FOREVER);
+	zassert_equal(k_msgq_num_used_get(&lf_msgq), 0);
+}
+
+/**
+ * @brief Test batches on a lockfree message queue
+ *
+ * @see K_MSGQ_LOCKFREE_DEFINE(), k_msgq_put_batch(), k_msgq_get_batch()
+ */
+ZTEST(msgq_api_1cpu, test_msgq_lockfree_batch)
+{
+	uint32_t tx_buf[LF_MSGQ_LEN + 2];
+	uint32_t rx_buf[LF_MSGQ_LEN + 2];
+
+	lf_reset();
+
+	for (uint32_t i = 0; i < ARRAY_SIZE(tx_buf); i++) {
+		tx_buf[i] = i;
+	}
+
+	zassert_equal(k_msgq_get_batch(&lf_msgq, rx_buf, LF_MSGQ_LEN, K_NO_WAIT), -ENOMSG);
+	zassert_equal(k_msgq_put_batch(&lf_msgq, tx_buf, ARRAY_SIZE(tx_buf), K_NO_WAIT),
+		      LF_MSGQ_LEN);
+	zassert_equal(k_msgq_put_batch(&lf_msgq, tx_buf, 1, TIMEOUT), -EAGAIN);
+	zassert_equal(k_msgq_get_batch(&lf_msgq, rx_buf, ARRAY_SIZE(rx_buf), K_NO_WAIT),
+		      LF_MSGQ_LEN);
+	zassert_mem_equal(rx_buf, tx_buf, LF_MSGQ_LEN * MSG_SIZE);
+}
+
+#ifdef CONFIG_POLL
+/**
+ * @brief Test polling a lockfree message queue
+ *
+ * @see K_MSGQ_LOCKFREE_DEFINE(), k_poll()
+ */
+ZTEST(msgq_api_1cpu, test_msgq_lockfree_poll)
+{
+	struct k_poll_event event = K_POLL_EVENT_INITIALIZER(K_POLL_TYPE_MSGQ_DATA_AVAILABLE,
+							     K_POLL_MODE_NOTIFY_ONLY,
+							     &lf_msgq);
+	uint32_t msg;
+
+	lf_reset();
+
+	zassert_equal(k_poll(&event, 1, K_NO_WAIT), -EAGAIN);
+
+	/* the writer runs once this thread is polling */
+	tids[0] = k_thread_create(&tdata, tstack, STACK_SIZE, lf_put_entry,
+				  INT_TO_POINTER(SYS_FOREVER_MS), INT_TO_POINTER(0), NULL,
+				  K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	zassert_equal(k_poll(&event, 1, TIMEOUT), 0);
+	zassert_equal(event.state, K_POLL_STATE_MSGQ_DATA_AVAILABLE);
+	k_thread_join(tids[0], K_FOREVER);
+
+	event.state = K_POLL_STATE_NOT_READY;
+	zassert_equal(k_poll(&event, 1, K_NO_WAIT), 0);
+	zassert_equal(k_msgq_get(&lf_msgq, &msg, K_NO_WAIT), 0);
+	zassert_equal(msg, MSG1);
+}
+#endif /* CONFIG_POLL */
+
+/**
+ * @}
+ */
+
+#endif /* CONFIG_MSGQ_LOCKFREE */
@@ -469,6 +469,66 @@ ZTEST(mutex_api_1cpu, test_mutex_timeout_race_during_priority_inversion)
 	k_mutex_unlock(&tmutex);
 }
 
+#ifdef CONFIG_SYNC_ADAPTIVE_SPIN
+/* Hold the mutex for well under the spin budget */
+#define SPIN_HOLD_US (CONFIG_SYNC_ADAPTIVE_SPIN_US / 4)
+
+static atomic_t spin_mutex_held;
+
+static void tThread_mutex_hold_briefly(void *p1, void *p2, void *p3)
+{
+	struct k_mutex *mutex = p1;
+
+	k_mutex_lock(mutex, K_FOREVER);
+	atomic_set(&spin_mutex_held, 1);
+	k_busy_wait(SPIN_HOLD_US);
+	k_mutex_unlock(mutex);
+}
+#endif /* CONFIG_SYNC_ADAPTIVE_SPIN */
+
+/**
+ * @brief Test a contended lock is taken by spinning
+ *
+ * @details A thread on another CPU holds the mutex for a fraction of
+ * @kconfig{CONFIG_SYNC_ADAPTIVE_SPIN_US}. Locking it meanwhile must spin
+ * until it is released instead of pending, and count that spin as a
+ * success.
+ *
+ * @ingroup kernel_mutex_tests
+ *
+ * @see k_mutex_spin_stats_get()
+ */
+ZTEST(mutex_api, test_mutex_adaptive_spin)
+{
+#ifdef CONFIG_SYNC_ADAPTIVE_SPIN
+	struct k_adaptive_spin_stats stats;
+
+	k_mutex_init(&tmutex);
+	atomic_set(&spin_mutex_held, 0);
+
+	k_thread_create(&tdata, tstack, K_THREAD_STACK_SIZEOF(tstack),
+			tThread_mutex_hold_briefly, &tmutex, NULL, NULL,
+			k_thread_priority_get(k_current_get()), 0, K_NO_WAIT);
+
+	/* Keep this CPU busy so the holder runs on the other one */
+	while (atomic_get(&spin_mutex_held) == 0) {
+		arch_spin_relax();
+	}
+
+	zassert_equal(k_mutex_lock(&tmutex, K_FOREVER), 0,
+		      "failed to lock the mutex");
+
+	stats = k_mutex_spin_stats_get(&tmutex);
+	zassert_equal(stats.success, 1U, "spin acquisition not counted");
+	zassert_equal(stats.failure, 0U, "spin gave up before the unlock");
+
+	k_mutex_unlock(&tmutex);
+	k_thread_join(&tdata, K_FOREVER);
+#else
+	ztest_test_skip();
+#endif /* CONFIG_SYNC_ADAPTIVE_SPIN */
+}
+
 static void *mutex_api_tests_setup(void)
 {
 #ifdef CONFIG_USERSPACE
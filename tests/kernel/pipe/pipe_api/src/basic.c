@@ -160,3 +160,52 @@ ZTEST(k_pipe_basic, test_close)
 	zassert_true(k_pipe_read(&pipe, res, 5, K_NO_WAIT) == -EPIPE,
 		"Closed and empty pipe should return -EPIPE");
 }
+
+ZTEST(k_pipe_basic, test_claim_commit)
+{
+	uint8_t buffer[12];
+	uint8_t input[8];
+	uint8_t res[8];
+	uint8_t *area;
+
+	mkrandom(input, sizeof(input));
+	k_pipe_init(&pipe, buffer, sizeof(buffer));
+	zassert_true(k_pipe_write(&pipe, input, sizeof(input), K_NO_WAIT) == sizeof(input),
+		"Failed to write bytes to pipe");
+	zassert_true(k_pipe_read(&pipe, res, sizeof(res), K_NO_WAIT) == sizeof(res),
+		"Failed to read bytes from pipe");
+
+	/* The claimed area stops at the end of the buffer */
+	zassert_true(k_pipe_write_claim(&pipe, &area, sizeof(input), K_NO_WAIT) == 4,
+		"Unexpected size of write claim");
+	zassert_true(area == &buffer[8], "Write claim should point into the pipe buffer");
+	zassert_true(k_pipe_write_claim(&pipe, &area, sizeof(input), K_NO_WAIT) == -EBUSY,
+		"Only one write claim can be outstanding");
+	zassert_true(k_pipe_write(&pipe, input, sizeof(input), K_NO_WAIT) == -EAGAIN,
+		"Writes should wait for the claim to be committed");
+	memcpy(area, input, 4);
+	zassert_true(k_pipe_write_commit(&pipe, 4) == 0, "Failed to commit write claim");
+	zassert_true(k_pipe_write_commit(&pipe, 0) == -EINVAL,
+		"Commit without a claim should fail");
+
+	zassert_true(k_pipe_write_claim(&pipe, &area, sizeof(input), K_NO_WAIT) == 8,
+		"Unexpected size of wrapped write claim");
+	zassert_true(area == buffer, "Write claim should wrap around");
+	memcpy(area, &input[4], 4);
+	zassert_true(k_pipe_write_commit(&pipe, 10) == -EINVAL,
+		"Commit should not exceed the claim");
+	zassert_true(k_pipe_write_commit(&pipe, 4) == 0, "Failed to commit write claim");
+
+	/* Read claims see the data in place, partial commits leave the rest */
+	zassert_true(k_pipe_read_claim(&pipe, &area, sizeof(res), K_NO_WAIT) == 4,
+		"Unexpected size of read claim");
+	zassert_true(memcmp(area, input, 4) == 0, "Unexpected data in read claim");
+	zassert_true(k_pipe_read(&pipe, res, 1, K_NO_WAIT) == -EAGAIN,
+		"Reads should wait for the claim to be committed");
+	zassert_true(k_pipe_read_commit(&pipe, 2) == 0, "Failed to commit read claim");
+	zassert_true(k_pipe_read(&pipe, res, sizeof(res), K_NO_WAIT) == 6,
+		"Failed to read bytes after read claim");
+	zassert_true(memcmp(res, &input[2], 6) == 0, "Unexpected data received from pipe");
+	zassert_true(k_pipe_read_claim(&pipe, &area, sizeof(res), K_MSEC(100)) == -EAGAIN,
+		"Read claim on empty pipe should time out");
+}
@@ -163,3 +163,24 @@ ZTEST(k_pipe_concurrency, test_partial_write)
 		"failed t read from pipe");
 	k_thread_join(tid, K_FOREVER);
 }
+
+ZTEST(k_pipe_concurrency, test_claim_commit_wakes_reader)
+{
+	k_tid_t tid;
+	uint8_t buffer[DUMMY_DATA_SIZE * 2];
+	uint8_t *area;
+
+	k_pipe_init(&pipe, buffer, sizeof(buffer));
+	tid = k_thread_create(&thread, stack, K_THREAD_STACK_SIZEOF(stack),
+		thread_read, &pipe, NULL, NULL, K_PRIO_COOP(0), 0, K_NO_WAIT);
+	k_msleep(partial_wait_time/4);
+
+	zassert_true(k_pipe_write_claim(&pipe, &area, DUMMY_DATA_SIZE, K_NO_WAIT) ==
+		DUMMY_DATA_SIZE, "Failed to claim space in pipe");
+	memset(area, 0, DUMMY_DATA_SIZE);
+	zassert_true(k_pipe_write_commit(&pipe, DUMMY_DATA_SIZE) == 0,
+		"Failed to commit write claim");
+	k_thread_join(tid, K_FOREVER);
+	zassert_true(k_pipe_read_claim(&pipe, &area, DUMMY_DATA_SIZE, K_NO_WAIT) == -EAGAIN,
+		"Reader should have consumed the committed data");
+}
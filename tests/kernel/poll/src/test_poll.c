@@ -876,3 +876,80 @@ ZTEST(poll_api_1cpu, test_poll_zero_events)
 
 	zassert_equal(k_poll(&event, 0, K_MSEC(50)), -EAGAIN);
 }
+
+static void poll_set_raise_entry(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	k_poll_signal_raise(p1, SIGNAL_RESULT);
+}
+
+/**
+ * @brief Test level- and edge-triggered events of a poll set
+ *
+ * @ingroup kernel_poll_tests
+ *
+ * @see k_poll_set_init(), k_poll_set_add(), k_poll_set_wait(),
+ * k_poll_set_remove()
+ */
+ZTEST(poll_api_1cpu, test_poll_set)
+{
+	static struct k_poll_set set;
+	static struct k_sem level_sem;
+	static struct k_poll_signal edge_signal;
+	struct k_poll_event events[2];
+	struct k_poll_event *ready[2];
+
+	k_poll_set_init(&set);
+	k_sem_init(&level_sem, 1, 1);
+	k_poll_signal_init(&edge_signal);
+	k_poll_signal_raise(&edge_signal, SIGNAL_RESULT);
+
+	k_poll_event_init(&events[0], K_POLL_TYPE_SEM_AVAILABLE,
+			  K_POLL_MODE_NOTIFY_ONLY, &level_sem);
+	k_poll_event_init(&events[1], K_POLL_TYPE_SIGNAL,
+			  K_POLL_MODE_NOTIFY_ONLY, &edge_signal);
+
+	zassert_ok(k_poll_set_add(&set, &events[0], 0));
+	zassert_ok(k_poll_set_add(&set, &events[1], K_POLL_SET_EDGE));
+	zassert_equal(k_poll_set_add(&set, &events[1], 0), -EBUSY);
+
+	/* level event is ready when added, the edge event is not */
+	zassert_equal(k_poll_set_wait(&set, ready, 2, K_NO_WAIT), 1);
+	zassert_equal_ptr(ready[0], &events[0]);
+	zassert_equal(events[0].state, K_POLL_STATE_SEM_AVAILABLE);
+
+	/* level event is reported again for as long as it holds */
+	zassert_equal(k_poll_set_wait(&set, ready, 2, K_NO_WAIT), 1);
+	zassert_equal_ptr(ready[0], &events[0]);
+
+	zassert_ok(k_sem_take(&level_sem, K_NO_WAIT));
+	zassert_equal(k_poll_set_wait(&set, ready, 2, K_MSEC(10)), -EAGAIN);
+
+	/* both events fire on a new change */
+	k_sem_give(&level_sem);
+	k_poll_signal_raise(&edge_signal, SIGNAL_RESULT);
+	zassert_equal(k_poll_set_wait(&set, ready, 2, K_NO_WAIT), 2);
+	zassert_equal(events[1].state, K_POLL_STATE_SIGNALED);
+
+	/* edge event is not reported again without a new raise */
+	zassert_ok(k_sem_take(&level_sem, K_NO_WAIT));
+	zassert_equal(k_poll_set_wait(&set, ready, 2, K_NO_WAIT), -EAGAIN);
+
+	/* a waiting thread is woken up by a raise */
+	k_thread_create(&test_thread, test_stack,
+			K_THREAD_STACK_SIZEOF(test_stack),
+			poll_set_raise_entry, &edge_signal, NULL, NULL,
+			K_PRIO_PREEMPT(0), 0, K_MSEC(10));
+	zassert_equal(k_poll_set_wait(&set, ready, 2, K_FOREVER), 1);
+	zassert_equal_ptr(ready[0], &events[1]);
+	k_thread_join(&test_thread, K_FOREVER);
+
+	zassert_ok(k_poll_set_remove(&set, &events[0]));
+	zassert_ok(k_poll_set_remove(&set, &events[1]));
+	zassert_equal(k_poll_set_remove(&set, &events[1]), -EINVAL);
+
+	k_sem_give(&level_sem);
+	zassert_equal(k_poll_set_wait(&set, ready, 2, K_NO_WAIT), -EAGAIN);
+}
@@ -553,3 +553,43 @@ ZTEST(queue_api, test_queue_unique_append)
 	ret = k_queue_unique_append(&queue, (void *)&data[1]);
 	zassert_true(ret, "queue unique append failed");
 }
+
+/**
+ * @brief Verify k_queue_get_multi()
+ *
+ * @ingroup kernel_queue_tests
+ *
+ * @details Get more items than queued, then fewer, and see that they
+ * come out in queue order and that an empty queue gives none.
+ *
+ * @see k_queue_get_multi()
+ */
+ZTEST(queue_api, test_queue_get_multi)
+{
+	void *items[LIST_LEN + 1];
+	size_t n;
+
+	k_queue_init(&queue);
+	for (int i = 0; i < LIST_LEN; i++) {
+		k_queue_append(&queue, (void *)&data[i]);
+	}
+
+	n = k_queue_get_multi(&queue, items, ARRAY_SIZE(items));
+	zassert_equal(n, LIST_LEN, "got %zu items", n);
+	for (int i = 0; i < LIST_LEN; i++) {
+		zassert_equal_ptr(items[i], &data[i], "item %d out of order", i);
+	}
+	zassert_true(k_queue_is_empty(&queue), "queue not emptied");
+
+	for (int i = 0; i < LIST_LEN; i++) {
+		k_queue_append(&queue, (void *)&data[i]);
+	}
+
+	n = k_queue_get_multi(&queue, items, 1);
+	zassert_equal(n, 1, "got %zu items", n);
+	zassert_equal_ptr(items[0], &data[0], "wrong item");
+	zassert_equal_ptr(k_queue_get(&queue, K_NO_WAIT), &data[1], "wrong item left");
+
+	zassert_equal(k_queue_get_multi(&queue, items, ARRAY_SIZE(items)), 0,
+		      "got items from an empty queue");
+}
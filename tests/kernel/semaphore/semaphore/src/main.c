@@ -1150,6 +1150,70 @@ ZTEST(semaphore_1cpu, test_sem_queue_mutual_exclusion)
 	k_thread_join(&sem_tid_2, K_FOREVER);
 }
 
+#ifdef CONFIG_SYNC_ADAPTIVE_SPIN
+/* Give the semaphore well within the spin budget */
+#define SPIN_GIVE_US (CONFIG_SYNC_ADAPTIVE_SPIN_US / 4)
+
+/* 0 until the giver runs, 1 until the taker is about to take, then 2 */
+static atomic_t spin_sem_state;
+
+static void sem_give_briefly(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	atomic_set(&spin_sem_state, 1);
+	while (atomic_get(&spin_sem_state) != 2) {
+		arch_spin_relax();
+	}
+
+	k_busy_wait(SPIN_GIVE_US);
+	k_sem_give((struct k_sem *)p1);
+}
+#endif /* CONFIG_SYNC_ADAPTIVE_SPIN */
+
+/**
+ * @brief Test taking an empty semaphore by spinning
+ *
+ * @details A thread on another CPU gives the semaphore a fraction of
+ * @kconfig{CONFIG_SYNC_ADAPTIVE_SPIN_US} after it is taken. The take must
+ * spin until then instead of pending, and count that spin as a success.
+ *
+ * @ingroup kernel_semaphore_tests
+ *
+ * @see k_sem_spin_stats_get()
+ */
+ZTEST(semaphore, test_sem_adaptive_spin)
+{
+#ifdef CONFIG_SYNC_ADAPTIVE_SPIN
+	struct k_adaptive_spin_stats stats;
+
+	expect_k_sem_init_nomsg(&simple_sem, SEM_INIT_VAL, SEM_MAX_VAL, 0);
+	atomic_set(&spin_sem_state, 0);
+
+	k_thread_create(&sem_tid_1, stack_1, STACK_SIZE,
+			sem_give_briefly, &simple_sem, NULL, NULL,
+			k_thread_priority_get(k_current_get()), 0,
+			K_NO_WAIT);
+
+	/* Keep this CPU busy so the giver runs on the other one */
+	while (atomic_get(&spin_sem_state) == 0) {
+		arch_spin_relax();
+	}
+
+	atomic_set(&spin_sem_state, 2);
+	expect_k_sem_take_nomsg(&simple_sem, K_FOREVER, 0);
+
+	stats = k_sem_spin_stats_get(&simple_sem);
+	zassert_equal(stats.success, 1U, "spin acquisition not counted");
+	zassert_equal(stats.failure, 0U, "spin gave up before the give");
+
+	k_thread_join(&sem_tid_1, K_FOREVER);
+#else
+	ztest_test_skip();
+#endif /* CONFIG_SYNC_ADAPTIVE_SPIN */
+}
+
 #ifdef CONFIG_USERSPACE
 static void thread_sem_give_null(void *p1, void *p2, void *p3)
 {
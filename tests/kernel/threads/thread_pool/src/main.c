@@ -0,0 +1,169 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#define NUM_THREADS 2
+#define STACK_SIZE  (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+
+K_THREAD_POOL_DEFINE(test_pool, NUM_THREADS, STACK_SIZE);
+
+static K_SEM_DEFINE(blocker, 0, NUM_THREADS);
+static atomic_t runs;
+
+static void count_entry(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	*(k_tid_t *)p1 = k_current_get();
+	atomic_inc(&runs);
+}
+
+static void block_entry(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	k_sem_take(&blocker, K_FOREVER);
+	atomic_inc(&runs);
+}
+
+static void *thread_pool_setup(void)
+{
+	k_thread_pool_start(&test_pool, K_LOWEST_APPLICATION_THREAD_PRIO);
+
+	return NULL;
+}
+
+static void thread_pool_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	atomic_clear(&runs);
+	k_sem_reset(&blocker);
+}
+
+ZTEST_SUITE(thread_pool, NULL, thread_pool_setup, thread_pool_before, NULL, NULL);
+
+/**
+ * @brief Test spawning and joining pool threads
+ */
+ZTEST(thread_pool, test_spawn_join)
+{
+	k_tid_t tid, self = NULL;
+
+	for (int i = 0; i < 3 * NUM_THREADS; i++) {
+		tid = k_thread_pool_spawn(&test_pool, count_entry, &self, NULL, NULL,
+					  K_PRIO_PREEMPT(0), K_NO_WAIT);
+		zassert_not_null(tid, "no idle pool thread");
+		zassert_ok(k_thread_pool_join(&test_pool, tid, K_FOREVER));
+		zassert_equal(self, tid, "entry ran on another thread");
+	}
+
+	zassert_equal(atomic_get(&runs), 3 * NUM_THREADS);
+	zassert_equal(k_thread_pool_join(&test_pool, k_current_get(), K_NO_WAIT), -EINVAL);
+}
+
+/**
+ * @brief Test that spawning waits for an idle pool thread
+ */
+ZTEST(thread_pool, test_spawn_exhausted)
+{
+	k_tid_t tids[NUM_THREADS];
+
+	for (int i = 0; i < NUM_THREADS; i++) {
+		tids[i] = k_thread_pool_spawn(&test_pool, block_entry, NULL, NULL, NULL,
+					      K_PRIO_PREEMPT(0), K_NO_WAIT);
+		zassert_not_null(tids[i], "no idle pool thread");
+	}
+
+	zassert_is_null(k_thread_pool_spawn(&test_pool, block_entry, NULL, NULL, NULL,
+					    K_PRIO_PREEMPT(0), K_MSEC(10)),
+			"spawned more threads than the pool has");
+	zassert_equal(k_thread_pool_join(&test_pool, tids[0], K_NO_WAIT), -EBUSY);
+
+	/* A detached thread goes back to the pool once its entry returns */
+	zassert_ok(k_thread_pool_detach(&test_pool, tids[0]));
+	k_sem_give(&blocker);
+	zassert_not_null(k_thread_pool_spawn(&test_pool, count_entry, &tids[0], NULL, NULL,
+					     K_PRIO_PREEMPT(0), K_MSEC(100)),
+			 "detached thread did not go back to the pool");
+
+	k_sem_give(&blocker);
+	zassert_ok(k_thread_pool_join(&test_pool, tids[1], K_FOREVER));
+	zassert_ok(k_thread_pool_join(&test_pool, tids[0], K_FOREVER));
+	zassert_equal(atomic_get(&runs), NUM_THREADS + 1);
+}
+
+/**
+ * @brief Test that a pool thread gets its pool priority back after a job
+ */
+ZTEST(thread_pool, test_priority_restore)
+{
+	k_tid_t tid, self = NULL;
+
+	tid = k_thread_pool_spawn(&test_pool, count_entry, &self, NULL, NULL,
+				  K_PRIO_PREEMPT(0), K_NO_WAIT);
+	zassert_not_null(tid, "no idle pool thread");
+	zassert_ok(k_thread_pool_join(&test_pool, tid, K_FOREVER));
+	zassert_equal(k_thread_priority_get(tid), K_LOWEST_APPLICATION_THREAD_PRIO,
+		      "pool thread kept the priority of its job");
+}
+
+/**
+ * @brief Test that a pool thread is only joined or detached once per spawn
+ */
+ZTEST(thread_pool, test_join_detach_once)
+{
+	k_tid_t tids[NUM_THREADS];
+	k_tid_t tid, self = NULL;
+
+	/* Joined, then joined or detached again */
+	tid = k_thread_pool_spawn(&test_pool, count_entry, &self, NULL, NULL,
+				  K_PRIO_PREEMPT(0), K_NO_WAIT);
+	zassert_not_null(tid, "no idle pool thread");
+	zassert_ok(k_thread_pool_join(&test_pool, tid, K_FOREVER));
+	zassert_equal(k_thread_pool_join(&test_pool, tid, K_NO_WAIT), -EINVAL);
+	zassert_equal(k_thread_pool_detach(&test_pool, tid), -EINVAL);
+
+	/* Detached after returning, then joined or detached again */
+	tid = k_thread_pool_spawn(&test_pool, count_entry, &self, NULL, NULL,
+				  K_PRIO_PREEMPT(0), K_NO_WAIT);
+	zassert_not_null(tid, "no idle pool thread");
+	k_msleep(10);
+	zassert_ok(k_thread_pool_detach(&test_pool, tid));
+	zassert_equal(k_thread_pool_detach(&test_pool, tid), -EINVAL);
+	zassert_equal(k_thread_pool_join(&test_pool, tid, K_NO_WAIT), -EINVAL);
+
+	/* Detached while running, then detached again */
+	tid = k_thread_pool_spawn(&test_pool, block_entry, NULL, NULL, NULL,
+				  K_PRIO_PREEMPT(0), K_NO_WAIT);
+	zassert_not_null(tid, "no idle pool thread");
+	zassert_ok(k_thread_pool_detach(&test_pool, tid));
+	zassert_equal(k_thread_pool_detach(&test_pool, tid), -EINVAL);
+	k_sem_give(&blocker);
+
+	/* No thread was put back twice: the pool still holds NUM_THREADS of them */
+	for (int i = 0; i < NUM_THREADS; i++) {
+		tids[i] = k_thread_pool_spawn(&test_pool, block_entry, NULL, NULL, NULL,
+					      K_PRIO_PREEMPT(0), K_MSEC(100));
+		zassert_not_null(tids[i], "no idle pool thread");
+	}
+	zassert_is_null(k_thread_pool_spawn(&test_pool, block_entry, NULL, NULL, NULL,
+					    K_PRIO_PREEMPT(0), K_MSEC(10)),
+			"a pool thread was put back twice");
+
+	for (int i = 0; i < NUM_THREADS; i++) {
+		k_sem_give(&blocker);
+	}
+	for (int i = 0; i < NUM_THREADS; i++) {
+		zassert_ok(k_thread_pool_join(&test_pool, tids[i], K_FOREVER));
+	}
+	zassert_equal(atomic_get(&runs), 3 + NUM_THREADS);
+}
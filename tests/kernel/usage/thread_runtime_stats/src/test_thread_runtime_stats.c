@@ -547,5 +547,131 @@ ZTEST(usage_api, test_thread_stats_usage)
 	k_thread_abort(tid);
 }
 
+#ifdef CONFIG_SCHED_THREAD_LATENCY_STATS
+#define NUM_LATENCY_WAKEUPS 10
+
+static K_SEM_DEFINE(latency_sem, 0, 1);
+
+static uint32_t latency_sum(const uint32_t *hist)
+{
+	uint32_t sum = 0;
+
+	for (int i = 0; i < CONFIG_SCHED_THREAD_LATENCY_STATS_BUCKETS; i++) {
+		sum += hist[i];
+	}
+
+	return sum;
+}
+
+/**
+ * @brief Helper thread to test_thread_latency_stats()
+ */
+void helper_latency(void *p1, void *p2, void *p3)
+{
+	while (1) {
+		k_sem_take(&latency_sem, K_FOREVER);
+	}
+}
+
+/**
+ * @brief Test the scheduling latency histograms
+ *
+ * A higher priority helper thread is woken up repeatedly. Each wakeup
+ * must be recorded as a wakeup latency of the helper, and as a
+ * preemption delay of the main thread.
+ */
+ZTEST(usage_api, test_thread_latency_stats)
+{
+	k_tid_t  tid;
+	int  priority;
+	k_thread_runtime_stats_t  helper_stats;
+	k_thread_runtime_stats_t  main_stats1;
+	k_thread_runtime_stats_t  main_stats2;
+
+	priority = k_thread_priority_get(_current);
+
+	tid = k_thread_create(&helper_thread, helper_stack,
+			      K_THREAD_STACK_SIZEOF(helper_stack),
+			      helper_latency, NULL, NULL, NULL,
+			      priority - 1, 0, K_NO_WAIT);
+
+	/* The helper has run and is now waiting for the semaphore */
+
+	k_thread_runtime_stats_get(_current, &main_stats1);
+
+	for (int i = 0; i < NUM_LATENCY_WAKEUPS; i++) {
+		k_sem_give(&latency_sem);
+	}
+
+	k_thread_runtime_stats_get(_current, &main_stats2);
+	k_thread_runtime_stats_get(tid, &helper_stats);
+
+	/* One wakeup to start the helper, then one per semaphore give */
+
+	zassert_equal(latency_sum(helper_stats.wakeup_latency),
+		      NUM_LATENCY_WAKEUPS + 1);
+	zassert_equal(latency_sum(helper_stats.preempt_latency), 0);
+
+	zassert_true(latency_sum(main_stats2.preempt_latency) >=
+		     latency_sum(main_stats1.preempt_latency) + NUM_LATENCY_WAKEUPS);
+
+	k_thread_abort(tid);
+}
+
+/**
+ * @brief Helper thread to test_thread_latency_suspended()
+ */
+void helper_latency_spin(void *p1, void *p2, void *p3)
+{
+	while (1) {
+	}
+}
+
+/**
+ * @brief Test the latency of a thread suspended while preempted
+ *
+ * A lower priority helper thread is preempted, then suspended and resumed
+ * before it gets to run again. Its next wait must be counted from the
+ * resume as a wakeup, not from the preemption.
+ */
+ZTEST(usage_api, test_thread_latency_suspended)
+{
+	k_tid_t  tid;
+	int  priority;
+	k_thread_runtime_stats_t  helper_stats;
+
+	priority = k_thread_priority_get(_current);
+
+	tid = k_thread_create(&helper_thread, helper_stack,
+			      K_THREAD_STACK_SIZEOF(helper_stack),
+			      helper_latency_spin, NULL, NULL, NULL,
+			      priority + 1, 0, K_NO_WAIT);
+
+	/* Let the helper run, it is preempted when this thread wakes up */
+
+	k_sleep(K_TICKS(2));
+
+	k_thread_suspend(tid);
+	k_thread_resume(tid);
+
+	k_sleep(K_TICKS(2));
+
+	k_thread_runtime_stats_get(tid, &helper_stats);
+
+	zassert_equal(latency_sum(helper_stats.wakeup_latency), 2);
+	zassert_equal(latency_sum(helper_stats.preempt_latency), 0);
+
+	k_thread_abort(tid);
+}
+#else
+ZTEST(usage_api, test_thread_latency_stats)
+{
+}
+
+ZTEST(usage_api, test_thread_latency_suspended)
+{
+}
+#endif
+
 ZTEST_SUITE(usage_api, NULL, NULL,
 		ztest_simple_1cpu_before, ztest_simple_1cpu_after, NULL);
@@ -1457,6 +1457,87 @@ ZTEST(work_1cpu, test_1cpu_system_reschedule)
 		     "long %u > %u\n", elapsed_ms, max_ms);
 }
 
+#if defined(CONFIG_WORKQUEUE_WORKERS)
+#define NUM_WORKERS 3
+
+static K_THREAD_STACK_DEFINE(workers_main_stack, STACK_SIZE);
+static K_THREAD_STACK_ARRAY_DEFINE(workers_stacks, NUM_WORKERS - 1, STACK_SIZE);
+static struct k_work_q_worker workers[NUM_WORKERS - 1];
+static struct k_work_q workers_queue;
+static struct k_work workers_items[NUM_WORKERS];
+static atomic_t workers_running[NUM_WORKERS];
+static atomic_t workers_overlap;
+static atomic_t workers_runs;
+
+static void workers_handler(struct k_work *work)
+{
+	atomic_t *running = &workers_running[work - workers_items];
+
+	if (atomic_inc(running) != 0) {
+		atomic_inc(&workers_overlap);
+	}
+	k_busy_wait(1000);
+	atomic_dec(running);
+	atomic_inc(&workers_runs);
+}
+
+/* Several threads serve one queue without running an item twice at once,
+ * and flush, drain and stop wait for all of them.
+ */
+ZTEST(work, test_workers)
+{
+	struct k_work_queue_config cfg = {
+		.name = "wq.workers",
+	};
+	int rc;
+
+	k_work_queue_init(&workers_queue);
+	k_work_queue_start(&workers_queue, workers_main_stack, STACK_SIZE,
+			   PREEMPT_PRIORITY, &cfg);
+
+	for (int i = 0; i < ARRAY_SIZE(workers); i++) {
+		rc = k_work_queue_add_worker(&workers_queue, &workers[i],
+					     workers_stacks[i],
+					     K_THREAD_STACK_SIZEOF(workers_stacks[i]),
+					     PREEMPT_PRIORITY, -1);
+		zassert_equal(rc, 0);
+	}
+
+	for (int i = 0; i < ARRAY_SIZE(workers_items); i++) {
+		k_work_init(&workers_items[i], workers_handler);
+	}
+
+	/* Keep resubmitting so items get queued again while they run. */
+	for (int round = 0; round < 10; round++) {
+		for (int i = 0; i < ARRAY_SIZE(workers_items); i++) {
+			rc = k_work_submit_to_queue(&workers_queue, &workers_items[i]);
+			zassert_true(rc >= 0);
+		}
+		k_msleep(1);
+	}
+
+	/* Flush returns only once the item is idle. */
+	rc = k_work_submit_to_queue(&workers_queue, &workers_items[0]);
+	zassert_true(rc >= 0);
+	(void)k_work_flush(&workers_items[0], &work_sync);
+	zassert_equal(k_work_busy_get(&workers_items[0]), 0);
+
+	/* Drain waits for every worker to go idle. */
+	rc = k_work_queue_drain(&workers_queue, true);
+	zassert_true(rc >= 0);
+	for (int i = 0; i < ARRAY_SIZE(workers_items); i++) {
+		zassert_equal(k_work_busy_get(&workers_items[i]), 0);
+	}
+
+	zassert_equal(atomic_get(&workers_overlap), 0);
+	zassert_true(atomic_get(&workers_runs) >= ARRAY_SIZE(workers_items));
+
+	rc = k_work_queue_stop(&workers_queue, K_FOREVER);
+	zassert_equal(rc, 0);
+	zassert_equal(workers_queue.flags, 0);
+}
+#endif /* defined(CONFIG_WORKQUEUE_WORKERS) */
+
 ZTEST(work, test_nop)
 {
 	ztest_test_skip();
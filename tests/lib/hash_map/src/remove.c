@@ -37,3 +37,31 @@ ZTEST(hash_map, test_remove_false)
 	zassert_equal(1, sys_hashmap_insert(&map, 1, 1, NULL));
 	zassert_false(sys_hashmap_remove(&map, 42, NULL));
 }
+
+ZTEST(hash_map, test_remove_interleaved)
+{
+	uint64_t value;
+
+	for (size_t i = 0; i < MANY; ++i) {
+		zassert_equal(1, sys_hashmap_insert(&map, i, i, NULL));
+	}
+
+	/* removing entries must not hide the entries placed after them */
+	for (size_t i = 0; i < MANY; i += 2) {
+		zassert_true(sys_hashmap_remove(&map, i, NULL));
+	}
+
+	for (size_t i = 0; i < MANY; ++i) {
+		zassert_equal(i % 2 != 0, sys_hashmap_get(&map, i, &value));
+		if (i % 2 != 0) {
+			zassert_equal(i, value);
+		}
+	}
+
+	/* and the removed entries can be inserted again */
+	for (size_t i = 0; i < MANY; i += 2) {
+		zassert_equal(1, sys_hashmap_insert(&map, i, i, NULL));
+	}
+
+	zassert_equal(MANY, sys_hashmap_size(&map));
+}
@@ -1859,6 +1859,100 @@ ZTEST(lib_json_test, test_json_key_not_in_descr)
 	zassert_equal(ret, 0, "No items should be decoded");
 }
 
+ZTEST(lib_json_test, test_json_key_order)
+{
+	struct test_struct ts = { 0 };
+	char encoded[] = "{\"some_int64\":-64,\"unknown\":[1,{\"a\":2}],"
+			 "\"some_int16\":-16,\"some_bool\":true,\"some_int\":42,"
+			 "\"some_uint64\":64}";
+	int64_t ret;
+
+	ret = json_obj_parse(encoded, sizeof(encoded) - 1, test_descr,
+			     ARRAY_SIZE(test_descr), &ts);
+	zassert_equal(ret, BIT64(2) | BIT64(3) | BIT64(4) | BIT64(5) | BIT64(7),
+		      "Fields in any order should be decoded");
+	zassert_equal(ts.some_int, 42);
+	zassert_true(ts.some_bool);
+	zassert_equal(ts.some_int16, -16);
+	zassert_equal(ts.some_int64, -64);
+	zassert_equal(ts.some_uint64, 64);
+}
+
+ZTEST(lib_json_test, test_json_long_string_indented)
+{
+	struct test_struct ts = { 0 };
+	char encoded[] = "{\n"
+			 "                \"some_string\":"
+			 " \"a long string with \\\"escaped quotes\\\" and \\\\ backslashes\",\n"
+			 "                \"some_int\":    1234\n"
+			 "}";
+	int64_t ret;
+
+	ret = json_obj_parse(encoded, sizeof(encoded) - 1, test_descr,
+			     ARRAY_SIZE(test_descr), &ts);
+	zassert_equal(ret, BIT64(0) | BIT64(2), "Both fields should be decoded");
+	zassert_str_equal(ts.some_string,
+			  "a long string with \\\"escaped quotes\\\" and \\\\ backslashes");
+	zassert_equal(ts.some_int, 1234);
+}
+
+ZTEST(lib_json_test, test_json_obj_stream)
+{
+	const char encoded[] = "  {\"some_string\":\"with } and \\\" inside\","
+			       "\"some_nested_struct\":{\"nested_int\":-1234},"
+			       "\"some_array\":[1,2,3],\"some_int\":42} trailing";
+	size_t obj_len = strlen(encoded) - strlen(" trailing");
+	struct json_obj_stream stream;
+	struct test_struct ts;
+	char buf[128];
+	int64_t ret;
+
+	/* One byte at a time */
+	memset(&ts, 0, sizeof(ts));
+	json_obj_stream_init(&stream, buf, sizeof(buf), test_descr, ARRAY_SIZE(test_descr),
+			     &ts);
+	for (size_t i = 0; i < obj_len - 1; i++) {
+		zassert_equal(json_obj_stream_feed(&stream, &encoded[i], 1), -EAGAIN,
+			      "Object should not be complete at %zu", i);
+	}
+	ret = json_obj_stream_feed(&stream, &encoded[obj_len - 1], 1);
+	zassert_equal(ret, BIT64(0) | BIT64(2) | BIT64(9) | BIT64(10));
+	zassert_str_equal(ts.some_string, "with } and \\\" inside");
+	zassert_equal(ts.some_nested_struct.nested_int, -1234);
+	zassert_equal(ts.some_array_len, 3);
+	zassert_equal(ts.some_int, 42);
+	zassert_equal(json_obj_stream_feed(&stream, "{}", 2), -EALREADY);
+
+	/* Uneven chunks, the last one with trailing data */
+	memset(&ts, 0, sizeof(ts));
+	json_obj_stream_init(&stream, buf, sizeof(buf), test_descr, ARRAY_SIZE(test_descr),
+			     &ts);
+	zassert_equal(json_obj_stream_feed(&stream, encoded, 17), -EAGAIN);
+	zassert_equal(json_obj_stream_feed(&stream, &encoded[17], 40), -EAGAIN);
+	ret = json_obj_stream_feed(&stream, &encoded[57], sizeof(encoded) - 1 - 57);
+	zassert_equal(ret, BIT64(0) | BIT64(2) | BIT64(9) | BIT64(10));
+	zassert_equal(ts.some_int, 42);
+
+	/* Object larger than the buffer, numbers are dropped once decoded */
+	zassert_true(obj_len > 96);
+	memset(&ts, 0, sizeof(ts));
+	json_obj_stream_init(&stream, buf, 96, test_descr, ARRAY_SIZE(test_descr), &ts);
+	ret = json_obj_stream_feed(&stream, encoded, sizeof(encoded) - 1);
+	zassert_equal(ret, BIT64(0) | BIT64(2) | BIT64(9) | BIT64(10));
+	zassert_str_equal(ts.some_string, "with } and \\\" inside");
+	zassert_equal(ts.some_nested_struct.nested_int, -1234);
+	zassert_equal(ts.some_int, 42);
+
+	/* Member larger than the buffer */
+	json_obj_stream_init(&stream, buf, 16, test_descr, ARRAY_SIZE(test_descr), &ts);
+	zassert_equal(json_obj_stream_feed(&stream, encoded, sizeof(encoded) - 1), -ENOMEM);
+
+	/* Not an object */
+	json_obj_stream_init(&stream, buf, sizeof(buf), test_descr, ARRAY_SIZE(test_descr),
+			     &ts);
+	zassert_equal(json_obj_stream_feed(&stream, " [1]", 4), -EINVAL);
+}
+
 ZTEST(lib_json_test, test_json_escape)
 {
 	char buf[42];
@@ -0,0 +1,230 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <limits.h>
+
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+#include <zephyr/timing/timing.h>
+#include <zephyr/sys/mpmc_lockfree.h>
+
+/*
+ * @brief Push until full and pop until empty, several times around the ring
+ *
+ * @see mpmc_push(), mpmc_pop()
+ *
+ * @ingroup tests
+ */
+ZTEST(mpmc, test_push_pop_wrap_around)
+{
+	MPMC_DEFINE(ezmpmc, uint32_t, 4);
+
+	uint32_t val;
+
+	zassert_equal(mpmc_size(&ezmpmc), 4, "Size should be 4");
+
+	for (uint32_t i = 0; i < 10; i++) {
+		zassert_false(mpmc_pop(&ezmpmc, &val), "Pop should fail");
+
+		for (uint32_t j = 0; j < 4; j++) {
+			val = i * 4 + j;
+			zassert_true(mpmc_push(&ezmpmc, &val), "Push should succeed");
+		}
+
+		zassert_false(mpmc_push(&ezmpmc, &val), "Push should fail");
+		zassert_equal(mpmc_count(&ezmpmc), 4, "Count should be 4");
+
+		for (uint32_t j = 0; j < 4; j++) {
+			zassert_true(mpmc_pop(&ezmpmc, &val), "Pop should succeed");
+			zassert_equal(val, i * 4 + j, "Pop value should equal i*4+j");
+		}
+
+		zassert_equal(mpmc_count(&ezmpmc), 0, "Count should be 0");
+	}
+}
+
+/**
+ * @brief Ensure that integer wraps of the positions continue to work.
+ */
+ZTEST(mpmc, test_int_wrap_around)
+{
+	static atomic_t seq[4];
+	static uint32_t buf[4];
+	struct mpmc q;
+	uint32_t val;
+
+	mpmc_init(&q, seq, buf, sizeof(buf[0]), ARRAY_SIZE(buf));
+
+	/* move the queue to the lap where positions wrap, keeping it empty */
+	for (unsigned long i = 0; i < ARRAY_SIZE(seq); i++) {
+		unsigned long pos = ULONG_MAX - 2 + i;
+
+		atomic_set(&seq[pos & 3], (atomic_val_t)(pos - (pos & 3)));
+	}
+	atomic_set(&q.head, (atomic_val_t)(ULONG_MAX - 2));
+	atomic_set(&q.tail, (atomic_val_t)(ULONG_MAX - 2));
+
+	for (uint32_t i = 0; i < 10; i++) {
+		for (uint32_t j = 0; j < 3; j++) {
+			val = j;
+			zassert_true(mpmc_push(&q, &val), "Push should succeed");
+		}
+		for (uint32_t j = 0; j < 3; j++) {
+			zassert_true(mpmc_pop(&q, &val), "Pop should succeed");
+			zassert_equal(val, j, "Pop value should equal j");
+		}
+		zassert_false(mpmc_pop(&q, &val), "Pop should fail");
+	}
+}
+
+/**
+ * @brief Drop elements and count with a stale tail
+ *
+ * @see mpmc_pop(), mpmc_count()
+ */
+ZTEST(mpmc, test_drop_and_count)
+{
+	MPMC_DEFINE(dropmpmc, uint32_t, 4);
+
+	uint32_t val;
+
+	for (uint32_t i = 0; i < 3; i++) {
+		val = i;
+		zassert_true(mpmc_push(&dropmpmc, &val), "Push should succeed");
+	}
+
+	zassert_true(mpmc_pop(&dropmpmc, NULL), "Drop should succeed");
+	zassert_true(mpmc_pop(&dropmpmc, &val), "Pop should succeed");
+	zassert_equal(val, 1, "Dropped element should be gone");
+	zassert_equal(mpmc_count(&dropmpmc), 1, "Count should be 1");
+
+	/* As seen by a reader whose tail snapshot predates a full lap */
+	atomic_set(&dropmpmc.head, atomic_get(&dropmpmc.head) + 4);
+	zassert_equal(mpmc_count(&dropmpmc), 4, "Count should be clamped to the size");
+}
+
+#define MPMC_SZ 8
+#define MPMC_ITERATIONS 100000
+#define MPMC_STACK_SIZE (512 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define MPMC_PRODUCERS 2
+#define MPMC_CONSUMERS 2
+
+static struct k_thread mpmc_thread[MPMC_PRODUCERS + MPMC_CONSUMERS];
+static K_THREAD_STACK_ARRAY_DEFINE(mpmc_stack, MPMC_PRODUCERS + MPMC_CONSUMERS,
+				   MPMC_STACK_SIZE);
+
+MPMC_DEFINE(mpmc_q, uint32_t, MPMC_SZ);
+
+static uint64_t mpmc_sum[MPMC_CONSUMERS];
+
+static void mpmc_consumer(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	uint32_t id = (uint32_t)(uintptr_t)p1;
+	uint32_t last[MPMC_PRODUCERS] = { 0 };
+	uint32_t val;
+
+	for (int i = 0; i < MPMC_ITERATIONS * MPMC_PRODUCERS / MPMC_CONSUMERS; i++) {
+		while (!mpmc_pop(&mpmc_q, &val)) {
+			k_yield();
+		}
+
+		/* values of a producer are seen in order by any consumer */
+		zassert_true(val / MPMC_ITERATIONS < MPMC_PRODUCERS, "Invalid value %u", val);
+		zassert_true(val % MPMC_ITERATIONS + 1 > last[val / MPMC_ITERATIONS],
+			     "Value %u out of order", val);
+		last[val / MPMC_ITERATIONS] = val % MPMC_ITERATIONS + 1;
+
+		mpmc_sum[id] += val;
+	}
+}
+
+static void mpmc_producer(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	uint32_t id = (uint32_t)(uintptr_t)p1;
+	uint32_t val;
+
+	for (int i = 0; i < MPMC_ITERATIONS; i++) {
+		val = id * MPMC_ITERATIONS + i;
+		while (!mpmc_push(&mpmc_q, &val)) {
+			k_yield();
+		}
+	}
+}
+
+/**
+ * @brief Test that producers and consumers are indeed thread safe
+ *
+ * This can and should be validated on SMP machines where incoherent
+ * memory could cause issues.
+ */
+ZTEST(mpmc, test_mpmc_threaded)
+{
+	uint64_t n = (uint64_t)MPMC_ITERATIONS * MPMC_PRODUCERS;
+	uint64_t sum = 0;
+
+	for (int i = 0; i < MPMC_CONSUMERS; i++) {
+		mpmc_sum[i] = 0;
+		k_thread_create(&mpmc_thread[i], mpmc_stack[i], MPMC_STACK_SIZE,
+				mpmc_consumer, (void *)(uintptr_t)i, NULL, NULL,
+				K_PRIO_PREEMPT(5), K_INHERIT_PERMS, K_NO_WAIT);
+	}
+
+	for (int i = 0; i < MPMC_PRODUCERS; i++) {
+		k_thread_create(&mpmc_thread[MPMC_CONSUMERS + i], mpmc_stack[MPMC_CONSUMERS + i],
+				MPMC_STACK_SIZE, mpmc_producer, (void *)(uintptr_t)i, NULL, NULL,
+				K_PRIO_PREEMPT(5), K_INHERIT_PERMS, K_NO_WAIT);
+	}
+
+	for (int i = 0; i < ARRAY_SIZE(mpmc_thread); i++) {
+		k_thread_join(&mpmc_thread[i], K_FOREVER);
+	}
+
+	for (int i = 0; i < MPMC_CONSUMERS; i++) {
+		sum += mpmc_sum[i];
+	}
+
+	zassert_equal(sum, n * (n - 1) / 2, "Every value should be consumed once");
+	zassert_equal(mpmc_count(&mpmc_q), 0, "Queue should be empty");
+}
+
+#define THROUGHPUT_ITERS 100000
+
+ZTEST(mpmc, test_mpmc_throughput)
+{
+	uint32_t val = 0;
+	timing_t start_time, end_time;
+
+	timing_init();
+	timing_start();
+
+	start_time = timing_counter_get();
+
+	int key = irq_lock();
+
+	for (int i = 0; i < THROUGHPUT_ITERS; i++) {
+		mpmc_push(&mpmc_q, &val);
+
+		mpmc_pop(&mpmc_q, &val);
+	}
+
+	irq_unlock(key);
+
+	end_time = timing_counter_get();
+
+	uint64_t cycles = timing_cycles_get(&start_time, &end_time);
+	uint64_t ns = timing_cycles_to_ns(cycles);
+
+	TC_PRINT("%llu ns for %d iterations, %llu ns per op\n", ns,
+		 THROUGHPUT_ITERS, ns/THROUGHPUT_ITERS);
+}
+
+ZTEST_SUITE(mpmc, NULL, NULL, NULL, NULL, NULL);
@@ -77,6 +77,7 @@ static void var_destroy_aligned_small(struct net_buf *buf);
 
 NET_BUF_POOL_HEAP_DEFINE(bufs_pool, 10, USER_DATA_HEAP, buf_destroy);
 NET_BUF_POOL_FIXED_DEFINE(fixed_pool, 10, FIXED_BUFFER_SIZE, USER_DATA_FIXED, fixed_destroy);
+NET_BUF_POOL_FIXED_DEFINE(batch_pool, 8, FIXED_BUFFER_SIZE, USER_DATA_FIXED, NULL);
 NET_BUF_POOL_VAR_DEFINE(var_pool, 10, 1024, USER_DATA_VAR, var_destroy);
 
 /* Two pools, one with aligned to 8 bytes and one with aligned to 4 bytes
@@ -542,6 +543,98 @@ ZTEST(net_buf_tests, test_net_buf_fixed_pool)
 	zassert_equal(destroy_called, 1, "Incorrect destroy callback count");
 }
 
+ZTEST(net_buf_tests, test_net_buf_alloc_batch)
+{
+	struct net_buf *bufs[12];
+	struct net_buf *frag;
+	size_t count;
+
+	destroy_called = 0;
+
+	count = net_buf_alloc_batch(&fixed_pool, 20, bufs, 4, K_NO_WAIT);
+	zassert_equal(count, 4, "Failed to get buffers");
+
+	for (size_t i = 0; i < count; i++) {
+		zassert_not_null(bufs[i], "Invalid buffer");
+		zassert_equal(bufs[i]->size, FIXED_BUFFER_SIZE, "Invalid fixed buffer size");
+		zassert_equal(bufs[i]->len, 0, "Invalid fixed buffer length");
+		zassert_equal(bufs[i]->ref, 1, "Invalid buffer reference count");
+		zassert_is_null(bufs[i]->frags, "Invalid buffer fragments");
+
+		for (size_t j = 0; j < i; j++) {
+			zassert_not_equal(bufs[i], bufs[j], "Buffer allocated twice");
+		}
+	}
+
+	net_buf_unref_batch(bufs, count);
+	zassert_equal(destroy_called, 4, "Incorrect destroy callback count");
+
+	/* Asking for more buffers than the pool holds gives all of them */
+	destroy_called = 0;
+
+	count = net_buf_alloc_batch(&fixed_pool, 20, bufs, ARRAY_SIZE(bufs), K_NO_WAIT);
+	zassert_equal(count, fixed_pool.buf_count, "Incorrect number of buffers");
+	zassert_is_null(net_buf_alloc_len(&fixed_pool, 20, K_NO_WAIT), "Pool not empty");
+
+	/* Fragment chains are released as with net_buf_unref() */
+	net_buf_frag_add(bufs[0], bufs[1]);
+	frag = net_buf_ref(bufs[2]);
+	net_buf_frag_add(bufs[0], frag);
+	bufs[1] = bufs[count - 1];
+	bufs[2] = bufs[count - 2];
+
+	net_buf_unref_batch(bufs, count - 2);
+	zassert_equal(destroy_called, count - 1, "Incorrect destroy callback count");
+	zassert_equal(frag->ref, 1, "Invalid fragment reference count");
+
+	net_buf_unref(frag);
+	zassert_equal(destroy_called, count, "Incorrect destroy callback count");
+
+	count = net_buf_alloc_batch(&fixed_pool, 20, bufs, ARRAY_SIZE(bufs), K_NO_WAIT);
+	zassert_equal(count, fixed_pool.buf_count, "Buffers not returned to the pool");
+	net_buf_unref_batch(bufs, count);
+}
+
+/* Without a destroy callback, batches go back to the pool as one list */
+ZTEST(net_buf_tests, test_net_buf_alloc_batch_no_destroy)
+{
+	struct net_buf *bufs[8];
+	struct net_buf *again[8];
+	size_t count;
+
+	count = net_buf_alloc_batch(&batch_pool, 20, bufs, 3, K_NO_WAIT);
+	zassert_equal(count, 3, "Failed to get buffers");
+	net_buf_unref_batch(bufs, count);
+
+	count = net_buf_alloc_batch(&batch_pool, 20, bufs, ARRAY_SIZE(bufs), K_NO_WAIT);
+	zassert_equal(count, batch_pool.buf_count, "Freed buffers not reused");
+	net_buf_unref_batch(bufs, count);
+
+	count = net_buf_alloc_batch(&batch_pool, 20, again, ARRAY_SIZE(again), K_NO_WAIT);
+	zassert_equal(count, batch_pool.buf_count, "Buffers not returned to the pool");
+	zassert_is_null(net_buf_alloc_len(&batch_pool, 20, K_NO_WAIT), "Pool not empty");
+
+	for (size_t i = 0; i < count; i++) {
+		bool found = false;
+
+		zassert_equal(again[i]->size, FIXED_BUFFER_SIZE, "Invalid fixed buffer size");
+		zassert_equal(again[i]->len, 0, "Invalid fixed buffer length");
+		zassert_equal(again[i]->ref, 1, "Invalid buffer reference count");
+		zassert_is_null(again[i]->frags, "Invalid buffer fragments");
+
+		for (size_t j = 0; j < count; j++) {
+			found = found || (again[i] == bufs[j]);
+		}
+		zassert_true(found, "Buffer not from the previous batch");
+
+		for (size_t j = 0; j < i; j++) {
+			zassert_not_equal(again[i], again[j], "Buffer allocated twice");
+		}
+	}
+
+	net_buf_unref_batch(again, count);
+}
+
 ZTEST(net_buf_tests, test_net_buf_var_pool)
 {
 	struct net_buf *buf1, *buf2, *buf3;
@@ -0,0 +1,342 @@
+/*
+ * Copyright The Zephyr Project Contributors
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ */
+
+#include <errno.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/net/socket.h>
+#include <zephyr/ztest.h>
+#include <zephyr/zvfs/epoll.h>
+#include <zephyr/zvfs/eventfd.h>
+
+#define TIMEOUT_MS 100
+#define STACK_SIZE (1024 + CONFIG_TEST_EXTRA_STACK_SIZE)
+#define MAX_EVENTS 4
+
+int zvfs_close(int fd);
+
+static struct k_thread writer_thread;
+K_THREAD_STACK_DEFINE(writer_stack, STACK_SIZE);
+
+static int epfd = -1;
+static int efd = -1;
+static int sock = -1;
+static struct sockaddr_in sock_addr;
+
+static void fd_close(int *fd)
+{
+	if (*fd >= 0) {
+		zassert_ok(zvfs_close(*fd));
+		*fd = -1;
+	}
+}
+
+static void epoll_add(int fd, uint32_t events)
+{
+	struct zvfs_epoll_event ev = {
+		.events = events,
+		.data.fd = fd,
+	};
+
+	zassert_ok(zvfs_epoll_ctl(epfd, ZVFS_EPOLL_CTL_ADD, fd, &ev));
+}
+
+static void expect_events(int timeout_ms, int fd, uint32_t events)
+{
+	struct zvfs_epoll_event ev[MAX_EVENTS];
+
+	zassert_equal(zvfs_epoll_wait(epfd, ev, ARRAY_SIZE(ev), timeout_ms), 1);
+	zassert_equal(ev[0].data.fd, fd);
+	zassert_equal(ev[0].events, events);
+}
+
+static void expect_none(int timeout_ms)
+{
+	struct zvfs_epoll_event ev[MAX_EVENTS];
+
+	zassert_equal(zvfs_epoll_wait(epfd, ev, ARRAY_SIZE(ev), timeout_ms), 0);
+}
+
+static void expect_errno(int ret, int err)
+{
+	zassert_equal(ret, -1);
+	zassert_equal(errno, err, "errno %d instead of %d", errno, err);
+}
+
+static void efd_write(void)
+{
+	zassert_ok(zvfs_eventfd_write(efd, 1));
+}
+
+static void efd_read(void)
+{
+	zvfs_eventfd_t value;
+
+	zassert_ok(zvfs_eventfd_read(efd, &value));
+}
+
+static void sock_send(void)
+{
+	static const char msg[] = "epoll";
+
+	zassert_equal(zsock_sendto(sock, msg, sizeof(msg), 0, (struct sockaddr *)&sock_addr,
+				   sizeof(sock_addr)),
+		      sizeof(msg));
+}
+
+static void writer_entry(void *p1, void *p2, void *p3)
+{
+	k_msleep(TIMEOUT_MS >> 1);
+	efd_write();
+}
+
+/**
+ * @brief Test creating and destroying ZVFS epoll instances
+ *
+ * @see zvfs_epoll_create()
+ */
+ZTEST(zvfs_epoll, test_epoll_create)
+{
+	struct zvfs_epoll_event ev = {.events = ZVFS_EPOLLIN};
+	int fds[CONFIG_ZVFS_EPOLL_MAX];
+	int fd;
+
+	expect_errno(zvfs_epoll_create(1), EINVAL);
+
+	/* all instances are in use */
+	for (int i = 1; i < ARRAY_SIZE(fds); i++) {
+		fds[i] = zvfs_epoll_create(0);
+		zassert_true(fds[i] >= 0);
+	}
+	expect_errno(zvfs_epoll_create(0), ENOMEM);
+	for (int i = 1; i < ARRAY_SIZE(fds); i++) {
+		fd_close(&fds[i]);
+	}
+
+	/* an instance is freed when its descriptor is closed */
+	fd = epfd;
+	fd_close(&epfd);
+	expect_errno(zvfs_epoll_ctl(fd, ZVFS_EPOLL_CTL_ADD, efd, &ev), EBADF);
+	epfd = zvfs_epoll_create(0);
+	zassert_true(epfd >= 0);
+
+	/* an epoll descriptor is not an eventfd, nor the other way around */
+	expect_errno(zvfs_epoll_ctl(efd, ZVFS_EPOLL_CTL_ADD, sock, &ev), EBADF);
+	expect_errno(zvfs_epoll_wait(efd, &ev, 1, 0), EBADF);
+}
+
+/**
+ * @brief Test adding, modifying and removing an eventfd
+ *
+ * @see zvfs_epoll_ctl()
+ */
+ZTEST(zvfs_epoll, test_epoll_ctl_eventfd)
+{
+	struct zvfs_epoll_event ev = {.events = ZVFS_EPOLLIN};
+
+	expect_errno(zvfs_epoll_ctl(epfd, ZVFS_EPOLL_CTL_ADD, -1, &ev), EBADF);
+	expect_errno(zvfs_epoll_ctl(epfd, ZVFS_EPOLL_CTL_ADD, epfd, &ev), EINVAL);
+	expect_errno(zvfs_epoll_ctl(epfd, ZVFS_EPOLL_CTL_ADD, efd, NULL), EINVAL);
+	expect_errno(zvfs_epoll_ctl(epfd, ZVFS_EPOLL_CTL_MOD, efd, &ev), ENOENT);
+	expect_errno(zvfs_epoll_ctl(epfd, ZVFS_EPOLL_CTL_DEL, efd, NULL), ENOENT);
+
+	epoll_add(efd, ZVFS_EPOLLIN);
+	expect_errno(zvfs_epoll_ctl(epfd, ZVFS_EPOLL_CTL_ADD, efd, &ev), EEXIST);
+	expect_errno(zvfs_epoll_ctl(epfd, 0, efd, &ev), EINVAL);
+	expect_none(0);
+
+	efd_write();
+	expect_events(0, efd, ZVFS_EPOLLIN);
+
+	ev.events = ZVFS_EPOLLOUT;
+	ev.data.u32 = 42;
+	zassert_ok(zvfs_epoll_ctl(epfd, ZVFS_EPOLL_CTL_MOD, efd, &ev));
+	zassert_equal(zvfs_epoll_wait(epfd, &ev, 1, 0), 1);
+	zassert_equal(ev.events, ZVFS_EPOLLOUT);
+	zassert_equal(ev.data.u32, 42);
+
+	zassert_ok(zvfs_epoll_ctl(epfd, ZVFS_EPOLL_CTL_DEL, efd, NULL));
+	expect_none(0);
+	expect_errno(zvfs_epoll_ctl(epfd, ZVFS_EPOLL_CTL_DEL, efd, NULL), ENOENT);
+}
+
+/**
+ * @brief Test adding, modifying and removing a socket
+ *
+ * @see zvfs_epoll_ctl()
+ */
+ZTEST(zvfs_epoll, test_epoll_ctl_socket)
+{
+	struct zvfs_epoll_event ev = {.events = ZVFS_EPOLLIN};
+	char buf[16];
+	int fd;
+
+	epoll_add(sock, ZVFS_EPOLLIN);
+	expect_none(0);
+
+	sock_send();
+	expect_events(TIMEOUT_MS, sock, ZVFS_EPOLLIN);
+	/* level-triggered: reported until read */
+	expect_events(0, sock, ZVFS_EPOLLIN);
+	zassert_true(zsock_recv(sock, buf, sizeof(buf), 0) > 0);
+	expect_none(0);
+
+	/* a UDP socket is always writable */
+	ev.events = ZVFS_EPOLLOUT;
+	ev.data.fd = sock;
+	zassert_ok(zvfs_epoll_ctl(epfd, ZVFS_EPOLL_CTL_MOD, sock, &ev));
+	expect_events(0, sock, ZVFS_EPOLLOUT);
+	expect_events(0, sock, ZVFS_EPOLLOUT);
+
+	zassert_ok(zvfs_epoll_ctl(epfd, ZVFS_EPOLL_CTL_DEL, sock, NULL));
+	expect_none(0);
+
+	/* the instance holds CONFIG_ZVFS_EPOLL_FD_MAX descriptors */
+	epoll_add(sock, ZVFS_EPOLLIN);
+	epoll_add(efd, ZVFS_EPOLLIN);
+	fd = zsock_socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+	zassert_true(fd >= 0);
+	expect_errno(zvfs_epoll_ctl(epfd, ZVFS_EPOLL_CTL_ADD, fd, &ev), ENOSPC);
+	fd_close(&fd);
+}
+
+/**
+ * @brief Test waiting without timeout, with a timeout and forever
+ *
+ * @see zvfs_epoll_wait()
+ */
+ZTEST(zvfs_epoll, test_epoll_wait)
+{
+	struct zvfs_epoll_event ev[MAX_EVENTS];
+	int64_t start;
+	char buf[16];
+
+	expect_errno(zvfs_epoll_wait(epfd, NULL, 1, 0), EINVAL);
+	expect_errno(zvfs_epoll_wait(epfd, ev, 0, 0), EINVAL);
+
+	epoll_add(efd, ZVFS_EPOLLIN);
+	epoll_add(sock, ZVFS_EPOLLIN);
+
+	start = k_uptime_get();
+	expect_none(0);
+	expect_none(TIMEOUT_MS);
+	zassert_true(k_uptime_get() - start >= TIMEOUT_MS);
+
+	/* woken up by another thread */
+	k_thread_create(&writer_thread, writer_stack, STACK_SIZE, writer_entry, NULL, NULL, NULL,
+			K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	expect_events(SYS_FOREVER_MS, efd, ZVFS_EPOLLIN);
+	k_thread_join(&writer_thread, K_FOREVER);
+
+	k_thread_create(&writer_thread, writer_stack, STACK_SIZE, writer_entry, NULL, NULL, NULL,
+			K_PRIO_PREEMPT(0), 0, K_NO_WAIT);
+	efd_read();
+	expect_events(TIMEOUT_MS, efd, ZVFS_EPOLLIN);
+	k_thread_join(&writer_thread, K_FOREVER);
+
+	/* both descriptors are reported, but no more than asked for */
+	sock_send();
+	zassert_true(zsock_recv(sock, buf, sizeof(buf), ZSOCK_MSG_PEEK) > 0);
+	zassert_equal(zvfs_epoll_wait(epfd, ev, ARRAY_SIZE(ev), 0), 2);
+	zassert_equal(zvfs_epoll_wait(epfd, ev, 1, 0), 1);
+	zassert_equal(zvfs_epoll_wait(epfd, ev, ARRAY_SIZE(ev), 0), 2);
+}
+
+/**
+ * @brief Test edge-triggered entries
+ *
+ * Entries are only reported once per change of state. Note that
+ * EPOLLONESHOT is not supported.
+ *
+ * @see ZVFS_EPOLLET
+ */
+ZTEST(zvfs_epoll, test_epoll_edge_triggered)
+{
+	struct zvfs_epoll_event ev = {.events = ZVFS_EPOLLIN | ZVFS_EPOLLET, .data.fd = efd};
+
+	epoll_add(efd, ZVFS_EPOLLIN | ZVFS_EPOLLET);
+	expect_none(0);
+
+	efd_write();
+	expect_events(0, efd, ZVFS_EPOLLIN);
+	expect_none(0);
+
+	/* writing again makes a new edge, even though it was not read */
+	efd_write();
+	expect_events(TIMEOUT_MS, efd, ZVFS_EPOLLIN);
+	expect_none(TIMEOUT_MS);
+
+	/* modifying the entry reports the current state again */
+	zassert_ok(zvfs_epoll_ctl(epfd, ZVFS_EPOLL_CTL_MOD, efd, &ev));
+	expect_events(0, efd, ZVFS_EPOLLIN);
+	expect_none(0);
+
+	efd_read();
+	expect_none(0);
+	efd_write();
+	expect_events(0, efd, ZVFS_EPOLLIN);
+}
+
+/**
+ * @brief Test closing a descriptor that is still registered
+ *
+ * @see zvfs_epoll_ctl()
+ */
+ZTEST(zvfs_epoll, test_epoll_close_registered)
+{
+	int fd = efd;
+
+	epoll_add(efd, ZVFS_EPOLLIN);
+	epoll_add(sock, ZVFS_EPOLLIN);
+	efd_write();
+
+	fd_close(&efd);
+	expect_none(0);
+	expect_errno(zvfs_epoll_ctl(epfd, ZVFS_EPOLL_CTL_DEL, fd, NULL), ENOENT);
+
+	fd_close(&sock);
+	expect_none(0);
+
+	/* the freed entries can be used again */
+	efd = zvfs_eventfd(0, ZVFS_EFD_NONBLOCK);
+	zassert_true(efd >= 0);
+	epoll_add(efd, ZVFS_EPOLLIN);
+	efd_write();
+	expect_events(0, efd, ZVFS_EPOLLIN);
+}
+
+static void zvfs_epoll_before(void *fixture)
+{
+	socklen_t len = sizeof(sock_addr);
+
+	ARG_UNUSED(fixture);
+
+	epfd = zvfs_epoll_create(0);
+	zassert_true(epfd >= 0);
+
+	efd = zvfs_eventfd(0, ZVFS_EFD_NONBLOCK);
+	zassert_true(efd >= 0);
+
+	sock = zsock_socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+	zassert_true(sock >= 0);
+
+	sock_addr.sin_family = AF_INET;
+	sock_addr.sin_port = 0;
+	zassert_equal(zsock_inet_pton(AF_INET, "127.0.0.1", &sock_addr.sin_addr), 1);
+	zassert_ok(zsock_bind(sock, (struct sockaddr *)&sock_addr, sizeof(sock_addr)));
+	zassert_ok(zsock_getsockname(sock, (struct sockaddr *)&sock_addr, &len));
+}
+
+static void zvfs_epoll_after(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	fd_close(&sock);
+	fd_close(&efd);
+	fd_close(&epfd);
+}
+
+ZTEST_SUITE(zvfs_epoll, NULL, NULL, zvfs_epoll_before, zvfs_epoll_after, NULL);
@@ -402,6 +402,8 @@ void test_send_recv_large_common(int tcp_nodelay, int family)
 	ssize_t total_send = 0;
 	int iteration = 0;
 	uint8_t buffer[256];
+	int64_t start_time = k_uptime_get();
+	int64_t duration;
 
 	while (total_send < TEST_LARGE_TRANSFER_SIZE) {
 		/* Fill the buffer with a known pattern */
@@ -431,6 +433,10 @@ void test_send_recv_large_common(int tcp_nodelay, int family)
 	zassert_equal(k_thread_join(&tcp_server_thread_data, K_SECONDS(60)), 0,
 			"Not successfully wait for TCP thread to finish");
 
+	duration = MAX(k_uptime_delta(&start_time), 1);
+	TC_PRINT("Goodput: %d bytes in %lld ms, %lld kbps\n", TEST_LARGE_TRANSFER_SIZE,
+		 duration, (int64_t)TEST_LARGE_TRANSFER_SIZE * 8 / duration);
+
 	test_close(s_sock);
 	test_close(c_sock);
 
@@ -1422,6 +1428,69 @@ ZTEST(net_socket_tcp, test_so_rcvbuf_win_size)
 	test_context_cleanup();
 }
 
+ZTEST(net_socket_tcp, test_recv_loan_win_size)
+{
+#if defined(CONFIG_NET_SOCKETS_ZEROCOPY)
+	int rv;
+	ssize_t len;
+	int c_sock;
+	int s_sock;
+	int new_sock;
+	struct sockaddr_in c_saddr;
+	struct sockaddr_in s_saddr;
+	struct sockaddr addr;
+	socklen_t addrlen = sizeof(addr);
+	char tx_buf[] = TEST_STR_SMALL;
+	int buf_optval = sizeof(TEST_STR_SMALL);
+	struct net_buf *frags;
+
+	prepare_sock_tcp_v4(MY_IPV4_ADDR, ANY_PORT, &c_sock, &c_saddr);
+	prepare_sock_tcp_v4(MY_IPV4_ADDR, SERVER_PORT, &s_sock, &s_saddr);
+
+	test_bind(s_sock, (struct sockaddr *)&s_saddr, sizeof(s_saddr));
+	test_listen(s_sock);
+
+	test_connect(c_sock, (struct sockaddr *)&s_saddr, sizeof(s_saddr));
+
+	test_accept(s_sock, &new_sock, &addr, &addrlen);
+	zassert_equal(addrlen, sizeof(struct sockaddr_in), "wrong addrlen");
+
+	/* Lower server-side RX window size. */
+	rv = zsock_setsockopt(new_sock, SOL_SOCKET, SO_RCVBUF, &buf_optval,
+			      sizeof(buf_optval));
+	zassert_equal(rv, 0, "setsockopt failed (%d)", errno);
+
+	rv = zsock_send(c_sock, tx_buf, sizeof(tx_buf), ZSOCK_MSG_DONTWAIT);
+	zassert_equal(rv, sizeof(tx_buf), "Unexpected return code %d", rv);
+
+	/* Wait for the ACK closing the window to reach the client */
+	k_msleep(150);
+
+	rv = zsock_send(c_sock, tx_buf, 1, ZSOCK_MSG_DONTWAIT);
+	zassert_equal(rv, -1, "Unexpected return code %d", rv);
+	zassert_equal(errno, EAGAIN, "Unexpected errno value: %d", errno);
+
+	/* Taking the data out on loan must reopen the window */
+	len = zsock_recv_loan(new_sock, &frags, 0, NULL, NULL);
+	zassert_equal(len, sizeof(tx_buf), "recv_loan failed (%d)", errno);
+	zassert_mem_equal(frags->data, tx_buf, frags->len, "invalid loaned data");
+	zsock_loan_release(frags);
+
+	k_msleep(150);
+
+	rv = zsock_send(c_sock, tx_buf, 1, ZSOCK_MSG_DONTWAIT);
+	zassert_equal(rv, 1, "window not reopened (%d)", errno);
+
+	test_close(c_sock);
+	test_close(new_sock);
+	test_close(s_sock);
+
+	test_context_cleanup();
+#else
+	ztest_test_skip();
+#endif
+}
+
 ZTEST(net_socket_tcp, test_so_sndbuf)
 {
 	struct sockaddr_in bind_addr4;
@@ -2430,6 +2499,48 @@ ZTEST(net_socket_tcp, test_so_keepalive_opt)
 	test_context_cleanup();
 }
 
+ZTEST(net_socket_tcp, test_tcp_congestion_opt)
+{
+	struct sockaddr_in bind_addr4;
+	char name[16];
+	socklen_t optlen = sizeof(name);
+	int sock, ret;
+
+	if (!IS_ENABLED(CONFIG_NET_TCP_CONGESTION_AVOIDANCE)) {
+		ztest_test_skip();
+	}
+
+	prepare_sock_tcp_v4(MY_IPV4_ADDR, ANY_PORT, &sock, &bind_addr4);
+
+	ret = zsock_getsockopt(sock, IPPROTO_TCP, TCP_CONGESTION, name, &optlen);
+	zassert_equal(ret, 0, "getsockopt failed (%d)", errno);
+	zassert_str_equal(name, IS_ENABLED(CONFIG_NET_TCP_CONGESTION_DEFAULT_CUBIC) ?
+				"cubic" : "reno", "getsockopt got invalid value");
+	zassert_equal(optlen, strlen(name) + 1, "getsockopt got invalid size");
+
+	ret = zsock_setsockopt(sock, IPPROTO_TCP, TCP_CONGESTION, "vegas", strlen("vegas"));
+	zassert_equal(ret, -1, "setsockopt should've failed");
+	zassert_equal(errno, ENOENT, "wrong errno value, %d", errno);
+
+	ret = zsock_setsockopt(sock, IPPROTO_TCP, TCP_CONGESTION, "reno", strlen("reno"));
+	zassert_equal(ret, 0, "setsockopt failed (%d)", errno);
+
+	if (IS_ENABLED(CONFIG_NET_TCP_CUBIC)) {
+		ret = zsock_setsockopt(sock, IPPROTO_TCP, TCP_CONGESTION, "cubic",
+				       sizeof("cubic"));
+		zassert_equal(ret, 0, "setsockopt failed (%d)", errno);
+
+		optlen = sizeof(name);
+		ret = zsock_getsockopt(sock, IPPROTO_TCP, TCP_CONGESTION, name, &optlen);
+		zassert_equal(ret, 0, "getsockopt failed (%d)", errno);
+		zassert_str_equal(name, "cubic", "getsockopt got invalid value");
+	}
+
+	test_close(sock);
+
+	test_context_cleanup();
+}
+
 static void test_prepare_keepalive_socks(int *c_sock, int *s_sock, int *new_sock)
 {
 	struct sockaddr_in c_saddr, s_saddr;
@@ -3112,6 +3112,322 @@ ZTEST(net_socket_udp, test_40_clamp_udp_tcp_port_range)
 #endif
 }
 
+#define MMSG_COUNT 3
+
+ZTEST_USER(net_socket_udp, test_41_v4_sendmmsg_recvmmsg)
+{
+	int rv;
+	int client_sock;
+	int server_sock;
+	struct sockaddr_in client_addr;
+	struct sockaddr_in server_addr;
+	struct sockaddr_storage src_addr[MMSG_COUNT];
+	struct mmsghdr msgs[MMSG_COUNT];
+	struct iovec io_vector[MMSG_COUNT];
+	char rx_buf[MMSG_COUNT][16];
+	const char *tx_str[MMSG_COUNT] = { TEST_STR_SMALL, "datagram", "batch" };
+
+	prepare_sock_udp_v4(MY_IPV4_ADDR, ANY_PORT, &client_sock, &client_addr);
+	prepare_sock_udp_v4(MY_IPV4_ADDR, SERVER_PORT, &server_sock, &server_addr);
+
+	rv = zsock_bind(server_sock,
+			(struct sockaddr *)&server_addr,
+			sizeof(server_addr));
+	zassert_equal(rv, 0, "server bind failed");
+
+	rv = zsock_bind(client_sock,
+			(struct sockaddr *)&client_addr,
+			sizeof(client_addr));
+	zassert_equal(rv, 0, "client bind failed");
+
+	memset(msgs, 0, sizeof(msgs));
+	for (int i = 0; i < MMSG_COUNT; i++) {
+		io_vector[i].iov_base = (void *)tx_str[i];
+		io_vector[i].iov_len = strlen(tx_str[i]);
+		msgs[i].msg_hdr.msg_name = &server_addr;
+		msgs[i].msg_hdr.msg_namelen = sizeof(server_addr);
+		msgs[i].msg_hdr.msg_iov = &io_vector[i];
+		msgs[i].msg_hdr.msg_iovlen = 1;
+	}
+
+	rv = zsock_sendmmsg(client_sock, msgs, MMSG_COUNT, 0);
+	zassert_equal(rv, MMSG_COUNT, "sendmmsg failed (%d)", errno);
+
+	for (int i = 0; i < MMSG_COUNT; i++) {
+		zassert_equal(msgs[i].msg_len, strlen(tx_str[i]),
+			      "invalid msg_len for message %d", i);
+	}
+
+	memset(msgs, 0, sizeof(msgs));
+	for (int i = 0; i < MMSG_COUNT; i++) {
+		io_vector[i].iov_base = rx_buf[i];
+		io_vector[i].iov_len = sizeof(rx_buf[i]);
+		msgs[i].msg_hdr.msg_name = &src_addr[i];
+		msgs[i].msg_hdr.msg_namelen = sizeof(src_addr[i]);
+		msgs[i].msg_hdr.msg_iov = &io_vector[i];
+		msgs[i].msg_hdr.msg_iovlen = 1;
+	}
+
+	rv = zsock_recvmmsg(server_sock, msgs, MMSG_COUNT, 0, NULL);
+	zassert_equal(rv, MMSG_COUNT, "recvmmsg failed (%d)", errno);
+
+	for (int i = 0; i < MMSG_COUNT; i++) {
+		zassert_equal(msgs[i].msg_len, strlen(tx_str[i]),
+			      "invalid msg_len for message %d", i);
+		zassert_mem_equal(rx_buf[i], tx_str[i], msgs[i].msg_len,
+				  "invalid data in message %d", i);
+		zassert_equal(msgs[i].msg_hdr.msg_namelen, sizeof(struct sockaddr_in),
+			      "invalid msg_namelen for message %d", i);
+		zassert_equal(src_addr[i].ss_family, AF_INET,
+			      "invalid source family in message %d", i);
+	}
+
+	/* Nothing left, the first message is not waited for */
+	rv = zsock_recvmmsg(server_sock, msgs, MMSG_COUNT, ZSOCK_MSG_DONTWAIT, NULL);
+	zassert_equal(rv, -1, "recvmmsg should fail");
+	zassert_equal(errno, EAGAIN, "invalid errno (%d)", errno);
+
+	/* Only wait for the first message */
+	rv = zsock_sendto(client_sock, TEST_STR_SMALL, strlen(TEST_STR_SMALL), 0,
+			  (struct sockaddr *)&server_addr, sizeof(server_addr));
+	zassert_equal(rv, strlen(TEST_STR_SMALL), "sendto failed (%d)", errno);
+
+	rv = zsock_recvmmsg(server_sock, msgs, MMSG_COUNT, ZSOCK_MSG_WAITFORONE, NULL);
+	zassert_equal(rv, 1, "recvmmsg failed (%d)", errno);
+	zassert_equal(msgs[0].msg_len, strlen(TEST_STR_SMALL), "invalid msg_len");
+
+	rv = zsock_close(client_sock);
+	zassert_equal(rv, 0, "close failed");
+	rv = zsock_close(server_sock);
+	zassert_equal(rv, 0, "close failed");
+}
+
+ZTEST(net_socket_udp, test_42_v4_recv_send_loan)
+{
+#if defined(CONFIG_NET_SOCKETS_ZEROCOPY)
+	int rv;
+	ssize_t len;
+	int client_sock;
+	int server_sock;
+	struct sockaddr_in client_addr;
+	struct sockaddr_in server_addr;
+	struct sockaddr_in src_addr;
+	socklen_t src_addrlen = sizeof(src_addr);
+	struct net_buf *frags;
+	char rx_buf[sizeof(TEST_STR2)];
+
+	prepare_sock_udp_v4(MY_IPV4_ADDR, ANY_PORT, &client_sock, &client_addr);
+	prepare_sock_udp_v4(MY_IPV4_ADDR, SERVER_PORT, &server_sock, &server_addr);
+
+	rv = zsock_bind(server_sock,
+			(struct sockaddr *)&server_addr,
+			sizeof(server_addr));
+	zassert_equal(rv, 0, "server bind failed");
+
+	rv = zsock_sendto(client_sock, TEST_STR2, STRLEN(TEST_STR2), 0,
+			  (struct sockaddr *)&server_addr, sizeof(server_addr));
+	zassert_equal(rv, STRLEN(TEST_STR2), "sendto failed (%d)", errno);
+
+	/* The datagram spans several buffers, all of them are loaned */
+	len = zsock_recv_loan(server_sock, &frags, 0,
+			      (struct sockaddr *)&src_addr, &src_addrlen);
+	zassert_equal(len, STRLEN(TEST_STR2), "recv_loan failed (%d)", errno);
+	zassert_not_null(frags, "no buffers loaned");
+	zassert_equal(net_buf_frags_len(frags), len, "invalid loaned length");
+	zassert_equal(src_addrlen, sizeof(src_addr), "invalid address length");
+
+	zassert_equal(net_buf_linearize(rx_buf, sizeof(rx_buf), frags, 0, len), len);
+	zassert_mem_equal(rx_buf, TEST_STR2, len, "invalid loaned data");
+
+	/* Echo the loaned buffers back as they are */
+	rv = zsock_send_loan(server_sock, frags, 0,
+			     (struct sockaddr *)&src_addr, src_addrlen);
+	zassert_equal(rv, len, "send_loan failed (%d)", errno);
+
+	zsock_loan_release(frags);
+
+	memset(rx_buf, 0, sizeof(rx_buf));
+	rv = zsock_recv(client_sock, rx_buf, sizeof(rx_buf), 0);
+	zassert_equal(rv, len, "recv failed (%d)", errno);
+	zassert_mem_equal(rx_buf, TEST_STR2, len, "invalid echoed data");
+
+	len = zsock_recv_loan(server_sock, &frags, ZSOCK_MSG_DONTWAIT, NULL, NULL);
+	zassert_equal(len, -1, "recv_loan should fail");
+	zassert_equal(errno, EAGAIN, "invalid errno (%d)", errno);
+	zassert_is_null(frags, "buffers loaned on failure");
+
+	rv = zsock_close(client_sock);
+	zassert_equal(rv, 0, "close failed");
+	rv = zsock_close(server_sock);
+	zassert_equal(rv, 0, "close failed");
+#else
+	ztest_test_skip();
+#endif
+}
+
+ZTEST_USER(net_socket_udp, test_43_v4_recvmmsg_pktinfo)
+{
+	int rv;
+	int opt = 1;
+	int client_sock;
+	int server_sock;
+	struct sockaddr_in client_addr;
+	struct sockaddr_in server_addr;
+	struct sockaddr_storage src_addr[MMSG_COUNT];
+	struct mmsghdr msgs[MMSG_COUNT];
+	struct iovec io_vector[MMSG_COUNT];
+	char rx_buf[MMSG_COUNT][16];
+	union {
+		struct cmsghdr hdr;
+		unsigned char  buf[CMSG_SPACE(sizeof(struct in_pktinfo))];
+	} cmsgbuf[MMSG_COUNT];
+	struct cmsghdr *cmsg;
+
+	Z_TEST_SKIP_IFNDEF(CONFIG_NET_CONTEXT_RECV_PKTINFO);
+
+	prepare_sock_udp_v4(MY_IPV4_ADDR, ANY_PORT, &client_sock, &client_addr);
+	prepare_sock_udp_v4(MY_IPV4_ADDR, SERVER_PORT, &server_sock, &server_addr);
+
+	rv = zsock_bind(server_sock,
+			(struct sockaddr *)&server_addr,
+			sizeof(server_addr));
+	zassert_equal(rv, 0, "server bind failed");
+
+	rv = zsock_setsockopt(server_sock, IPPROTO_IP, IP_PKTINFO, &opt, sizeof(opt));
+	zassert_equal(rv, 0, "setsockopt failed (%d)", errno);
+
+	for (int i = 0; i < MMSG_COUNT; i++) {
+		rv = zsock_sendto(client_sock, TEST_STR_SMALL, strlen(TEST_STR_SMALL), 0,
+				  (struct sockaddr *)&server_addr, sizeof(server_addr));
+		zassert_equal(rv, strlen(TEST_STR_SMALL), "sendto failed (%d)", errno);
+	}
+
+	memset(msgs, 0, sizeof(msgs));
+	memset(cmsgbuf, 0, sizeof(cmsgbuf));
+	for (int i = 0; i < MMSG_COUNT; i++) {
+		io_vector[i].iov_base = rx_buf[i];
+		io_vector[i].iov_len = sizeof(rx_buf[i]);
+		msgs[i].msg_hdr.msg_name = &src_addr[i];
+		msgs[i].msg_hdr.msg_namelen = sizeof(src_addr[i]);
+		msgs[i].msg_hdr.msg_iov = &io_vector[i];
+		msgs[i].msg_hdr.msg_iovlen = 1;
+		msgs[i].msg_hdr.msg_control = cmsgbuf[i].buf;
+		msgs[i].msg_hdr.msg_controllen = sizeof(cmsgbuf[i].buf);
+	}
+
+	rv = zsock_recvmmsg(server_sock, msgs, MMSG_COUNT, 0, NULL);
+	zassert_equal(rv, MMSG_COUNT, "recvmmsg failed (%d)", errno);
+
+	for (int i = 0; i < MMSG_COUNT; i++) {
+		zassert_equal(msgs[i].msg_len, strlen(TEST_STR_SMALL),
+			      "invalid msg_len for message %d", i);
+		zassert_equal(msgs[i].msg_hdr.msg_namelen, sizeof(struct sockaddr_in),
+			      "invalid msg_namelen for message %d", i);
+		zassert_equal(msgs[i].msg_hdr.msg_controllen,
+			      CMSG_LEN(sizeof(struct in_pktinfo)),
+			      "invalid msg_controllen for message %d", i);
+		zassert_false(msgs[i].msg_hdr.msg_flags & ZSOCK_MSG_CTRUNC,
+			      "control data truncated in message %d", i);
+
+		cmsg = CMSG_FIRSTHDR(&msgs[i].msg_hdr);
+		zassert_not_null(cmsg, "no control data in message %d", i);
+		zassert_equal(cmsg->cmsg_level, IPPROTO_IP, "invalid cmsg_level");
+		zassert_equal(cmsg->cmsg_type, IP_PKTINFO, "invalid cmsg_type");
+		zassert_equal(((struct in_pktinfo *)CMSG_DATA(cmsg))->ipi_addr.s_addr,
+			      server_addr.sin_addr.s_addr,
+			      "invalid destination address in message %d", i);
+	}
+
+	rv = zsock_close(client_sock);
+	zassert_equal(rv, 0, "close failed");
+	rv = zsock_close(server_sock);
+	zassert_equal(rv, 0, "close failed");
+}
+
+ZTEST(net_socket_udp, test_44_v4_recv_loan_shared)
+{
+#if defined(CONFIG_NET_SOCKETS_ZEROCOPY)
+	int rv;
+	ssize_t len;
+	int server_sock;
+	struct sockaddr_in server_addr;
+	struct net_context *ctx;
+	struct net_pkt *pkt;
+	struct net_buf *shared;
+	struct net_buf *frags;
+
+	prepare_sock_udp_v4(MY_IPV4_ADDR, SERVER_PORT, &server_sock, &server_addr);
+
+	rv = zsock_bind(server_sock,
+			(struct sockaddr *)&server_addr,
+			sizeof(server_addr));
+	zassert_equal(rv, 0, "server bind failed");
+
+	ctx = zsock_get_context_object(server_sock);
+	zassert_not_null(ctx, "no context");
+
+	pkt = net_pkt_rx_alloc_with_buffer(net_if_get_default(), strlen(TEST_STR_SMALL),
+					   AF_INET, IPPROTO_UDP, K_NO_WAIT);
+	zassert_not_null(pkt, "cannot allocate pkt");
+	zassert_ok(net_pkt_write(pkt, TEST_STR_SMALL, strlen(TEST_STR_SMALL)));
+	net_pkt_cursor_init(pkt);
+
+	/* Queue a packet whose buffer is also held elsewhere, as when a
+	 * packet is delivered to several sockets. It must not be loaned.
+	 */
+	shared = net_buf_ref(pkt->buffer);
+	k_fifo_put(&ctx->recv_q, pkt);
+
+	len = zsock_recv_loan(server_sock, &frags, ZSOCK_MSG_DONTWAIT, NULL, NULL);
+	zassert_equal(len, strlen(TEST_STR_SMALL), "recv_loan failed (%d)", errno);
+	zassert_not_null(frags, "no buffers loaned");
+	zassert_not_equal(frags, shared, "shared buffer loaned");
+	zassert_mem_equal(frags->data, TEST_STR_SMALL, len, "invalid loaned data");
+
+	zassert_equal(shared->ref, 1, "shared buffer not released");
+	zassert_mem_equal(shared->data, TEST_STR_SMALL, len, "shared buffer modified");
+
+	zsock_loan_release(frags);
+	net_buf_unref(shared);
+
+	rv = zsock_close(server_sock);
+	zassert_equal(rv, 0, "close failed");
+#else
+	ztest_test_skip();
+#endif
+}
+
+ZTEST_USER(net_socket_udp, test_45_recv_send_loan_user)
+{
+#if defined(CONFIG_NET_SOCKETS_ZEROCOPY)
+	int rv;
+	int sock;
+	struct sockaddr_in addr;
+	struct net_buf *frags = NULL;
+
+	if (!k_is_user_context()) {
+		ztest_test_skip();
+	}
+
+	prepare_sock_udp_v4(MY_IPV4_ADDR, ANY_PORT, &sock, &addr);
+
+	/* Loaned buffers are kernel memory */
+	rv = zsock_recv_loan(sock, &frags, ZSOCK_MSG_DONTWAIT, NULL, NULL);
+	zassert_equal(rv, -1, "recv_loan should fail");
+	zassert_equal(errno, EPERM, "invalid errno (%d)", errno);
+	zassert_is_null(frags, "buffers loaned to user mode");
+
+	rv = zsock_send_loan(sock, frags, 0, (struct sockaddr *)&addr, sizeof(addr));
+	zassert_equal(rv, -1, "send_loan should fail");
+	zassert_equal(errno, EPERM, "invalid errno (%d)", errno);
+
+	rv = zsock_close(sock);
+	zassert_equal(rv, 0, "close failed");
+#else
+	ztest_test_skip();
+#endif
+}
+
 static void after(void *arg)
 {
 	ARG_UNUSED(arg);
@@ -31,7 +31,7 @@ LOG_MODULE_REGISTER(net_test, CONFIG_NET_TCP_LOG_LEVEL);
 #include "ipv4.h"
 #include "ipv6.h"
 #include "tcp.h"
-#include "tcp_private.h"
+#include "tcp_internal.h"
 #include "net_stats.h"
 
 #include <zephyr/ztest.h>
@@ -116,6 +116,8 @@ static enum test_case_no {
 	TEST_CLIENT_FIN_ACK_WITH_DATA = 18,
 	TEST_CLIENT_SEQ_VALIDATION = 19,
 	TEST_SERVER_ACK_VALIDATION = 20,
+	TEST_SERVER_SACK_BLOCKS = 21,
+	TEST_SERVER_SACK_RECOVERY = 22,
 } test_case_no;
 
 static enum test_state t_state;
@@ -142,6 +144,8 @@ static void handle_syn_invalid_ack(sa_family_t af, struct tcphdr *th);
 static void handle_client_fin_ack_with_data_test(sa_family_t af, struct tcphdr *th);
 static void handle_client_seq_validation_test(sa_family_t af, struct tcphdr *th);
 static void handle_server_ack_validation_test(struct net_pkt *pkt);
+static void handle_server_sack_blocks_test(struct net_pkt *pkt);
+static void handle_server_sack_recovery_test(struct net_pkt *pkt);
 
 static void verify_flags(struct tcphdr *th, uint8_t flags,
 			 const char *fun, int line)
@@ -239,6 +243,13 @@ static uint8_t tcp_options[20] = {
 	0x01, /* NOP */
 	0x03, 0x03, 0x07 /* Win scale*/ };
 
+/* Options added to the packets sent by the peer, when set */
+static const uint8_t *tester_options;
+static size_t tester_options_len;
+
+/* Whether the last SYN-ACK sent by the stack carried SACK-permitted */
+static bool syn_ack_sack_perm;
+
 static struct net_pkt *tester_prepare_tcp_pkt(sa_family_t af,
 					      uint16_t src_port,
 					      uint16_t dst_port,
@@ -247,13 +258,18 @@ static struct net_pkt *tester_prepare_tcp_pkt(sa_family_t af,
 					      size_t len)
 {
 	NET_PKT_DATA_ACCESS_DEFINE(tcp_access, struct tcphdr);
+	const uint8_t *opts = NULL;
 	struct net_pkt *pkt;
 	struct tcphdr *th;
 	uint8_t opts_len = 0;
 	int ret = -EINVAL;
 
 	if ((test_case_no == TEST_SERVER_WITH_OPTIONS_IPV4) && (flags & SYN)) {
+		opts = tcp_options;
 		opts_len = sizeof(tcp_options);
+	} else if (tester_options != NULL) {
+		opts = tester_options;
+		opts_len = tester_options_len;
 	}
 
 	/* Allocate buffer */
@@ -288,11 +304,7 @@ static struct net_pkt *tester_prepare_tcp_pkt(sa_family_t af,
 	th->th_sport = src_port;
 	th->th_dport = dst_port;
 
-	if ((test_case_no == TEST_SERVER_WITH_OPTIONS_IPV4) && (flags & SYN)) {
-		th->th_off = 10U;
-	} else {
-		th->th_off = 5U;
-	}
+	th->th_off = 5U + opts_len / 4U;
 
 	th->th_flags = flags;
 	th->th_win = htons(NET_IPV6_MTU);
@@ -307,9 +319,9 @@ static struct net_pkt *tester_prepare_tcp_pkt(sa_family_t af,
 		goto fail;
 	}
 
-	if ((test_case_no == TEST_SERVER_WITH_OPTIONS_IPV4) && (flags & SYN)) {
+	if (opts_len > 0) {
 		/* Add TCP Options */
-		ret = net_pkt_write(pkt, tcp_options, opts_len);
+		ret = net_pkt_write(pkt, opts, opts_len);
 		if (ret < 0) {
 			goto fail;
 		}
@@ -424,6 +436,53 @@ fail:
 	return -EINVAL;
 }
 
+/* Copy the value of the TCP option kind to value, return its length or
+ * -ENOENT if the segment does not carry the option.
+ */
+static int read_tcp_option(struct net_pkt *pkt, struct tcphdr *th, uint8_t kind,
+			   uint8_t *value)
+{
+	size_t opts_len = th->th_off * 4U - sizeof(struct tcphdr);
+	uint8_t opts[40];
+	int ret = -ENOENT;
+
+	net_pkt_cursor_init(pkt);
+	net_pkt_set_overwrite(pkt, true);
+
+	if (net_pkt_skip(pkt, net_pkt_ip_hdr_len(pkt) + net_pkt_ip_opts_len(pkt) +
+			 sizeof(struct tcphdr)) < 0 ||
+	    net_pkt_read(pkt, opts, opts_len) < 0) {
+		ret = -EINVAL;
+		goto out;
+	}
+
+	for (size_t i = 0; i < opts_len && opts[i] != NET_TCP_END_OPT; ) {
+		if (opts[i] == NET_TCP_NOP_OPT) {
+			i++;
+			continue;
+		}
+
+		if (i + 1 >= opts_len || opts[i + 1] < 2) {
+			break;
+		}
+
+		if (opts[i] == kind) {
+			ret = opts[i + 1] - 2;
+			if (value != NULL) {
+				memcpy(value, &opts[i + 2], ret);
+			}
+
+			break;
+		}
+
+		i += opts[i + 1];
+	}
+out:
+	net_pkt_cursor_init(pkt);
+
+	return ret;
+}
+
 static int tester_send(const struct device *dev, struct net_pkt *pkt)
 {
 	struct tcphdr th;
@@ -439,6 +498,10 @@ static int tester_send(const struct device *dev, struct net_pkt *pkt)
 		goto fail;
 	}
 
+	if ((th.th_flags & (SYN | ACK)) == (SYN | ACK)) {
+		syn_ack_sack_perm = read_tcp_option(pkt, &th, NET_TCP_SACK_PERM_OPT, NULL) == 0;
+	}
+
 	switch (test_case_no) {
 	case TEST_CLIENT_IPV4:
 	case TEST_CLIENT_IPV6:
@@ -494,6 +557,12 @@ static int tester_send(const struct device *dev, struct net_pkt *pkt)
 	case TEST_SERVER_ACK_VALIDATION:
 		handle_server_ack_validation_test(pkt);
 		break;
+	case TEST_SERVER_SACK_BLOCKS:
+		handle_server_sack_blocks_test(pkt);
+		break;
+	case TEST_SERVER_SACK_RECOVERY:
+		handle_server_sack_recovery_test(pkt);
+		break;
 	default:
 		zassert_true(false, "Undefined test case");
 	}
@@ -3002,4 +3071,374 @@ ZTEST(net_tcp, test_server_ack_validation)
 	net_context_put(accepted_ctx);
 }
 
+#define SACK_SEG_LEN 50
+#define SACK_SEG_COUNT 8
+
+static const uint8_t sack_syn_options[] = {
+	0x02, 0x04, 0x00, SACK_SEG_LEN, /* Max segment */
+	0x01, 0x01, /* NOP */
+	0x04, 0x02 /* SACK permitted */
+};
+
+static uint8_t sack_options[2 + NET_TCP_SACK_SIZE(NET_TCP_SACK_MAX_BLOCKS)];
+static uint32_t sack_edges[2 * NET_TCP_SACK_MAX_BLOCKS];
+static int sack_count;
+static uint32_t sack_ack;
+
+/* ACK carrying count SACK blocks, given as pairs of edges */
+static struct net_pkt *prepare_sack_packet(sa_family_t af, const uint32_t *edges, int count)
+{
+	struct net_pkt *pkt;
+
+	sack_options[0] = NET_TCP_NOP_OPT;
+	sack_options[1] = NET_TCP_NOP_OPT;
+	sack_options[2] = NET_TCP_SACK_OPT;
+	sack_options[3] = NET_TCP_SACK_SIZE(count);
+
+	for (int i = 0; i < 2 * count; i++) {
+		sys_put_be32(edges[i], &sack_options[4 + i * 4]);
+	}
+
+	if (count > 0) {
+		tester_options = sack_options;
+		tester_options_len = 2 + NET_TCP_SACK_SIZE(count);
+	}
+
+	pkt = prepare_ack_packet(af, htons(MY_PORT), htons(PEER_PORT));
+
+	tester_options = NULL;
+	tester_options_len = 0;
+
+	return pkt;
+}
+
+/* Accept a connection from a peer offering SACK, with a small MSS */
+static struct net_context *create_sack_server_socket(void)
+{
+	struct net_context *ctx;
+
+	tester_options = sack_syn_options;
+	tester_options_len = sizeof(sack_syn_options);
+	syn_ack_sack_perm = false;
+
+	ctx = create_server_socket(0, 0);
+
+	tester_options = NULL;
+	tester_options_len = 0;
+
+	zassert_true(syn_ack_sack_perm, "SACK-permitted not sent in SYN-ACK");
+#if defined(CONFIG_NET_TCP_SACK)
+	zassert_true(((struct tcp *)accepted_ctx->tcp)->sack_perm, "SACK not negotiated");
+#endif
+
+	return ctx;
+}
+
+static void close_sack_server_socket(struct net_context *ctx)
+{
+	struct net_pkt *rst;
+	int ret;
+
+	/* Just send a RST packet to abort the underlying connection, so that
+	 * the testcase does not need to implement full TCP closing handshake.
+	 */
+	rst = tester_prepare_tcp_pkt(AF_INET6, htons(MY_PORT), htons(PEER_PORT), RST, NULL, 0);
+	zassert_not_null(rst, "Cannot create pkt");
+
+	ret = net_recv_data(net_iface, rst);
+	zassert_true(ret == 0, "recv data failed (%d)", ret);
+
+	/* Let the receiving thread run */
+	k_msleep(50);
+
+	net_context_put(ctx);
+	net_context_put(accepted_ctx);
+}
+
+static void handle_server_sack_blocks_test(struct net_pkt *pkt)
+{
+	uint8_t value[NET_TCP_SACK_SIZE(NET_TCP_SACK_MAX_BLOCKS)];
+	struct tcphdr th;
+	int ret;
+
+	ret = read_tcp_header(pkt, &th);
+	if (ret < 0) {
+		goto fail;
+	}
+
+	sack_ack = ntohl(th.th_ack);
+
+	ret = read_tcp_option(pkt, &th, NET_TCP_SACK_OPT, value);
+	if (ret == -EINVAL) {
+		goto fail;
+	}
+
+	sack_count = MAX(ret, 0) / 8;
+	for (int i = 0; i < 2 * sack_count; i++) {
+		sack_edges[i] = sys_get_be32(&value[i * 4]);
+	}
+
+	test_sem_give();
+
+	return;
+
+fail:
+	zassert_true(false, "%s failed", __func__);
+	net_pkt_unref(pkt);
+}
+
+static void send_sack_test_data(uint32_t seq_base, int offset, int len)
+{
+	struct net_pkt *pkt;
+	int ret;
+
+	seq = seq_base + offset;
+	pkt = prepare_data_packet(AF_INET6, htons(MY_PORT), htons(PEER_PORT),
+				  lorem_ipsum + offset, len);
+	zassert_not_null(pkt, "Cannot create pkt");
+
+	ret = net_recv_data(net_iface, pkt);
+	zassert_true(ret == 0, "recv data failed (%d)", ret);
+
+	/* Peer will release the semaphore after it sends the ACK */
+	test_sem_take(K_MSEC(1000), __LINE__);
+}
+
+/* Out-of-order data is reported in SACK blocks, until the hole is filled */
+ZTEST(net_tcp, test_server_sack_blocks)
+{
+	struct net_context *ctx;
+	uint32_t seq_base;
+
+	Z_TEST_SKIP_IFNDEF(CONFIG_NET_TCP_SACK);
+
+	if (CONFIG_NET_TCP_RECV_QUEUE_TIMEOUT == 0) {
+		ztest_test_skip();
+	}
+
+	k_sem_reset(&test_sem);
+
+	ctx = create_sack_server_socket();
+	seq_base = seq;
+
+	test_case_no = TEST_SERVER_SACK_BLOCKS;
+
+	send_sack_test_data(seq_base, 20, 10);
+	zassert_equal(sack_ack, seq_base, "Unexpected ACK");
+	zassert_equal(sack_count, 1, "Expected 1 SACK block, got %d", sack_count);
+	zassert_equal(sack_edges[0], seq_base + 20, "Wrong SACK block start");
+	zassert_equal(sack_edges[1], seq_base + 30, "Wrong SACK block end");
+
+	send_sack_test_data(seq_base, 30, 10);
+	zassert_equal(sack_ack, seq_base, "Unexpected ACK");
+	zassert_equal(sack_count, 1, "Expected 1 SACK block, got %d", sack_count);
+	zassert_equal(sack_edges[0], seq_base + 20, "Wrong SACK block start");
+	zassert_equal(sack_edges[1], seq_base + 40, "Wrong SACK block end");
+
+	/* Filling the hole acknowledges everything, without SACK blocks */
+	send_sack_test_data(seq_base, 0, 20);
+	zassert_equal(sack_ack, seq_base + 40, "Queued data not acknowledged");
+	zassert_equal(sack_count, 0, "Unexpected SACK blocks");
+
+	seq = seq_base + 40;
+	close_sack_server_socket(ctx);
+}
+
+static uint32_t sack_seq_base;
+static uint8_t sack_segs_sent[SACK_SEG_COUNT];
+static bool sack_segs_received[SACK_SEG_COUNT];
+
+/* Segments lost on their first transmission */
+#define SACK_SEGS_DROPPED (BIT(1) | BIT(4))
+
+static void handle_server_sack_recovery_test(struct net_pkt *pkt)
+{
+	uint32_t edges[2 * NET_TCP_SACK_MAX_BLOCKS];
+	struct net_pkt *reply;
+	struct tcphdr th;
+	int count = 0;
+	size_t len;
+	int ret;
+	int i;
+
+	ret = read_tcp_header(pkt, &th);
+	if (ret < 0) {
+		goto fail;
+	}
+
+	len = net_pkt_get_len(pkt) - net_pkt_ip_hdr_len(pkt) -
+	      net_pkt_ip_opts_len(pkt) - th.th_off * 4U;
+	if (len == 0) {
+		return;
+	}
+
+	i = (ntohl(th.th_seq) - sack_seq_base) / SACK_SEG_LEN;
+	zassert_true(i >= 0 && i < SACK_SEG_COUNT, "Unexpected seq %u", ntohl(th.th_seq));
+
+	if (sack_segs_sent[i]++ == 0 && (SACK_SEGS_DROPPED & BIT(i))) {
+		return;
+	}
+
+	sack_segs_received[i] = true;
+
+	/* Acknowledge up to the first hole, and SACK what was received above */
+	for (i = 0; i < SACK_SEG_COUNT && sack_segs_received[i]; i++) {
+	}
+
+	ack = sack_seq_base + i * SACK_SEG_LEN;
+
+	for (; i < SACK_SEG_COUNT; i++) {
+		if (!sack_segs_received[i]) {
+			continue;
+		}
+
+		if (!sack_segs_received[i - 1]) {
+			edges[count++] = sack_seq_base + i * SACK_SEG_LEN;
+		}
+
+		if (i == SACK_SEG_COUNT - 1 || !sack_segs_received[i + 1]) {
+			edges[count++] = sack_seq_base + (i + 1) * SACK_SEG_LEN;
+		}
+	}
+
+	reply = prepare_sack_packet(net_pkt_family(pkt), edges, count / 2);
+	zassert_not_null(reply, "Cannot create pkt");
+
+	ret = net_recv_data(net_iface, reply);
+	zassert_true(ret == 0, "recv data failed (%d)", ret);
+
+	if (ack == sack_seq_base + SACK_SEG_COUNT * SACK_SEG_LEN) {
+		test_sem_give();
+	}
+
+	return;
+
+fail:
+	zassert_true(false, "%s failed", __func__);
+	net_pkt_unref(pkt);
+}
+
+/* Two segments of a window are lost, only these two are retransmitted, well
+ * before the retransmission timer expires.
+ */
+ZTEST(net_tcp, test_server_sack_recovery)
+{
+	struct net_context *ctx;
+	int ret;
+
+	Z_TEST_SKIP_IFNDEF(CONFIG_NET_TCP_SACK);
+	/* The whole window is to be sent at once */
+	Z_TEST_SKIP_IFDEF(CONFIG_NET_TCP_CONGESTION_AVOIDANCE);
+
+	k_sem_reset(&test_sem);
+
+	ctx = create_sack_server_socket();
+	sack_seq_base = ack;
+
+	memset(sack_segs_sent, 0, sizeof(sack_segs_sent));
+	memset(sack_segs_received, 0, sizeof(sack_segs_received));
+
+	test_case_no = TEST_SERVER_SACK_RECOVERY;
+
+	ret = net_context_send(accepted_ctx, lorem_ipsum, SACK_SEG_COUNT * SACK_SEG_LEN,
+			       NULL, K_NO_WAIT, NULL);
+	zassert_true(ret >= 0, "Failed to send data to peer %d", ret);
+
+	/* Peer will release the semaphore once it received everything */
+	test_sem_take(K_MSEC(1000), __LINE__);
+
+	for (int i = 0; i < SACK_SEG_COUNT; i++) {
+		zassert_equal(sack_segs_sent[i], (SACK_SEGS_DROPPED & BIT(i)) ? 2 : 1,
+			      "Segment %d sent %d times", i, sack_segs_sent[i]);
+	}
+
+	close_sack_server_socket(ctx);
+}
+
+#if defined(CONFIG_NET_TCP_CUBIC)
+#define CUBIC_MSS 500
+/* RFC 9438 windows of 100 segments before the loss */
+#define CUBIC_W_MAX (100 * CUBIC_MSS)
+/* Allow the clock to tick while the ACK is handled */
+#define CUBIC_TOLERANCE 20
+
+/* A whole window is acknowledged t ms into the congestion avoidance epoch */
+static void cubic_ack_at(struct tcp *conn, uint32_t t)
+{
+	conn->ca.cubic.epoch_start = k_uptime_get_32() - t;
+	tcp_cubic_ops.on_ack(conn, conn->ca.cwnd);
+}
+#endif
+
+/* CUBIC window growth through an epoch, against values computed from
+ * W_cubic(t) = C * (t - K)^3 + W_max with C = 0.4 and beta = 0.7
+ */
+ZTEST(net_tcp, test_cubic_epoch)
+{
+#if defined(CONFIG_NET_TCP_CUBIC)
+	struct net_context *ctx;
+	struct tcp *conn;
+	enum tcp_state state;
+	int ret;
+
+	ret = net_context_get(AF_INET, SOCK_STREAM, IPPROTO_TCP, &ctx);
+	zassert_equal(ret, 0, "Cannot get context (%d)", ret);
+
+	conn = ctx->tcp;
+	conn->recv_options.mss = CUBIC_MSS;
+	conn->recv_options.mss_found = true;
+	zassert_equal(conn_mss(conn), CUBIC_MSS, "Unexpected MSS");
+
+	conn->ca.ops = &tcp_cubic_ops;
+	conn->ca.ops->init(conn);
+	conn->rtt.srtt = 0;
+
+	/* Loss at 100 segments: beta = 0.7 */
+	conn->ca.cwnd = CUBIC_W_MAX;
+	conn->unacked_len = CUBIC_W_MAX;
+	tcp_cubic_ops.on_loss(conn);
+	zassert_equal(conn->ca.cubic.w_max, CUBIC_W_MAX, "Wrong W_max");
+	zassert_equal(conn->ca.ssthresh, 70 * CUBIC_MSS, "Wrong ssthresh");
+
+	/* Recovery is over, the epoch starts with the first ACK.
+	 * K = cbrt((100 - 70) / 0.4) = 4.2172 s
+	 */
+	conn->ca.cwnd = conn->ca.ssthresh;
+	cubic_ack_at(conn, 0);
+	zassert_within(conn->ca.cubic.k, 4217, 1, "Wrong K %u", conn->ca.cubic.k);
+
+	/* Concave region, W_cubic(2 s) = 95.640 segments */
+	cubic_ack_at(conn, 2000);
+	zassert_within(conn->ca.cwnd, 47820, CUBIC_TOLERANCE, "cwnd %u", conn->ca.cwnd);
+
+	/* Plateau, W_cubic(K) = W_max */
+	cubic_ack_at(conn, 4217);
+	zassert_within(conn->ca.cwnd, 50000, CUBIC_TOLERANCE, "cwnd %u", conn->ca.cwnd);
+
+	/* Convex region, W_cubic(6 s) = 102.267 segments */
+	cubic_ack_at(conn, 6000);
+	zassert_within(conn->ca.cwnd, 51133, CUBIC_TOLERANCE, "cwnd %u", conn->ca.cwnd);
+
+	/* Loss below W_max: fast convergence sets W_max to 0.85 * cwnd */
+	conn->ca.cwnd = 90 * CUBIC_MSS;
+	conn->unacked_len = 90 * CUBIC_MSS;
+	conn->ca.cubic.w_max = CUBIC_W_MAX;
+	tcp_cubic_ops.on_loss(conn);
+	zassert_equal(conn->ca.cubic.w_max, 90 * CUBIC_MSS * 17 / 20, "Wrong W_max");
+	zassert_equal(conn->ca.ssthresh, 63 * CUBIC_MSS, "Wrong ssthresh");
+
+	/* Switching algorithm on a live connection keeps ssthresh */
+	state = conn->state;
+	conn->state = TCP_ESTABLISHED;
+	ret = net_tcp_set_option(ctx, TCP_OPT_CONGESTION, "reno", sizeof("reno"));
+	zassert_equal(ret, 0, "Cannot set congestion control (%d)", ret);
+	zassert_equal(conn->ca.ssthresh, 63 * CUBIC_MSS, "ssthresh reset on switch");
+	conn->state = state;
+
+	net_context_put(ctx);
+#else
+	ztest_test_skip();
+#endif
+}
+
 ZTEST_SUITE(net_tcp, NULL, presetup, NULL, NULL, NULL);
@@ -653,4 +653,80 @@ ZTEST(udp_fn_tests, test_udp)
 	zassert_false(test_failed, "udp tests failed");
 }
 
+#define MANY_CONNS 48
+#define MANY_CONNS_PKTS 256
+#define MANY_CONNS_LOCAL_PORT 4000
+#define MANY_CONNS_REMOTE_PORT 2000
+
+/* One listener and many connected handlers on the same local port, as a
+ * server with many clients has. Each packet must reach the handler of its
+ * remote port, or the listener.
+ */
+ZTEST(udp_fn_tests, test_udp_many_conns)
+{
+	static struct ud uds[MANY_CONNS];
+	struct net_conn_handle *handles[MANY_CONNS];
+	struct in_addr in4addr_my = { { { 192, 0, 2, 1 } } };
+	struct in_addr in4addr_peer = { { { 192, 0, 2, 9 } } };
+	struct sockaddr_in my_addr4 = { .sin_family = AF_INET };
+	struct sockaddr_in peer_addr4 = { .sin_family = AF_INET };
+	struct net_if *iface;
+	uint32_t start, cycles;
+	int ret, i;
+	bool st;
+
+	iface = net_if_get_first_by_type(&NET_L2_GET_NAME(DUMMY));
+
+	zassert_not_null(net_if_ipv4_addr_add(iface, &in4addr_my, NET_ADDR_MANUAL, 0),
+			 "Cannot add IPv4 address");
+
+	net_ipaddr_copy(&my_addr4.sin_addr, &in4addr_my);
+	net_ipaddr_copy(&peer_addr4.sin_addr, &in4addr_peer);
+
+	k_sem_init(&recv_lock, 0, UINT_MAX);
+
+	for (i = 0; i < MANY_CONNS; i++) {
+		uds[i].remote_addr = (i == 0) ? NULL : (struct sockaddr *)&peer_addr4;
+		uds[i].local_addr = (struct sockaddr *)&my_addr4;
+		uds[i].remote_port = (i == 0) ? 0 : MANY_CONNS_REMOTE_PORT + i;
+		uds[i].local_port = MANY_CONNS_LOCAL_PORT;
+		uds[i].test = (i == 0) ? "many conns listener" : "many conns connected";
+
+		ret = net_udp_register(AF_INET, uds[i].remote_addr, uds[i].local_addr,
+				       uds[i].remote_port, uds[i].local_port,
+				       NULL, test_ok, &uds[i], &handles[i]);
+		zassert_equal(ret, 0, "UDP register %d failed (%d)", i, ret);
+
+		uds[i].handle = handles[i];
+	}
+
+	for (i = 0; i < MANY_CONNS; i++) {
+		st = send_ipv4_udp_msg(iface, &in4addr_peer, &in4addr_my,
+				       MANY_CONNS_REMOTE_PORT + i, MANY_CONNS_LOCAL_PORT,
+				       &uds[i], false);
+		zassert_true(st, "UDP test \"%s\" %d fail", uds[i].test, i);
+	}
+
+	start = k_cycle_get_32();
+
+	for (i = 0; i < MANY_CONNS_PKTS; i++) {
+		int n = i % MANY_CONNS;
+
+		st = send_ipv4_udp_msg(iface, &in4addr_peer, &in4addr_my,
+				       MANY_CONNS_REMOTE_PORT + n, MANY_CONNS_LOCAL_PORT,
+				       &uds[n], false);
+		zassert_true(st, "UDP test \"%s\" %d fail", uds[n].test, n);
+	}
+
+	cycles = k_cycle_get_32() - start;
+
+	TC_PRINT("%d connections: %u ns per received packet\n", MANY_CONNS,
+		 (uint32_t)(k_cyc_to_ns_floor64(cycles) / MANY_CONNS_PKTS));
+
+	for (i = 0; i < MANY_CONNS; i++) {
+		ret = net_udp_unregister(handles[i]);
+		zassert_equal(ret, 0, "UDP unregister %d failed (%d)", i, ret);
+	}
+}
+
 ZTEST_SUITE(udp_fn_tests, NULL, NULL, NULL, NULL, NULL);
@@ -74,6 +74,54 @@ ZTEST(crc, test_crc32_ieee)
 	zassert_equal(crc32_ieee(test3, sizeof(test3)), 0x20089AA4);
 }
 
+/* Bit at a time reference for the reflected CRC32 variants */
+static uint32_t crc32_reflected_ref(uint32_t poly, const uint8_t *data, size_t len)
+{
+	uint32_t crc = 0xFFFFFFFF;
+
+	for (size_t i = 0; i < len; i++) {
+		crc ^= data[i];
+		for (int b = 0; b < 8; b++) {
+			crc = (crc >> 1) ^ ((crc & 1) ? poly : 0);
+		}
+	}
+
+	return ~crc;
+}
+
+ZTEST(crc, test_crc32_long)
+{
+	static uint8_t buf[1031];
+	uint32_t crc;
+
+	for (size_t i = 0; i < sizeof(buf); i++) {
+		buf[i] = (uint8_t)(i * 131 + 7);
+	}
+
+	/* Exercise every alignment and tail length of the word-wise paths */
+	for (size_t off = 0; off < 8; off++) {
+		for (size_t len = 0; len + off <= sizeof(buf); len += 61) {
+			zassert_equal(crc32_ieee(&buf[off], len),
+				      crc32_reflected_ref(0xEDB88320, &buf[off], len),
+				      "offset %zu length %zu", off, len);
+			zassert_equal(crc32_c(0, &buf[off], len, true, true),
+				      crc32_reflected_ref(0x82F63B78, &buf[off], len),
+				      "offset %zu length %zu", off, len);
+		}
+	}
+
+	/* Same stream, split in uneven chunks */
+	crc = crc32_ieee_update(0, buf, 3);
+	crc = crc32_ieee_update(crc, &buf[3], 500);
+	crc = crc32_ieee_update(crc, &buf[503], sizeof(buf) - 503);
+	zassert_equal(crc, crc32_reflected_ref(0xEDB88320, buf, sizeof(buf)));
+
+	crc = crc32_c(0, buf, 3, true, false);
+	crc = crc32_c(crc, &buf[3], 500, false, false);
+	crc = crc32_c(crc, &buf[503], sizeof(buf) - 503, false, true);
+	zassert_equal(crc, crc32_reflected_ref(0x82F63B78, buf, sizeof(buf)));
+}
+
 ZTEST(crc, test_crc24_pgp)
 {
 	uint8_t test1[] = { 'A' };